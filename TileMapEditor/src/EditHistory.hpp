@@ -0,0 +1,215 @@
+#pragma once
+
+#include <SFML/System.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+// 에디터 실행 취소/다시 실행 기록
+//
+// 마우스를 누르고 뗄 때까지(스트로크)의 타일 변경을 하나로 모아서
+// (시작 인덱스, 길이, 이전 타일, 새 타일) 구간으로 압축해 저장함
+// - 스트로크 안에서 같은 칸을 여러 번 바꾸면 처음 값과 마지막 값만 남김
+// - 이전/새 값이 같은 연속 칸은 구간 하나로 합침 (큰 영역 채우기는 줄 단위 구간 몇 개)
+// - 적 스폰은 목록 전체가 아니라 스트로크에서 추가/삭제된 위치만 저장 (추가 후 삭제하면 상쇄)
+// - 전체 기록이 메모리 예산을 넘으면 오래된 스트로크부터 버림
+template<typename Tile>
+class EditHistory {
+public:
+    // 같은 (이전, 새) 값을 가진 연속 칸 (인덱스 = y * width + x)
+    struct Run {
+        uint32_t start = 0;
+        uint32_t length = 0;
+        Tile oldTile;
+        Tile newTile;
+    };
+
+    struct Stroke {
+        int layerIndex = 0;
+        int width = 0;  // 인덱스 -> 좌표 변환용 맵 너비
+        std::vector<Run> runs;
+        bool spawnsChanged = false;
+        sf::Vector2i oldPlayerSpawn = {-1, -1};
+        sf::Vector2i newPlayerSpawn = {-1, -1};
+        std::vector<sf::Vector2i> addedEnemies;    // 스트로크에서 새로 생긴 적 스폰
+        std::vector<sf::Vector2i> removedEnemies;  // 스트로크에서 없어진 적 스폰
+
+        size_t memoryUsage() const {
+            return sizeof(Stroke) + runs.capacity() * sizeof(Run) +
+                   (addedEnemies.capacity() + removedEnemies.capacity()) * sizeof(sf::Vector2i);
+        }
+    };
+
+    static constexpr size_t DEFAULT_BUDGET = 64u * 1024u * 1024u;
+
+    explicit EditHistory(size_t budgetBytes = DEFAULT_BUDGET)
+        : m_budget(budgetBytes) {}
+
+    void setBudget(size_t budgetBytes) {
+        m_budget = budgetBytes;
+        trimToBudget();
+    }
+    size_t getBudget() const { return m_budget; }
+    size_t getMemoryUsage() const { return m_memoryUsage; }
+
+    bool isRecording() const { return m_recording; }
+    bool canUndo() const { return !m_undo.empty(); }
+    bool canRedo() const { return !m_redo.empty(); }
+
+    void beginStroke(int layerIndex, int width, sf::Vector2i playerSpawn) {
+        m_recording = true;
+        m_current = Stroke{};
+        m_current.layerIndex = layerIndex;
+        m_current.width = width;
+        m_current.oldPlayerSpawn = playerSpawn;
+        m_pending.clear();
+        m_pendingIndex.clear();
+        m_pendingEnemies.clear();
+    }
+
+    // 칸 하나 변경 기록 (같은 스트로크에서 이미 바뀐 칸이면 새 값만 갱신)
+    void recordTile(uint32_t index, const Tile& oldTile, const Tile& newTile) {
+        if (!m_recording) return;
+        auto found = m_pendingIndex.find(index);
+        if (found != m_pendingIndex.end()) {
+            m_pending[found->second].newTile = newTile;
+            return;
+        }
+        m_pendingIndex.emplace(index, m_pending.size());
+        m_pending.push_back({index, 1, oldTile, newTile});
+    }
+
+    // 연속 칸 변경 기록 (대량 편집용, 같은 스트로크의 다른 기록과 겹치지 않아야 함)
+    void recordRun(uint32_t start, uint32_t length, const Tile& oldTile, const Tile& newTile) {
+        if (!m_recording || length == 0) return;
+        m_bulk.push_back({start, length, oldTile, newTile});
+    }
+
+    // 적 스폰 추가/삭제 기록 (실제로 목록이 바뀐 경우에만 부름)
+    void recordEnemyAdded(sf::Vector2i tile) { recordEnemy(tile, 1); }
+    void recordEnemyRemoved(sf::Vector2i tile) { recordEnemy(tile, -1); }
+
+    // 스트로크 종료 (바뀐 것이 없으면 기록하지 않음), 기록했으면 true
+    bool endStroke(sf::Vector2i playerSpawn) {
+        if (!m_recording) return false;
+        m_recording = false;
+
+        std::vector<Run> runs;
+        runs.reserve(m_pending.size() + m_bulk.size());
+        for (const Run& run : m_pending) {
+            if (run.oldTile != run.newTile) runs.push_back(run);
+        }
+        for (const Run& run : m_bulk) {
+            if (run.oldTile != run.newTile) runs.push_back(run);
+        }
+        m_pending.clear();
+        m_pendingIndex.clear();
+        m_bulk.clear();
+
+        auto byStart = [](const Run& a, const Run& b) { return a.start < b.start; };
+        if (!std::is_sorted(runs.begin(), runs.end(), byStart)) {
+            std::sort(runs.begin(), runs.end(), byStart);
+        }
+
+        // 이어지고 값이 같은 구간 합치기
+        for (const Run& run : runs) {
+            if (!m_current.runs.empty()) {
+                Run& last = m_current.runs.back();
+                if (last.start + last.length == run.start && last.oldTile == run.oldTile && last.newTile == run.newTile) {
+                    last.length += run.length;
+                    continue;
+                }
+            }
+            m_current.runs.push_back(run);
+        }
+        m_current.runs.shrink_to_fit();
+
+        for (const auto& [key, delta] : m_pendingEnemies) {
+            sf::Vector2i tile = {static_cast<int32_t>(key >> 32), static_cast<int32_t>(static_cast<uint32_t>(key))};
+            if (delta > 0) m_current.addedEnemies.push_back(tile);
+            if (delta < 0) m_current.removedEnemies.push_back(tile);
+        }
+        m_pendingEnemies.clear();
+        m_current.addedEnemies.shrink_to_fit();
+        m_current.removedEnemies.shrink_to_fit();
+
+        m_current.newPlayerSpawn = playerSpawn;
+        m_current.spawnsChanged = m_current.oldPlayerSpawn != m_current.newPlayerSpawn ||
+                                  !m_current.addedEnemies.empty() || !m_current.removedEnemies.empty();
+        if (m_current.runs.empty() && !m_current.spawnsChanged) return false;
+
+        clearRedo();
+        m_memoryUsage += m_current.memoryUsage();
+        m_undo.push_back(std::move(m_current));
+        trimToBudget();
+        return true;
+    }
+
+    // 마지막으로 기록된 스트로크 (endStroke가 true를 반환한 직후에 읽음)
+    const Stroke* lastStroke() const { return m_undo.empty() ? nullptr : &m_undo.back(); }
+
+    // 실행 취소할 스트로크를 꺼냄 (적용은 호출하는 쪽에서 oldTile/oldPlayerSpawn, 추가/삭제 반대로)
+    const Stroke* undo() {
+        if (m_undo.empty()) return nullptr;
+        m_redo.push_back(std::move(m_undo.back()));
+        m_undo.pop_back();
+        return &m_redo.back();
+    }
+
+    // 다시 실행할 스트로크를 꺼냄 (적용은 newTile/newPlayerSpawn, 추가/삭제 그대로)
+    const Stroke* redo() {
+        if (m_redo.empty()) return nullptr;
+        m_undo.push_back(std::move(m_redo.back()));
+        m_redo.pop_back();
+        return &m_undo.back();
+    }
+
+    void clear() {
+        m_undo.clear();
+        m_redo.clear();
+        m_memoryUsage = 0;
+        m_recording = false;
+        m_pending.clear();
+        m_pendingIndex.clear();
+        m_bulk.clear();
+        m_pendingEnemies.clear();
+    }
+
+private:
+    // 같은 위치의 추가와 삭제는 서로 상쇄 (-1: 삭제됨, 0: 변화 없음, 1: 추가됨)
+    void recordEnemy(sf::Vector2i tile, int delta) {
+        if (!m_recording) return;
+        uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(tile.x)) << 32) | static_cast<uint32_t>(tile.y);
+        m_pendingEnemies[key] += delta;
+    }
+
+    void clearRedo() {
+        for (const Stroke& stroke : m_redo) {
+            m_memoryUsage -= stroke.memoryUsage();
+        }
+        m_redo.clear();
+    }
+
+    void trimToBudget() {
+        // 방금 넣은 스트로크 하나는 예산을 넘어도 남겨둠
+        while (m_memoryUsage > m_budget && m_undo.size() > 1) {
+            m_memoryUsage -= m_undo.front().memoryUsage();
+            m_undo.pop_front();
+        }
+    }
+
+    size_t m_budget;
+    size_t m_memoryUsage = 0;
+    std::deque<Stroke> m_undo;
+    std::deque<Stroke> m_redo;
+
+    bool m_recording = false;
+    Stroke m_current;
+    std::vector<Run> m_pending;                         // 칸 단위 기록 (스트로크 중)
+    std::unordered_map<uint32_t, size_t> m_pendingIndex;  // 인덱스 -> m_pending 위치
+    std::vector<Run> m_bulk;                            // 구간 단위 기록 (스트로크 중)
+    std::unordered_map<uint64_t, int> m_pendingEnemies;  // 적 스폰 좌표 -> 추가/삭제 누적 (스트로크 중)
+};
@@ -1,6 +1,10 @@
 #include "Editor.hpp"
-#include <iostream>
+#include "Profiler.hpp"
+#include "RenderStats.hpp"
+#include "Log.hpp"
+#include "ParallelFor.hpp"
 #include <fstream>
+#include <filesystem>
 #include <cstdint>
 #include <algorithm>
 #include <cmath>
@@ -9,9 +13,9 @@
 
 // macOS 파일 다이얼로그 (osascript 사용)
 #ifdef __APPLE__
-std::string openSaveFileDialog(const std::string& defaultName = "level.tilemap") {
+std::string openSaveFileDialog(const std::string& defaultName, const std::string& extension) {
     // choose file name은 file specifier를 반환하므로 as text로 변환 후 POSIX path 사용
-    std::string command = "osascript -e 'set chosenFile to choose file name with prompt \"Save Tilemap As\" default name \"" + defaultName + "\"' "
+    std::string command = "osascript -e 'set chosenFile to choose file name with prompt \"Save As\" default name \"" + defaultName + "\"' "
                           "-e 'return POSIX path of chosenFile' 2>/dev/null";
 
     std::array<char, 1024> buffer;
@@ -29,9 +33,9 @@ std::string openSaveFileDialog(const std::string& defaultName = "level.tilemap")
         result.pop_back();
     }
 
-    // .tilemap 확장자 자동 추가
-    if (!result.empty() && result.find(".tilemap") == std::string::npos) {
-        result += ".tilemap";
+    // 확장자 자동 추가
+    if (!result.empty() && result.find(extension) == std::string::npos) {
+        result += extension;
     }
 
     return result;
@@ -61,7 +65,7 @@ std::string openLoadFileDialog() {
 }
 #else
 // 다른 플랫폼용 기본 구현 (빈 문자열 반환 = 취소)
-std::string openSaveFileDialog(const std::string& = "level.tilemap") {
+std::string openSaveFileDialog(const std::string&, const std::string&) {
     return "";
 }
 std::string openLoadFileDialog() {
@@ -69,19 +73,54 @@ std::string openLoadFileDialog() {
 }
 #endif
 
-// 바이너리 파일 매직 넘버 및 버전
-constexpr char FILE_MAGIC[4] = {'T', 'M', 'A', 'P'};
-constexpr uint16_t FILE_VERSION = 2;  // Version 2: CollisionShape 추가
-constexpr uint16_t FILE_VERSION_1 = 1;  // 이전 버전 호환용
+namespace {
+// 영역 편집에서 이만큼 넘는 칸을 바꿀 때만 작업 스레드로 나눔
+constexpr int PARALLEL_MIN_CELLS = 256 * 1024;
+
+// 다이얼로그 기본 파일명 (경로와 확장자를 떼고 extension을 붙임)
+std::string defaultFileName(const std::string& currentFilename, const std::string& extension) {
+    std::string name = currentFilename.empty() ? "level" : currentFilename;
+    size_t lastSlash = name.find_last_of('/');
+    if (lastSlash != std::string::npos) {
+        name = name.substr(lastSlash + 1);
+    }
+    size_t dot = name.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) {
+        name = name.substr(0, dot);
+    }
+    return name + extension;
+}
+
+// 타일 타입의 기본 충돌 형태 (영역 채우기용)
+EditorTile defaultTile(TileType type) {
+    switch (type) {
+        case TileType::Solid: return {TileType::Solid, CollisionShape::Full};
+        case TileType::Platform: return {TileType::Platform, CollisionShape::Platform};
+        default: return {};
+    }
+}
+}
 
 Editor::Editor(unsigned int windowWidth, unsigned int windowHeight)
     : m_window(sf::VideoMode({windowWidth, windowHeight}), "TileMap Editor")
+    , m_target(m_window)
+    , m_profilerOverlay(m_font, {210.f, 50.f})
 {
     m_window.setFramerateLimit(60);
+    initialize(windowWidth, windowHeight);
+}
 
+Editor::Editor(sf::RenderTarget& target)
+    : m_target(target)
+    , m_profilerOverlay(m_font, {210.f, 50.f})
+{
+    initialize(target.getSize().x, target.getSize().y);
+}
+
+void Editor::initialize(unsigned int windowWidth, unsigned int windowHeight) {
     // 폰트 로드
     if (!m_font.openFromFile("/System/Library/Fonts/Supplemental/Arial.ttf")) {
-        std::cerr << "Failed to load font!" << std::endl;
+        LOG_ERROR("Failed to load font!");
     }
 
     // UI 영역 설정
@@ -111,6 +150,12 @@ Editor::Editor(unsigned int windowWidth, unsigned int windowHeight)
         {m_canvasRect.size.x / windowWidth, m_canvasRect.size.y / windowHeight}
     ));
 
+    // 미니맵: 캔버스 오른쪽 아래 (맵 크기는 그릴 때 맞춤)
+    m_minimap.setSource([this](const sf::IntRect& rect) { return countMinimapBlock(rect); });
+    m_minimap.setBounds({{m_canvasRect.position.x + m_canvasRect.size.x - MINIMAP_SIZE - MINIMAP_MARGIN,
+                          m_canvasRect.position.y + m_canvasRect.size.y - MINIMAP_SIZE - MINIMAP_MARGIN},
+                         {MINIMAP_SIZE, MINIMAP_SIZE}}, {1.f, 1.f});
+
     // 기본 레이어 추가
     addLayer("Ground");
 
@@ -125,17 +170,31 @@ Editor::Editor(unsigned int windowWidth, unsigned int windowHeight)
 void Editor::run() {
     sf::Clock clock;
 
+    PROFILE_THREAD("Editor");
+
     while (m_isRunning && m_window.isOpen()) {
+        PROFILE_FRAME();
         float deltaTime = clock.restart().asSeconds();
 
-        handleEvents();
-        update(deltaTime);
+        {
+            PROFILE_SCOPE("Events");
+            handleEvents();
+        }
+        {
+            PROFILE_SCOPE("Update");
+            update(deltaTime);
+        }
         render();
     }
+    finishSaves();
+    closeJournal();
 }
 
 void Editor::handleEvents() {
+    m_input.beginFrame();
     while (const auto event = m_window.pollEvent()) {
+        m_input.handleEvent(*event);
+
         if (event->is<sf::Event::Closed>()) {
             m_isRunning = false;
         }
@@ -147,13 +206,17 @@ void Editor::handleEvents() {
         if (const auto* mousePressed = event->getIf<sf::Event::MouseButtonPressed>()) {
             sf::Vector2i mousePos = {mousePressed->position.x, mousePressed->position.y};
             bool isLeft = mousePressed->button == sf::Mouse::Button::Left;
+            beginStroke();
             handleMouseClick(mousePos, isLeft);
             m_isDragging = true;
             m_lastMousePos = mousePos;
         }
 
-        if (event->is<sf::Event::MouseButtonReleased>()) {
+        if (const auto* mouseReleased = event->getIf<sf::Event::MouseButtonReleased>()) {
+            sf::Vector2i mousePos = {mouseReleased->position.x, mouseReleased->position.y};
+            handleMouseRelease(mousePos, mouseReleased->button == sf::Mouse::Button::Left);
             m_isDragging = false;
+            endStroke();
         }
 
         if (const auto* mouseMoved = event->getIf<sf::Event::MouseMoved>()) {
@@ -171,7 +234,7 @@ void Editor::handleEvents() {
             // delta < 0 (아래로 스크롤) = 축소 (뷰 크기 증가)
             float zoomAmount = 1.f - mouseScrolled->delta * 0.05f;
             m_zoom *= zoomAmount;
-            m_zoom = std::max(0.25f, std::min(4.f, m_zoom));
+            m_zoom = std::max(MIN_ZOOM, std::min(getMaxZoom(), m_zoom));
             // 고정된 기본 뷰 크기를 기준으로 줌 적용
             m_mapView.setSize({m_defaultViewSize.x * m_zoom, m_defaultViewSize.y * m_zoom});
         }
@@ -181,6 +244,12 @@ void Editor::handleEvents() {
 void Editor::handleMouseClick(sf::Vector2i mousePos, bool isLeftButton) {
     sf::Vector2f mousePosF = {static_cast<float>(mousePos.x), static_cast<float>(mousePos.y)};
 
+    // 미니맵 클릭: 카메라 이동 (놓을 때까지 드래그로 계속 이동)
+    if (isLeftButton && moveCameraToMinimap(mousePos)) {
+        m_minimapDragging = true;
+        return;
+    }
+
     // 캔버스 영역 클릭
     if (m_canvasRect.contains(mousePosF)) {
         sf::Vector2i tilePos = screenToTile(mousePos);
@@ -191,24 +260,17 @@ void Editor::handleMouseClick(sf::Vector2i mousePos, bool isLeftButton) {
             if (isLeftButton) {
                 switch (m_currentTool) {
                     case EditorTool::Brush:
-                        setTile(tilePos.x, tilePos.y, m_currentTileType);
+                        paintBrush(tilePos.x, tilePos.y, m_currentTileType);
                         break;
                     case EditorTool::Eraser:
-                        setTile(tilePos.x, tilePos.y, TileType::Empty);
                         // 해당 위치의 스폰도 삭제
-                        if (m_playerSpawn == tilePos) {
-                            m_playerSpawn = {-1, -1};
-                        }
-                        m_enemySpawns.erase(
-                            std::remove(m_enemySpawns.begin(), m_enemySpawns.end(), tilePos),
-                            m_enemySpawns.end()
-                        );
+                        paintBrush(tilePos.x, tilePos.y, TileType::Empty);
                         break;
                     case EditorTool::PlayerSpawn:
                         m_playerSpawn = tilePos;
                         break;
                     case EditorTool::EnemySpawn:
-                        m_enemySpawns.push_back(tilePos);
+                        if (m_enemySpawns.add(tilePos)) m_history.recordEnemyAdded(tilePos);
                         break;
                     case EditorTool::CollisionShape:
                         // 충돌 형태 설정 (타일이 있는 경우에만)
@@ -216,19 +278,39 @@ void Editor::handleMouseClick(sf::Vector2i mousePos, bool isLeftButton) {
                             setTileShape(tilePos.x, tilePos.y, m_currentCollisionShape);
                         }
                         break;
+                    case EditorTool::Rect:
+                        // 놓을 때 채움
+                        m_dragStartTile = tilePos;
+                        m_dragStartLeft = true;
+                        break;
+                    case EditorTool::Fill:
+                        floodFill(tilePos.x, tilePos.y, defaultTile(m_currentTileType));
+                        break;
+                    case EditorTool::Stamp:
+                        if (!m_stamp.empty()) {
+                            pasteStamp(tilePos.x, tilePos.y);
+                        }
+                        break;
                 }
                 m_hasUnsavedChanges = true;
             } else {
-                // 우클릭: 지우기 (타일 + 스폰)
-                setTile(tilePos.x, tilePos.y, TileType::Empty);
-                if (m_playerSpawn == tilePos) {
-                    m_playerSpawn = {-1, -1};
+                switch (m_currentTool) {
+                    case EditorTool::Rect:
+                    case EditorTool::Stamp:
+                        // 우클릭 드래그: 사각형 지우기 / 스탬프 복사 영역 선택 (놓을 때 적용)
+                        m_dragStartTile = tilePos;
+                        m_dragStartLeft = false;
+                        break;
+                    case EditorTool::Fill:
+                        floodFill(tilePos.x, tilePos.y, EditorTile{});
+                        m_hasUnsavedChanges = true;
+                        break;
+                    default:
+                        // 우클릭: 지우기 (타일 + 스폰)
+                        paintBrush(tilePos.x, tilePos.y, TileType::Empty);
+                        m_hasUnsavedChanges = true;
+                        break;
                 }
-                m_enemySpawns.erase(
-                    std::remove(m_enemySpawns.begin(), m_enemySpawns.end(), tilePos),
-                    m_enemySpawns.end()
-                );
-                m_hasUnsavedChanges = true;
             }
         }
         return;
@@ -241,33 +323,17 @@ void Editor::handleMouseClick(sf::Vector2i mousePos, bool isLeftButton) {
 
         switch (buttonIndex) {
             case 0: newMap(); break;
-            case 1: {
-                // Save with file dialog
-                std::string defaultName = m_currentFilename.empty() ? "level.tilemap" : m_currentFilename;
-                // 경로에서 파일명만 추출
-                size_t lastSlash = defaultName.find_last_of('/');
-                if (lastSlash != std::string::npos) {
-                    defaultName = defaultName.substr(lastSlash + 1);
-                }
-                std::string path = openSaveFileDialog(defaultName);
-                if (!path.empty()) {
-                    saveMap(path);
-                }
-                break;
-            }
-            case 2: {
-                // Load with file dialog
-                std::string path = openLoadFileDialog();
-                if (!path.empty()) {
-                    loadMap(path);
-                }
-                break;
-            }
+            case 1: saveWithDialog(); break;
+            case 2: loadWithDialog(); break;
             case 3: m_currentTool = EditorTool::Brush; break;
             case 4: m_currentTool = EditorTool::Eraser; break;
             case 5: m_currentTool = EditorTool::PlayerSpawn; break;
             case 6: m_currentTool = EditorTool::EnemySpawn; break;
             case 7: m_currentTool = EditorTool::CollisionShape; break;
+            case 8: m_currentTool = EditorTool::Rect; break;
+            case 9: m_currentTool = EditorTool::Fill; break;
+            case 10: m_currentTool = EditorTool::Stamp; break;
+            case 11: exportWithDialog(); break;
         }
         return;
     }
@@ -318,6 +384,11 @@ void Editor::handleMouseClick(sf::Vector2i mousePos, bool isLeftButton) {
 void Editor::handleMouseDrag(sf::Vector2i mousePos, bool isLeftButton) {
     sf::Vector2f mousePosF = {static_cast<float>(mousePos.x), static_cast<float>(mousePos.y)};
 
+    if (m_minimapDragging) {
+        moveCameraToMinimap(mousePos);
+        return;
+    }
+
     // 캔버스에서 드래그: 타일 연속 배치 (선형 보간으로 스킵 방지)
     if (m_canvasRect.contains(mousePosF)) {
         sf::Vector2i currentTile = screenToTile(mousePos);
@@ -338,19 +409,11 @@ void Editor::handleMouseDrag(sf::Vector2i mousePos, bool isLeftButton) {
             if (x >= 0 && x < m_mapWidth && y >= 0 && y < m_mapHeight) {
                 if (isLeftButton) {
                     if (m_currentTool == EditorTool::Brush) {
-                        setTile(x, y, m_currentTileType);
+                        paintBrush(x, y, m_currentTileType);
                         m_hasUnsavedChanges = true;
                     } else if (m_currentTool == EditorTool::Eraser) {
-                        setTile(x, y, TileType::Empty);
                         // 스폰도 삭제
-                        sf::Vector2i tilePos = {x, y};
-                        if (m_playerSpawn == tilePos) {
-                            m_playerSpawn = {-1, -1};
-                        }
-                        m_enemySpawns.erase(
-                            std::remove(m_enemySpawns.begin(), m_enemySpawns.end(), tilePos),
-                            m_enemySpawns.end()
-                        );
+                        paintBrush(x, y, TileType::Empty);
                         m_hasUnsavedChanges = true;
                     } else if (m_currentTool == EditorTool::CollisionShape) {
                         // 충돌 형태 설정 (타일이 있는 경우에만)
@@ -359,17 +422,10 @@ void Editor::handleMouseDrag(sf::Vector2i mousePos, bool isLeftButton) {
                             m_hasUnsavedChanges = true;
                         }
                     }
-                } else {
+                } else if (m_currentTool != EditorTool::Rect && m_currentTool != EditorTool::Fill &&
+                           m_currentTool != EditorTool::Stamp) {
                     // 우클릭: 지우기
-                    setTile(x, y, TileType::Empty);
-                    sf::Vector2i tilePos = {x, y};
-                    if (m_playerSpawn == tilePos) {
-                        m_playerSpawn = {-1, -1};
-                    }
-                    m_enemySpawns.erase(
-                        std::remove(m_enemySpawns.begin(), m_enemySpawns.end(), tilePos),
-                        m_enemySpawns.end()
-                    );
+                    paintBrush(x, y, TileType::Empty);
                     m_hasUnsavedChanges = true;
                 }
             }
@@ -399,6 +455,26 @@ void Editor::handleMouseDrag(sf::Vector2i mousePos, bool isLeftButton) {
     }
 }
 
+void Editor::handleMouseRelease(sf::Vector2i mousePos, bool isLeftButton) {
+    if (isLeftButton) m_minimapDragging = false;
+    if (m_dragStartTile.x < 0 || isLeftButton != m_dragStartLeft) return;
+
+    sf::IntRect rect = getDragRect(screenToTile(mousePos));
+    m_dragStartTile = {-1, -1};
+    if (rect.size.x <= 0 || rect.size.y <= 0) return;
+
+    if (m_currentTool == EditorTool::Rect) {
+        if (isLeftButton) {
+            fillRect(rect, defaultTile(m_currentTileType));
+        } else {
+            fillRect(rect, EditorTile{});
+            eraseSpawnsIn(rect);
+        }
+    } else if (m_currentTool == EditorTool::Stamp && !isLeftButton) {
+        copyRegion(rect);
+    }
+}
+
 void Editor::handleKeyPress(sf::Keyboard::Key key) {
     switch (key) {
         case sf::Keyboard::Key::Num1:
@@ -416,88 +492,120 @@ void Editor::handleKeyPress(sf::Keyboard::Key key) {
         case sf::Keyboard::Key::Num5:
             m_currentTool = EditorTool::CollisionShape;
             break;
+        case sf::Keyboard::Key::Num6:
+            m_currentTool = EditorTool::Rect;
+            break;
+        case sf::Keyboard::Key::Num7:
+            m_currentTool = EditorTool::Fill;
+            break;
+        case sf::Keyboard::Key::Num8:
+            m_currentTool = EditorTool::Stamp;
+            break;
+        case sf::Keyboard::Key::LBracket:
+            m_brushSize = std::max(1, m_brushSize - 1);
+            break;
+        case sf::Keyboard::Key::RBracket:
+            m_brushSize = std::min(MAX_BRUSH_SIZE, m_brushSize + 1);
+            break;
         case sf::Keyboard::Key::C:
             // C 키: 충돌 오버레이 토글 (Ctrl/Cmd 없을 때)
-            if (!sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LControl) &&
-                !sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LSystem)) {
+            if (!isCommandDown()) {
                 m_showCollisionOverlay = !m_showCollisionOverlay;
             }
             break;
         case sf::Keyboard::Key::S:
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LControl) ||
-                sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LSystem)) {
-                // Ctrl/Cmd + S: Save with file dialog
-                std::string defaultName = m_currentFilename.empty() ? "level.tilemap" : m_currentFilename;
-                size_t lastSlash = defaultName.find_last_of('/');
-                if (lastSlash != std::string::npos) {
-                    defaultName = defaultName.substr(lastSlash + 1);
-                }
-                std::string path = openSaveFileDialog(defaultName);
-                if (!path.empty()) {
-                    saveMap(path);
-                }
+            if (isCommandDown()) {
+                // Ctrl/Cmd + S: 프로젝트 저장
+                saveWithDialog();
+            }
+            break;
+        case sf::Keyboard::Key::E:
+            if (isCommandDown()) {
+                // Ctrl/Cmd + E: 게임용 .tilemap 내보내기
+                exportWithDialog();
             }
             break;
         case sf::Keyboard::Key::O:
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LControl) ||
-                sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LSystem)) {
-                // Ctrl/Cmd + O: Load with file dialog
-                std::string path = openLoadFileDialog();
-                if (!path.empty()) {
-                    loadMap(path);
-                }
+            if (isCommandDown()) {
+                // Ctrl/Cmd + O: 프로젝트 또는 .tilemap 열기
+                loadWithDialog();
             }
             break;
         case sf::Keyboard::Key::N:
-            if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LControl) ||
-                sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LSystem)) {
+            if (isCommandDown()) {
                 newMap();
             }
             break;
+        case sf::Keyboard::Key::Z:
+            if (isCommandDown()) {
+                if (m_input.isDown(sf::Keyboard::Key::LShift) || m_input.isDown(sf::Keyboard::Key::RShift)) {
+                    redo();
+                } else {
+                    undo();
+                }
+            }
+            break;
+        case sf::Keyboard::Key::Y:
+            if (isCommandDown()) {
+                redo();
+            }
+            break;
         case sf::Keyboard::Key::Num0:
         case sf::Keyboard::Key::Home:
             // 줌 리셋 (100%로)
             m_zoom = 1.f;
             m_mapView.setSize(m_defaultViewSize);
             break;
+#ifdef GIVEITUP_PROFILER
+        case sf::Keyboard::Key::F3:
+            m_profilerOverlay.toggle();
+            break;
+        case sf::Keyboard::Key::F4:
+            if (Profiler::instance().writeChromeTrace("editor_trace.json")) {
+                LOG_INFO("Profiler trace written to editor_trace.json");
+            }
+            break;
+#endif
         default:
             break;
     }
 }
 
+bool Editor::isCommandDown() const {
+    return m_input.isDown(sf::Keyboard::Key::LControl) || m_input.isDown(sf::Keyboard::Key::LSystem);
+}
+
 void Editor::update(float deltaTime) {
     // 화살표 키 또는 WASD로 카메라 이동 (확대 시 스크롤)
     float scrollSpeed = 500.f * m_zoom;  // 줌 레벨에 따라 속도 조정
     sf::Vector2f movement = {0.f, 0.f};
 
     // 화살표 키
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left)) {
+    if (m_input.isDown(sf::Keyboard::Key::Left)) {
         movement.x -= scrollSpeed * deltaTime;
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right)) {
+    if (m_input.isDown(sf::Keyboard::Key::Right)) {
         movement.x += scrollSpeed * deltaTime;
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up)) {
+    if (m_input.isDown(sf::Keyboard::Key::Up)) {
         movement.y -= scrollSpeed * deltaTime;
     }
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down)) {
+    if (m_input.isDown(sf::Keyboard::Key::Down)) {
         movement.y += scrollSpeed * deltaTime;
     }
 
     // WASD 키 (Ctrl/Cmd가 눌려있지 않을 때만)
-    bool ctrlOrCmd = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LControl) ||
-                     sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LSystem);
-    if (!ctrlOrCmd) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A)) {
+    if (!isCommandDown()) {
+        if (m_input.isDown(sf::Keyboard::Key::A)) {
             movement.x -= scrollSpeed * deltaTime;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D)) {
+        if (m_input.isDown(sf::Keyboard::Key::D)) {
             movement.x += scrollSpeed * deltaTime;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W)) {
+        if (m_input.isDown(sf::Keyboard::Key::W)) {
             movement.y -= scrollSpeed * deltaTime;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S)) {
+        if (m_input.isDown(sf::Keyboard::Key::S)) {
             movement.y += scrollSpeed * deltaTime;
         }
     }
@@ -516,13 +624,44 @@ void Editor::update(float deltaTime) {
 
         m_mapView.setCenter(m_cameraPos);
     }
+
+    // 프로젝트를 연 뒤 남은 청크 읽기
+    streamPendingChunks(sf::milliseconds(static_cast<int>(CHUNK_STREAM_BUDGET_MS)));
+
+    pollSave();
+    updateAutosave();
+}
+
+void Editor::setCamera(sf::Vector2f center, float zoom) {
+    m_cameraPos = center;
+    m_zoom = std::max(MIN_ZOOM, std::min(getMaxZoom(), zoom));
+    m_mapView.setCenter(m_cameraPos);
+    m_mapView.setSize({m_defaultViewSize.x * m_zoom, m_defaultViewSize.y * m_zoom});
+}
+
+float Editor::getMaxZoom() const {
+    // 맵 전체가 화면에 들어올 때까지 (작은 맵은 기존처럼 4배)
+    float fitX = static_cast<float>(m_mapWidth * m_gridSize) / m_defaultViewSize.x;
+    float fitY = static_cast<float>(m_mapHeight * m_gridSize) / m_defaultViewSize.y;
+    return std::max(4.f, std::max(fitX, fitY) * MAX_ZOOM_MARGIN);
+}
+
+bool Editor::isLodActive() const {
+    return static_cast<float>(m_gridSize) / m_zoom < LOD_MAX_TILE_PIXELS;
+}
+
+void Editor::beginMapRender() {
+    RenderStats::setView(m_target, m_mapView);
 }
 
 void Editor::render() {
-    m_window.clear(sf::Color{40, 40, 40});
+    PROFILE_SCOPE("Render");
+    RenderStats& renderStats = RenderStats::current();
+    renderStats.beginFrame();
+    m_target.clear(sf::Color{40, 40, 40});
 
     // 맵 캔버스 렌더링
-    m_window.setView(m_mapView);
+    RenderStats::setView(m_target, m_mapView);
 
     // 타일맵 범위 배경 (편집 가능 영역 표시)
     sf::RectangleShape mapBounds;
@@ -532,15 +671,33 @@ void Editor::render() {
     mapBounds.setFillColor(sf::Color{50, 50, 55});
     mapBounds.setOutlineThickness(3.f);
     mapBounds.setOutlineColor(sf::Color{100, 150, 200});
-    m_window.draw(mapBounds);
+    RenderStats::draw(m_target, mapBounds);
 
-    renderGrid();
-    renderTiles();
-    renderSpawns();
+    {
+        PROFILE_SCOPE("Render Map");
+        {
+            RenderStats::Tag tag("Grid");
+            renderGrid();
+        }
+        {
+            RenderStats::Tag tag("Tiles");
+            renderTiles();
+        }
+        {
+            RenderStats::Tag tag("Spawns");
+            renderSpawns();
+            renderSelection();
+        }
+    }
 
     // UI 렌더링
-    m_window.setView(m_uiView);
-    renderUI();
+    RenderStats::setView(m_target, m_uiView);
+    {
+        PROFILE_SCOPE("Render UI");
+        RenderStats::Tag tag("UI");
+        renderUI();
+        renderMinimap();
+    }
 
     // 캔버스 영역 테두리 (화면 좌표)
     sf::RectangleShape canvasBorder;
@@ -549,219 +706,444 @@ void Editor::render() {
     canvasBorder.setFillColor(sf::Color::Transparent);
     canvasBorder.setOutlineThickness(2.f);
     canvasBorder.setOutlineColor(sf::Color{80, 80, 80});
-    m_window.draw(canvasBorder);
+    RenderStats::draw(m_target, canvasBorder);
 
-    m_window.display();
+    // 오버레이 자신은 통계에 넣지 않음
+    m_profilerOverlay.setRenderStats(renderStats.endFrame());
+    m_profilerOverlay.update();
+    m_target.draw(m_profilerOverlay);
+
+    {
+        PROFILE_SCOPE("Display");
+        m_window.display();
+    }
 }
 
 void Editor::renderGrid() {
-    sf::RectangleShape line;
-    line.setFillColor(sf::Color{60, 60, 60});
+    // 보이는 범위/줌/맵 크기가 바뀐 경우에만 정점을 다시 만들고 한 번에 그림
+    sf::IntRect visible = getVisibleTileRect();
+    int x0 = std::clamp(visible.position.x, 0, m_mapWidth);
+    int y0 = std::clamp(visible.position.y, 0, m_mapHeight);
+    int x1 = std::clamp(visible.position.x + visible.size.x, 0, m_mapWidth);
+    int y1 = std::clamp(visible.position.y + visible.size.y, 0, m_mapHeight);
+
+    const GridCache& cache = m_gridCache;
+    bool cacheValid = cache.zoom == m_zoom && cache.gridSize == m_gridSize &&
+                      cache.mapSize == sf::Vector2i{m_mapWidth, m_mapHeight} &&
+                      cache.x0 <= x0 && cache.y0 <= y0 && x1 <= cache.x1 && y1 <= cache.y1;
+    if (!cacheValid) {
+        rebuildGrid(x0, y0, x1, y1);
+    }
+    RenderStats::draw(m_target, m_gridVertices);
+}
+
+void Editor::rebuildGrid(int visibleX0, int visibleY0, int visibleX1, int visibleY1) {
+    m_gridVertices.clear();
+
+    // LOD: 화면에서 선 간격이 GRID_MIN_SPACING 픽셀 이상이 되도록 2의 거듭제곱 칸마다 선을 그림
+    // 그 단계의 선은 간격이 좁을수록 흐려지고, 한 단계 위(2배 간격)의 선은 그대로 보임
+    float pixelsPerTile = static_cast<float>(m_gridSize) / m_zoom;
+    int step = 1;
+    while (pixelsPerTile * step < GRID_MIN_SPACING) {
+        step *= 2;
+    }
+    float fade = std::min(1.f, (pixelsPerTile * step - GRID_MIN_SPACING) / GRID_MIN_SPACING);
+
+    // 작은 이동마다 다시 만들지 않도록 범위를 넓혀서 캐시 (선 간격의 배수로 정렬)
+    int align = step * GRID_CACHE_ALIGN;
+    int x0 = std::max(0, (visibleX0 / align - 1) * align);
+    int y0 = std::max(0, (visibleY0 / align - 1) * align);
+    int x1 = std::min(m_mapWidth, (visibleX1 / align + 2) * align);
+    int y1 = std::min(m_mapHeight, (visibleY1 / align + 2) * align);
+
+    m_gridCache.x0 = x0;
+    m_gridCache.y0 = y0;
+    m_gridCache.x1 = x1;
+    m_gridCache.y1 = y1;
+    m_gridCache.zoom = m_zoom;
+    m_gridCache.gridSize = m_gridSize;
+    m_gridCache.mapSize = {m_mapWidth, m_mapHeight};
+    if (x0 >= x1 || y0 >= y1) return;
 
     // 줌에 따라 선 두께 조정 (축소시 더 두꺼운 선)
     float lineThickness = std::max(1.f, m_zoom * 1.5f);
+    float tile = static_cast<float>(m_gridSize);
+    const sf::Color lineColor{60, 60, 60};
+
+    auto appendRect = [&](float left, float top, float width, float height, sf::Color color) {
+        sf::Vector2f a{left, top}, b{left + width, top}, c{left + width, top + height}, d{left, top + height};
+        for (sf::Vector2f corner : {a, b, c, a, c, d}) {
+            m_gridVertices.append(sf::Vertex{corner, color});
+        }
+    };
+    auto colorFor = [&](int index) {
+        sf::Color color = lineColor;
+        if (index % (step * 2) != 0) {
+            color.a = static_cast<std::uint8_t>(lineColor.a * fade);
+        }
+        return color;
+    };
 
     // 세로선
-    for (int x = 0; x <= m_mapWidth; ++x) {
-        line.setSize({lineThickness, static_cast<float>(m_mapHeight * m_gridSize)});
-        line.setPosition({static_cast<float>(x * m_gridSize), 0.f});
-        m_window.draw(line);
+    for (int x = x0; x <= x1; x += step) {
+        sf::Color color = colorFor(x);
+        if (color.a == 0) continue;
+        appendRect(x * tile, y0 * tile, lineThickness, (y1 - y0) * tile, color);
     }
 
     // 가로선
-    for (int y = 0; y <= m_mapHeight; ++y) {
-        line.setSize({static_cast<float>(m_mapWidth * m_gridSize), lineThickness});
-        line.setPosition({0.f, static_cast<float>(y * m_gridSize)});
-        m_window.draw(line);
+    for (int y = y0; y <= y1; y += step) {
+        sf::Color color = colorFor(y);
+        if (color.a == 0) continue;
+        appendRect(x0 * tile, y * tile, (x1 - x0) * tile, lineThickness, color);
     }
 }
 
 void Editor::renderTiles() {
-    sf::RectangleShape tileShape;
-    tileShape.setSize({static_cast<float>(m_gridSize - 1), static_cast<float>(m_gridSize - 1)});
-
-    // 모든 보이는 레이어의 타일 렌더링
-    for (const auto& layer : m_layers) {
-        if (!layer.visible) continue;
-
-        for (int y = 0; y < m_mapHeight && y < static_cast<int>(layer.tiles.size()); ++y) {
-            for (int x = 0; x < m_mapWidth && x < static_cast<int>(layer.tiles[y].size()); ++x) {
-                const EditorTile& tile = layer.tiles[y][x];
-                if (tile.type == TileType::Empty) continue;
+    // 셰이더를 쓸 수 있으면 레이어마다 인덱스 텍스처로 보이는 영역을 한 번에 그림
+    // 많이 축소하면 같은 페이지를 타입별 색만으로 칠하고 충돌 오버레이는 생략
+    if (!m_layers.empty() && m_layers.front().renderer.canRender()) {
+        bool lod = isLodActive();
+        for (auto& layer : m_layers) {
+            if (!layer.visible) continue;
+            layer.renderer.setTileSize(static_cast<float>(m_gridSize));
+            layer.renderer.setLod(lod);
+            layer.bindRendererSource();
+            RenderStats::draw(m_target, layer.renderer);
+        }
 
-                tileShape.setPosition({static_cast<float>(x * m_gridSize + 1), static_cast<float>(y * m_gridSize + 1)});
+        if (m_showCollisionOverlay && !lod) {
+            renderCollisionOverlay();
+        }
+        return;
+    }
 
-                switch (tile.type) {
-                    case TileType::Solid:
-                        tileShape.setFillColor(sf::Color{80, 60, 40});
-                        break;
-                    case TileType::Platform:
-                        tileShape.setFillColor(sf::Color{60, 100, 60});
-                        break;
-                    default:
-                        continue;
-                }
+    // 셰이더를 못 쓰면 청크별로 캐시된 사각형 정점을 그림 (바뀐 청크만 다시 만듦)
+    for (auto& layer : m_layers) {
+        if (!layer.visible) continue;
 
-                m_window.draw(tileShape);
+        forEachVisibleChunk(layer, [&](int chunkX, int chunkY) {
+            EditorChunkMesh& mesh = layer.meshAt(chunkX, chunkY);
+            if (mesh.tilesDirty) {
+                rebuildTileMesh(layer, chunkX, chunkY);
             }
-        }
+            if (mesh.tiles.getVertexCount() > 0) {
+                RenderStats::draw(m_target, mesh.tiles);
+            }
+        });
     }
 
-    // 충돌 오버레이 렌더링
-    if (m_showCollisionOverlay) {
+    // 충돌 오버레이 렌더링 (많이 축소했으면 생략)
+    if (m_showCollisionOverlay && !isLodActive()) {
         renderCollisionOverlay();
     }
 }
 
 void Editor::renderSpawns() {
-    // 플레이어 스폰
-    if (m_playerSpawn.x >= 0 && m_playerSpawn.y >= 0) {
-        sf::CircleShape marker(m_gridSize / 3.f);
-        marker.setFillColor(sf::Color{100, 200, 100});
-        marker.setPosition({
-            static_cast<float>(m_playerSpawn.x * m_gridSize + m_gridSize / 6.f),
-            static_cast<float>(m_playerSpawn.y * m_gridSize + m_gridSize / 6.f)
-        });
-        m_window.draw(marker);
+    // 보이는 범위 주변의 스폰만 정점 두 묶음(마커, 글자)으로 만들어 두고 스폰/범위/줌이 바뀔 때만 다시 만듦
+    sf::IntRect visible = getVisibleTileRect();
+    const SpawnCache& cache = m_spawnCache;
+    bool cacheValid = cache.revision == m_enemySpawns.getRevision() && cache.playerSpawn == m_playerSpawn &&
+                      cache.zoom == m_zoom && cache.gridSize == m_gridSize &&
+                      cache.area.position.x <= visible.position.x && cache.area.position.y <= visible.position.y &&
+                      visible.position.x + visible.size.x <= cache.area.position.x + cache.area.size.x &&
+                      visible.position.y + visible.size.y <= cache.area.position.y + cache.area.size.y;
+    if (!cacheValid) {
+        rebuildSpawnMesh(visible);
+    }
 
-        sf::Text text(m_font, "P", 16);
-        text.setFillColor(sf::Color::White);
-        text.setPosition({
-            static_cast<float>(m_playerSpawn.x * m_gridSize + m_gridSize / 3.f),
-            static_cast<float>(m_playerSpawn.y * m_gridSize + m_gridSize / 6.f)
-        });
-        m_window.draw(text);
+    RenderStats::draw(m_target, m_spawnMarkers);
+    if (m_spawnLabels.getVertexCount() > 0) {
+        sf::RenderStates states;
+        states.texture = &m_font.getTexture(SPAWN_LABEL_SIZE);
+        RenderStats::draw(m_target, m_spawnLabels, states);
     }
+}
 
-    // 적 스폰
-    for (const auto& spawn : m_enemySpawns) {
-        sf::CircleShape marker(m_gridSize / 3.f);
-        marker.setFillColor(sf::Color{200, 100, 100});
-        marker.setPosition({
-            static_cast<float>(spawn.x * m_gridSize + m_gridSize / 6.f),
-            static_cast<float>(spawn.y * m_gridSize + m_gridSize / 6.f)
-        });
-        m_window.draw(marker);
+void Editor::renderSelection() {
+    if (m_dragStartTile.x < 0) return;
+
+    sf::IntRect rect = getDragRect(screenToTile(m_currentMousePos));
+    if (rect.size.x <= 0 || rect.size.y <= 0) return;
+
+    sf::RectangleShape selection;
+    selection.setPosition({static_cast<float>(rect.position.x * m_gridSize), static_cast<float>(rect.position.y * m_gridSize)});
+    selection.setSize({static_cast<float>(rect.size.x * m_gridSize), static_cast<float>(rect.size.y * m_gridSize)});
+    // 채우기 = 초록, 지우기/복사 = 주황
+    sf::Color color = m_dragStartLeft ? sf::Color{100, 220, 100} : sf::Color{240, 160, 60};
+    selection.setFillColor(sf::Color{color.r, color.g, color.b, 40});
+    selection.setOutlineThickness(2.f * m_zoom);
+    selection.setOutlineColor(color);
+    RenderStats::draw(m_target, selection);
+}
 
-        sf::Text text(m_font, "E", 16);
-        text.setFillColor(sf::Color::White);
-        text.setPosition({
-            static_cast<float>(spawn.x * m_gridSize + m_gridSize / 3.f),
-            static_cast<float>(spawn.y * m_gridSize + m_gridSize / 6.f)
-        });
-        m_window.draw(text);
+void Editor::renderMinimap() {
+    sf::Vector2u mapSize = {static_cast<unsigned int>(m_mapWidth), static_cast<unsigned int>(m_mapHeight)};
+    if (m_minimap.getMapSize() != mapSize) {
+        m_minimap.resize(mapSize.x, mapSize.y);
     }
-}
 
-void Editor::renderCollisionOverlay() {
-    // 충돌 형태별 색상 (반투명)
-    auto getShapeColor = [](CollisionShape shape) -> sf::Color {
-        switch (shape) {
-            case CollisionShape::None:     return sf::Color::Transparent;
-            case CollisionShape::Full:     return sf::Color{255, 0, 0, 80};      // 빨강
-            case CollisionShape::SlopeLeftUp:  return sf::Color{0, 255, 255, 100};  // 시안
-            case CollisionShape::SlopeRightUp: return sf::Color{255, 255, 0, 100};  // 노랑
-            case CollisionShape::HalfTop:      return sf::Color{255, 128, 0, 80};   // 주황
-            case CollisionShape::HalfBottom:   return sf::Color{128, 0, 255, 80};   // 보라
-            case CollisionShape::HalfLeft:     return sf::Color{0, 128, 255, 80};   // 파랑
-            case CollisionShape::HalfRight:    return sf::Color{255, 0, 128, 80};   // 분홍
-            case CollisionShape::Platform:     return sf::Color{0, 255, 0, 100};    // 초록
-            default: return sf::Color::Transparent;
+    // 스폰이 바뀌었을 때만 마커를 다시 만듦
+    if (m_minimapSpawnRevision != m_enemySpawns.getRevision() || m_minimapPlayerSpawn != m_playerSpawn) {
+        std::vector<Minimap::Marker> markers;
+        markers.reserve(m_enemySpawns.positions().size() + 1);
+        for (sf::Vector2i spawn : m_enemySpawns.positions()) {
+            markers.push_back({{spawn.x + 0.5f, spawn.y + 0.5f}, sf::Color{255, 110, 110}});
         }
-    };
+        if (m_playerSpawn.x >= 0 && m_playerSpawn.y >= 0) {
+            markers.push_back({{m_playerSpawn.x + 0.5f, m_playerSpawn.y + 0.5f}, sf::Color{120, 255, 120}});
+        }
+        m_minimap.setMarkers(std::move(markers));
+        m_minimapSpawnRevision = m_enemySpawns.getRevision();
+        m_minimapPlayerSpawn = m_playerSpawn;
+    }
 
-    float size = static_cast<float>(m_gridSize);
+    float gridSize = static_cast<float>(m_gridSize);
+    Minimap::Overlay overlay;
+    overlay.frustum = {(m_mapView.getCenter() - m_mapView.getSize() / 2.f) / gridSize, m_mapView.getSize() / gridSize};
+    m_minimap.draw(m_target, overlay);
+}
 
+Minimap::Occupancy Editor::countMinimapBlock(const sf::IntRect& rect) const {
+    // 빈 청크는 건너뛰고 할당된 청크의 겹치는 칸만 셈
+    using Grid = EditorLayer::Grid;
+    Minimap::Occupancy occupancy;
+    int x1 = rect.position.x + rect.size.x;
+    int y1 = rect.position.y + rect.size.y;
     for (const auto& layer : m_layers) {
         if (!layer.visible) continue;
-
-        for (int y = 0; y < m_mapHeight && y < static_cast<int>(layer.tiles.size()); ++y) {
-            for (int x = 0; x < m_mapWidth && x < static_cast<int>(layer.tiles[y].size()); ++x) {
-                const EditorTile& tile = layer.tiles[y][x];
-                if (tile.type == TileType::Empty || tile.shape == CollisionShape::None) continue;
-
-                float px = static_cast<float>(x * m_gridSize);
-                float py = static_cast<float>(y * m_gridSize);
-                sf::Color color = getShapeColor(tile.shape);
-
-                switch (tile.shape) {
-                    case CollisionShape::Full: {
-                        sf::RectangleShape rect;
-                        rect.setPosition({px, py});
-                        rect.setSize({size, size});
-                        rect.setFillColor(color);
-                        m_window.draw(rect);
-                        break;
+        for (int cy = rect.position.y >> Grid::CHUNK_SHIFT; cy <= (y1 - 1) >> Grid::CHUNK_SHIFT; ++cy) {
+            for (int cx = rect.position.x >> Grid::CHUNK_SHIFT; cx <= (x1 - 1) >> Grid::CHUNK_SHIFT; ++cx) {
+                const Grid::Chunk* chunk = layer.tiles.getChunk(cx, cy);
+                if (!chunk) continue;
+                int lx0 = std::max(rect.position.x - (cx << Grid::CHUNK_SHIFT), 0);
+                int ly0 = std::max(rect.position.y - (cy << Grid::CHUNK_SHIFT), 0);
+                int lx1 = std::min(x1 - (cx << Grid::CHUNK_SHIFT), Grid::CHUNK_SIZE);
+                int ly1 = std::min(y1 - (cy << Grid::CHUNK_SHIFT), Grid::CHUNK_SIZE);
+                for (int ly = ly0; ly < ly1; ++ly) {
+                    for (int lx = lx0; lx < lx1; ++lx) {
+                        TileType type = chunk->at(lx, ly).type;
+                        occupancy.solid += type == TileType::Solid;
+                        occupancy.platform += type == TileType::Platform;
                     }
-                    case CollisionShape::SlopeLeftUp: {
-                        // 왼쪽 아래 → 오른쪽 위 (/)
-                        sf::ConvexShape triangle;
-                        triangle.setPointCount(3);
-                        triangle.setPoint(0, {px, py + size});          // 왼쪽 아래
-                        triangle.setPoint(1, {px + size, py});          // 오른쪽 위
-                        triangle.setPoint(2, {px + size, py + size});   // 오른쪽 아래
-                        triangle.setFillColor(color);
-                        m_window.draw(triangle);
-                        break;
-                    }
-                    case CollisionShape::SlopeRightUp: {
-                        // 오른쪽 아래 → 왼쪽 위 (\)
-                        sf::ConvexShape triangle;
-                        triangle.setPointCount(3);
-                        triangle.setPoint(0, {px, py});                 // 왼쪽 위
-                        triangle.setPoint(1, {px + size, py + size});   // 오른쪽 아래
-                        triangle.setPoint(2, {px, py + size});          // 왼쪽 아래
-                        triangle.setFillColor(color);
-                        m_window.draw(triangle);
-                        break;
-                    }
-                    case CollisionShape::HalfTop: {
-                        sf::RectangleShape rect;
-                        rect.setPosition({px, py});
-                        rect.setSize({size, size / 2.f});
-                        rect.setFillColor(color);
-                        m_window.draw(rect);
-                        break;
-                    }
-                    case CollisionShape::HalfBottom: {
-                        sf::RectangleShape rect;
-                        rect.setPosition({px, py + size / 2.f});
-                        rect.setSize({size, size / 2.f});
-                        rect.setFillColor(color);
-                        m_window.draw(rect);
-                        break;
-                    }
-                    case CollisionShape::HalfLeft: {
-                        sf::RectangleShape rect;
-                        rect.setPosition({px, py});
-                        rect.setSize({size / 2.f, size});
-                        rect.setFillColor(color);
-                        m_window.draw(rect);
-                        break;
-                    }
-                    case CollisionShape::HalfRight: {
-                        sf::RectangleShape rect;
-                        rect.setPosition({px + size / 2.f, py});
-                        rect.setSize({size / 2.f, size});
-                        rect.setFillColor(color);
-                        m_window.draw(rect);
-                        break;
-                    }
-                    case CollisionShape::Platform: {
-                        // 상단에 얇은 선으로 표시
-                        sf::RectangleShape rect;
-                        rect.setPosition({px, py});
-                        rect.setSize({size, size / 4.f});
-                        rect.setFillColor(color);
-                        m_window.draw(rect);
-                        break;
-                    }
-                    default:
-                        break;
                 }
             }
         }
     }
+    return occupancy;
+}
+
+bool Editor::moveCameraToMinimap(sf::Vector2i mousePos) {
+    std::optional<sf::Vector2f> tile = m_minimap.mapToTile({static_cast<float>(mousePos.x), static_cast<float>(mousePos.y)});
+    if (!tile) return false;
+    m_cameraPos = *tile * static_cast<float>(m_gridSize);
+    m_mapView.setCenter(m_cameraPos);
+    return true;
+}
+
+void Editor::renderCollisionOverlay() {
+    for (auto& layer : m_layers) {
+        if (!layer.visible) continue;
+
+        forEachVisibleChunk(layer, [&](int chunkX, int chunkY) {
+            EditorChunkMesh& mesh = layer.meshAt(chunkX, chunkY);
+            if (mesh.overlayDirty) {
+                rebuildOverlayMesh(layer, chunkX, chunkY);
+            }
+            if (mesh.overlay.getVertexCount() > 0) {
+                RenderStats::draw(m_target, mesh.overlay);
+            }
+        });
+    }
+}
+
+void Editor::forEachVisibleChunk(EditorLayer& layer, const std::function<void(int, int)>& f) {
+    sf::IntRect visible = getVisibleTileRect();
+    int x0 = std::max(0, visible.position.x);
+    int y0 = std::max(0, visible.position.y);
+    int x1 = std::min(layer.tiles.getWidth(), visible.position.x + visible.size.x);
+    int y1 = std::min(layer.tiles.getHeight(), visible.position.y + visible.size.y);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    for (int cy = y0 >> EditorLayer::Grid::CHUNK_SHIFT; cy <= (y1 - 1) >> EditorLayer::Grid::CHUNK_SHIFT; ++cy) {
+        for (int cx = x0 >> EditorLayer::Grid::CHUNK_SHIFT; cx <= (x1 - 1) >> EditorLayer::Grid::CHUNK_SHIFT; ++cx) {
+            if (layer.tiles.getChunk(cx, cy)) {
+                f(cx, cy);
+            }
+        }
+    }
+}
+
+namespace {
+void appendTriangle(sf::VertexArray& vertices, sf::Vector2f a, sf::Vector2f b, sf::Vector2f c, sf::Color color) {
+    vertices.append(sf::Vertex{a, color});
+    vertices.append(sf::Vertex{b, color});
+    vertices.append(sf::Vertex{c, color});
+}
+
+void appendRect(sf::VertexArray& vertices, sf::Vector2f position, sf::Vector2f size, sf::Color color) {
+    sf::Vector2f topRight = position + sf::Vector2f{size.x, 0.f};
+    sf::Vector2f bottomLeft = position + sf::Vector2f{0.f, size.y};
+    appendTriangle(vertices, position, topRight, position + size, color);
+    appendTriangle(vertices, position, position + size, bottomLeft, color);
+}
+
+// 충돌 형태별 색상 (반투명)
+sf::Color collisionShapeColor(CollisionShape shape) {
+    switch (shape) {
+        case CollisionShape::None:     return sf::Color::Transparent;
+        case CollisionShape::Full:     return sf::Color{255, 0, 0, 80};      // 빨강
+        case CollisionShape::SlopeLeftUp:  return sf::Color{0, 255, 255, 100};  // 시안
+        case CollisionShape::SlopeRightUp: return sf::Color{255, 255, 0, 100};  // 노랑
+        case CollisionShape::HalfTop:      return sf::Color{255, 128, 0, 80};   // 주황
+        case CollisionShape::HalfBottom:   return sf::Color{128, 0, 255, 80};   // 보라
+        case CollisionShape::HalfLeft:     return sf::Color{0, 128, 255, 80};   // 파랑
+        case CollisionShape::HalfRight:    return sf::Color{255, 0, 128, 80};   // 분홍
+        case CollisionShape::Platform:     return sf::Color{0, 255, 0, 100};    // 초록
+        default: return sf::Color::Transparent;
+    }
+}
+}
+
+void Editor::rebuildSpawnMesh(const sf::IntRect& visible) {
+    m_spawnMarkers.clear();
+    m_spawnLabels.clear();
+
+    // 작은 스크롤마다 다시 만들지 않도록 범위를 넓혀서 캐시
+    int x0 = (visible.position.x / SPAWN_CACHE_ALIGN - 1) * SPAWN_CACHE_ALIGN;
+    int y0 = (visible.position.y / SPAWN_CACHE_ALIGN - 1) * SPAWN_CACHE_ALIGN;
+    int x1 = ((visible.position.x + visible.size.x) / SPAWN_CACHE_ALIGN + 2) * SPAWN_CACHE_ALIGN;
+    int y1 = ((visible.position.y + visible.size.y) / SPAWN_CACHE_ALIGN + 2) * SPAWN_CACHE_ALIGN;
+    sf::IntRect area = {{x0, y0}, {x1 - x0, y1 - y0}};
+
+    m_spawnCache.area = area;
+    m_spawnCache.revision = m_enemySpawns.getRevision();
+    m_spawnCache.playerSpawn = m_playerSpawn;
+    m_spawnCache.zoom = m_zoom;
+    m_spawnCache.gridSize = m_gridSize;
+
+    // 화면에서 마커가 작으면 글자 없이 사각형만
+    float tile = static_cast<float>(m_gridSize);
+    bool detailed = tile / m_zoom >= SPAWN_DETAIL_MIN_PIXELS;
+    float radius = tile / 3.f;
+
+    auto appendSpawn = [&](sf::Vector2i spawn, sf::Color color, char32_t label) {
+        sf::Vector2f center = {spawn.x * tile + tile / 2.f, spawn.y * tile + tile / 2.f};
+        if (!detailed) {
+            appendRect(m_spawnMarkers, center - sf::Vector2f{radius, radius}, {radius * 2.f, radius * 2.f}, color);
+            return;
+        }
+
+        // 원 (삼각형 부채꼴)
+        constexpr int SEGMENTS = 16;
+        sf::Vector2f previous = center + sf::Vector2f{radius, 0.f};
+        for (int i = 1; i <= SEGMENTS; ++i) {
+            float angle = 2.f * 3.14159265f * static_cast<float>(i) / SEGMENTS;
+            sf::Vector2f next = center + sf::Vector2f{std::cos(angle) * radius, std::sin(angle) * radius};
+            appendTriangle(m_spawnMarkers, center, previous, next, color);
+            previous = next;
+        }
+
+        // 글자 (폰트 텍스처의 글리프 사각형, 기존 sf::Text와 같은 위치)
+        const sf::Glyph& glyph = m_font.getGlyph(label, SPAWN_LABEL_SIZE, false);
+        sf::Vector2f origin = {spawn.x * tile + tile / 3.f, spawn.y * tile + tile / 6.f + SPAWN_LABEL_SIZE};
+        sf::Vector2f topLeft = origin + glyph.bounds.position;
+        sf::Vector2f size = glyph.bounds.size;
+        sf::Vector2f uv = sf::Vector2f(glyph.textureRect.position);
+        sf::Vector2f uvSize = sf::Vector2f(glyph.textureRect.size);
+        sf::Vertex corners[4] = {
+            {topLeft, sf::Color::White, uv},
+            {topLeft + sf::Vector2f{size.x, 0.f}, sf::Color::White, uv + sf::Vector2f{uvSize.x, 0.f}},
+            {topLeft + size, sf::Color::White, uv + uvSize},
+            {topLeft + sf::Vector2f{0.f, size.y}, sf::Color::White, uv + sf::Vector2f{0.f, uvSize.y}}
+        };
+        for (int index : {0, 1, 2, 0, 2, 3}) {
+            m_spawnLabels.append(corners[index]);
+        }
+    };
+
+    if (m_playerSpawn.x >= 0 && m_playerSpawn.y >= 0 && area.contains(m_playerSpawn)) {
+        appendSpawn(m_playerSpawn, sf::Color{100, 200, 100}, U'P');
+    }
+    m_enemySpawns.forEachIn(area, [&](sf::Vector2i spawn) {
+        appendSpawn(spawn, sf::Color{200, 100, 100}, U'E');
+    });
+}
+
+void Editor::rebuildTileMesh(EditorLayer& layer, int chunkX, int chunkY) {
+    EditorChunkMesh& mesh = layer.meshAt(chunkX, chunkY);
+    mesh.tiles.clear();
+    mesh.tilesDirty = false;
+
+    int x0 = chunkX << EditorLayer::Grid::CHUNK_SHIFT;
+    int y0 = chunkY << EditorLayer::Grid::CHUNK_SHIFT;
+    float cellSize = static_cast<float>(m_gridSize - 1);
+    layer.tiles.forEachCell(x0, y0, x0 + EditorLayer::Grid::CHUNK_SIZE, y0 + EditorLayer::Grid::CHUNK_SIZE,
+                            [&](int x, int y, const EditorTile& tile) {
+        sf::Color color;
+        switch (tile.type) {
+            case TileType::Solid:
+                color = sf::Color{80, 60, 40};
+                break;
+            case TileType::Platform:
+                color = sf::Color{60, 100, 60};
+                break;
+            default:
+                return;
+        }
+        sf::Vector2f position{static_cast<float>(x * m_gridSize + 1), static_cast<float>(y * m_gridSize + 1)};
+        appendRect(mesh.tiles, position, {cellSize, cellSize}, color);
+    });
+}
+
+void Editor::rebuildOverlayMesh(EditorLayer& layer, int chunkX, int chunkY) {
+    EditorChunkMesh& mesh = layer.meshAt(chunkX, chunkY);
+    mesh.overlay.clear();
+    mesh.overlayDirty = false;
+
+    int x0 = chunkX << EditorLayer::Grid::CHUNK_SHIFT;
+    int y0 = chunkY << EditorLayer::Grid::CHUNK_SHIFT;
+    float size = static_cast<float>(m_gridSize);
+    layer.tiles.forEachCell(x0, y0, x0 + EditorLayer::Grid::CHUNK_SIZE, y0 + EditorLayer::Grid::CHUNK_SIZE,
+                            [&](int x, int y, const EditorTile& tile) {
+        if (tile.type == TileType::Empty || tile.shape == CollisionShape::None) return;
+
+        float px = static_cast<float>(x * m_gridSize);
+        float py = static_cast<float>(y * m_gridSize);
+        sf::Color color = collisionShapeColor(tile.shape);
+
+        switch (tile.shape) {
+            case CollisionShape::Full:
+                appendRect(mesh.overlay, {px, py}, {size, size}, color);
+                break;
+            case CollisionShape::SlopeLeftUp:
+                // 왼쪽 아래 → 오른쪽 위 (/)
+                appendTriangle(mesh.overlay, {px, py + size}, {px + size, py}, {px + size, py + size}, color);
+                break;
+            case CollisionShape::SlopeRightUp:
+                // 오른쪽 아래 → 왼쪽 위 (\)
+                appendTriangle(mesh.overlay, {px, py}, {px + size, py + size}, {px, py + size}, color);
+                break;
+            case CollisionShape::HalfTop:
+                appendRect(mesh.overlay, {px, py}, {size, size / 2.f}, color);
+                break;
+            case CollisionShape::HalfBottom:
+                appendRect(mesh.overlay, {px, py + size / 2.f}, {size, size / 2.f}, color);
+                break;
+            case CollisionShape::HalfLeft:
+                appendRect(mesh.overlay, {px, py}, {size / 2.f, size}, color);
+                break;
+            case CollisionShape::HalfRight:
+                appendRect(mesh.overlay, {px + size / 2.f, py}, {size / 2.f, size}, color);
+                break;
+            case CollisionShape::Platform:
+                // 상단에 얇은 선으로 표시
+                appendRect(mesh.overlay, {px, py}, {size, size / 4.f}, color);
+                break;
+            default:
+                break;
+        }
+    });
 }
 
 void Editor::renderUI() {
@@ -778,10 +1160,11 @@ void Editor::renderToolbar() {
     bg.setPosition(m_toolbarRect.position);
     bg.setSize(m_toolbarRect.size);
     bg.setFillColor(sf::Color{50, 50, 50});
-    m_window.draw(bg);
+    RenderStats::draw(m_target, bg);
 
     // 버튼들
-    std::vector<std::string> buttons = {"New", "Save", "Load", "Brush", "Eraser", "Player", "Enemy", "Collide"};
+    std::vector<std::string> buttons = {"New", "Save", "Load", "Brush", "Eraser", "Player", "Enemy", "Collide",
+                                        "Rect", "Fill", "Stamp", "Export"};
     float buttonWidth = 80.f;
 
     for (size_t i = 0; i < buttons.size(); ++i) {
@@ -796,16 +1179,19 @@ void Editor::renderToolbar() {
         if (i == 5 && m_currentTool == EditorTool::PlayerSpawn) isSelected = true;
         if (i == 6 && m_currentTool == EditorTool::EnemySpawn) isSelected = true;
         if (i == 7 && m_currentTool == EditorTool::CollisionShape) isSelected = true;
+        if (i == 8 && m_currentTool == EditorTool::Rect) isSelected = true;
+        if (i == 9 && m_currentTool == EditorTool::Fill) isSelected = true;
+        if (i == 10 && m_currentTool == EditorTool::Stamp) isSelected = true;
 
         btn.setFillColor(isSelected ? sf::Color{80, 120, 80} : sf::Color{70, 70, 70});
         btn.setOutlineThickness(1.f);
         btn.setOutlineColor(sf::Color{100, 100, 100});
-        m_window.draw(btn);
+        RenderStats::draw(m_target, btn);
 
         sf::Text text(m_font, buttons[i], 14);
         text.setFillColor(sf::Color::White);
         text.setPosition({i * buttonWidth + 15.f, 12.f});
-        m_window.draw(text);
+        RenderStats::draw(m_target, text);
     }
 }
 
@@ -815,13 +1201,13 @@ void Editor::renderMapSettingsPanel() {
     bg.setPosition(m_mapSettingsRect.position);
     bg.setSize(m_mapSettingsRect.size);
     bg.setFillColor(sf::Color{45, 45, 45});
-    m_window.draw(bg);
+    RenderStats::draw(m_target, bg);
 
     // 제목
     sf::Text title(m_font, "Map Settings", 14);
     title.setFillColor(sf::Color::White);
     title.setPosition({m_mapSettingsRect.position.x + 10.f, m_mapSettingsRect.position.y + 5.f});
-    m_window.draw(title);
+    RenderStats::draw(m_target, title);
 
     // 설정 표시
     float y = m_mapSettingsRect.position.y + 30.f;
@@ -829,22 +1215,27 @@ void Editor::renderMapSettingsPanel() {
     sf::Text gridText(m_font, "Grid: " + std::to_string(m_gridSize) + "px", 12);
     gridText.setFillColor(sf::Color{200, 200, 200});
     gridText.setPosition({m_mapSettingsRect.position.x + 10.f, y});
-    m_window.draw(gridText);
+    RenderStats::draw(m_target, gridText);
 
     sf::Text widthText(m_font, "Width: " + std::to_string(m_mapWidth), 12);
     widthText.setFillColor(sf::Color{200, 200, 200});
     widthText.setPosition({m_mapSettingsRect.position.x + 10.f, y + 20.f});
-    m_window.draw(widthText);
+    RenderStats::draw(m_target, widthText);
 
     sf::Text heightText(m_font, "Height: " + std::to_string(m_mapHeight), 12);
     heightText.setFillColor(sf::Color{200, 200, 200});
     heightText.setPosition({m_mapSettingsRect.position.x + 10.f, y + 40.f});
-    m_window.draw(heightText);
+    RenderStats::draw(m_target, heightText);
 
     sf::Text zoomText(m_font, "Zoom: " + std::to_string(static_cast<int>(100.f / m_zoom)) + "%", 12);
     zoomText.setFillColor(sf::Color{200, 200, 200});
     zoomText.setPosition({m_mapSettingsRect.position.x + 10.f, y + 60.f});
-    m_window.draw(zoomText);
+    RenderStats::draw(m_target, zoomText);
+
+    sf::Text brushText(m_font, "Brush: " + std::to_string(m_brushSize), 12);
+    brushText.setFillColor(sf::Color{200, 200, 200});
+    brushText.setPosition({m_mapSettingsRect.position.x + 110.f, y + 60.f});
+    RenderStats::draw(m_target, brushText);
 
     // 마우스 위치 정보 (캔버스 내에서만 표시)
     sf::Vector2f mousePosF = {static_cast<float>(m_currentMousePos.x), static_cast<float>(m_currentMousePos.y)};
@@ -858,25 +1249,25 @@ void Editor::renderMapSettingsPanel() {
         separator.setPosition({m_mapSettingsRect.position.x + 10.f, y + 85.f});
         separator.setSize({m_mapSettingsRect.size.x - 20.f, 1.f});
         separator.setFillColor(sf::Color{80, 80, 80});
-        m_window.draw(separator);
+        RenderStats::draw(m_target, separator);
 
         // 마우스 좌표 제목
         sf::Text mouseTitle(m_font, "Mouse Position", 12);
         mouseTitle.setFillColor(sf::Color{150, 200, 255});
         mouseTitle.setPosition({m_mapSettingsRect.position.x + 10.f, y + 92.f});
-        m_window.draw(mouseTitle);
+        RenderStats::draw(m_target, mouseTitle);
 
         // 타일 좌표
         sf::Text tileText(m_font, "Tile: (" + std::to_string(tilePos.x) + ", " + std::to_string(tilePos.y) + ")", 12);
         tileText.setFillColor(sf::Color{200, 200, 200});
         tileText.setPosition({m_mapSettingsRect.position.x + 10.f, y + 112.f});
-        m_window.draw(tileText);
+        RenderStats::draw(m_target, tileText);
 
         // 픽셀 좌표 (게임에서 사용하는 좌표)
         sf::Text pixelText(m_font, "Pixel: (" + std::to_string(pixelX) + ", " + std::to_string(pixelY) + ")", 12);
         pixelText.setFillColor(sf::Color{255, 200, 150});
         pixelText.setPosition({m_mapSettingsRect.position.x + 10.f, y + 132.f});
-        m_window.draw(pixelText);
+        RenderStats::draw(m_target, pixelText);
     }
 }
 
@@ -886,25 +1277,25 @@ void Editor::renderLayerPanel() {
     bg.setPosition(m_layerPanelRect.position);
     bg.setSize(m_layerPanelRect.size);
     bg.setFillColor(sf::Color{45, 45, 45});
-    m_window.draw(bg);
+    RenderStats::draw(m_target, bg);
 
     // 제목
     sf::Text title(m_font, "Layers", 14);
     title.setFillColor(sf::Color::White);
     title.setPosition({m_layerPanelRect.position.x + 10.f, m_layerPanelRect.position.y + 5.f});
-    m_window.draw(title);
+    RenderStats::draw(m_target, title);
 
     // + 버튼
     sf::RectangleShape addBtn;
     addBtn.setPosition({m_layerPanelRect.position.x + 10.f, m_layerPanelRect.position.y + 30.f});
     addBtn.setSize({25.f, 25.f});
     addBtn.setFillColor(sf::Color{70, 70, 70});
-    m_window.draw(addBtn);
+    RenderStats::draw(m_target, addBtn);
 
     sf::Text addText(m_font, "+", 16);
     addText.setFillColor(sf::Color::White);
     addText.setPosition({m_layerPanelRect.position.x + 17.f, m_layerPanelRect.position.y + 32.f});
-    m_window.draw(addText);
+    RenderStats::draw(m_target, addText);
 
     // 레이어 목록
     float y = m_layerPanelRect.position.y + 60.f;
@@ -914,19 +1305,19 @@ void Editor::renderLayerPanel() {
         layerBg.setSize({m_layerPanelRect.size.x - 10.f, 22.f});
         layerBg.setFillColor(i == static_cast<size_t>(m_currentLayerIndex)
                             ? sf::Color{80, 80, 120} : sf::Color{60, 60, 60});
-        m_window.draw(layerBg);
+        RenderStats::draw(m_target, layerBg);
 
         // 가시성 토글
         sf::CircleShape visToggle(6.f);
         visToggle.setPosition({m_layerPanelRect.position.x + 10.f, y + 5.f});
         visToggle.setFillColor(m_layers[i].visible ? sf::Color::Green : sf::Color::Red);
-        m_window.draw(visToggle);
+        RenderStats::draw(m_target, visToggle);
 
         // 레이어 이름
         sf::Text layerName(m_font, m_layers[i].name, 12);
         layerName.setFillColor(sf::Color::White);
         layerName.setPosition({m_layerPanelRect.position.x + 30.f, y + 3.f});
-        m_window.draw(layerName);
+        RenderStats::draw(m_target, layerName);
 
         y += 25.f;
     }
@@ -938,13 +1329,13 @@ void Editor::renderTileTypePanel() {
     bg.setPosition(m_tileTypePanelRect.position);
     bg.setSize(m_tileTypePanelRect.size);
     bg.setFillColor(sf::Color{45, 45, 45});
-    m_window.draw(bg);
+    RenderStats::draw(m_target, bg);
 
     // 제목
     sf::Text title(m_font, "Tile Type", 14);
     title.setFillColor(sf::Color::White);
     title.setPosition({m_tileTypePanelRect.position.x + 10.f, m_tileTypePanelRect.position.y + 5.f});
-    m_window.draw(title);
+    RenderStats::draw(m_target, title);
 
     // 타일 타입 목록
     std::vector<std::pair<std::string, sf::Color>> types = {
@@ -961,7 +1352,7 @@ void Editor::renderTileTypePanel() {
         typeBg.setSize({m_tileTypePanelRect.size.x - 10.f, 25.f});
         typeBg.setFillColor(static_cast<size_t>(m_currentTileType) == i
                           ? sf::Color{80, 80, 120} : sf::Color{55, 55, 55});
-        m_window.draw(typeBg);
+        RenderStats::draw(m_target, typeBg);
 
         // 색상 미리보기
         sf::RectangleShape preview;
@@ -970,13 +1361,13 @@ void Editor::renderTileTypePanel() {
         preview.setFillColor(types[i].second);
         preview.setOutlineThickness(1.f);
         preview.setOutlineColor(sf::Color{100, 100, 100});
-        m_window.draw(preview);
+        RenderStats::draw(m_target, preview);
 
         // 이름
         sf::Text typeName(m_font, types[i].first, 12);
         typeName.setFillColor(sf::Color::White);
         typeName.setPosition({m_tileTypePanelRect.position.x + 40.f, y + 5.f});
-        m_window.draw(typeName);
+        RenderStats::draw(m_target, typeName);
 
         y += 30.f;
     }
@@ -988,25 +1379,25 @@ void Editor::renderCollisionShapePanel() {
     bg.setPosition(m_collisionShapePanelRect.position);
     bg.setSize(m_collisionShapePanelRect.size);
     bg.setFillColor(sf::Color{45, 45, 45});
-    m_window.draw(bg);
+    RenderStats::draw(m_target, bg);
 
     // 제목
     sf::Text title(m_font, "Collision Shape", 14);
     title.setFillColor(sf::Color::White);
     title.setPosition({m_collisionShapePanelRect.position.x + 10.f, m_collisionShapePanelRect.position.y + 5.f});
-    m_window.draw(title);
+    RenderStats::draw(m_target, title);
 
     // 오버레이 토글 버튼
     sf::RectangleShape toggleBtn;
     toggleBtn.setPosition({m_collisionShapePanelRect.position.x + 130.f, m_collisionShapePanelRect.position.y + 5.f});
     toggleBtn.setSize({60.f, 18.f});
     toggleBtn.setFillColor(m_showCollisionOverlay ? sf::Color{80, 120, 80} : sf::Color{70, 70, 70});
-    m_window.draw(toggleBtn);
+    RenderStats::draw(m_target, toggleBtn);
 
     sf::Text toggleText(m_font, m_showCollisionOverlay ? "ON" : "OFF", 10);
     toggleText.setFillColor(sf::Color::White);
     toggleText.setPosition({m_collisionShapePanelRect.position.x + 150.f, m_collisionShapePanelRect.position.y + 7.f});
-    m_window.draw(toggleText);
+    RenderStats::draw(m_target, toggleText);
 
     // 충돌 형태 목록
     std::vector<std::pair<std::string, sf::Color>> shapes = {
@@ -1031,7 +1422,7 @@ void Editor::renderCollisionShapePanel() {
         shapeBg.setSize({m_collisionShapePanelRect.size.x - 10.f, 22.f});
         shapeBg.setFillColor(m_currentCollisionShape == shapeEnum
                            ? sf::Color{80, 80, 120} : sf::Color{55, 55, 55});
-        m_window.draw(shapeBg);
+        RenderStats::draw(m_target, shapeBg);
 
         // 색상 미리보기
         sf::RectangleShape preview;
@@ -1040,13 +1431,13 @@ void Editor::renderCollisionShapePanel() {
         preview.setFillColor(shapes[i].second);
         preview.setOutlineThickness(1.f);
         preview.setOutlineColor(sf::Color{100, 100, 100});
-        m_window.draw(preview);
+        RenderStats::draw(m_target, preview);
 
         // 이름
         sf::Text shapeName(m_font, shapes[i].first, 11);
         shapeName.setFillColor(sf::Color::White);
         shapeName.setPosition({m_collisionShapePanelRect.position.x + 35.f, y + 4.f});
-        m_window.draw(shapeName);
+        RenderStats::draw(m_target, shapeName);
 
         y += 25.f;
     }
@@ -1058,7 +1449,19 @@ bool Editor::isMouseOverUI(sf::Vector2i mousePos) const {
            m_layerPanelRect.contains(pos) ||
            m_tileTypePanelRect.contains(pos) ||
            m_collisionShapePanelRect.contains(pos) ||
-           m_mapSettingsRect.contains(pos);
+           m_mapSettingsRect.contains(pos) ||
+           m_minimap.getDisplayRect().contains(pos);
+}
+
+sf::IntRect Editor::getVisibleTileRect() const {
+    sf::Vector2f topLeft = m_mapView.getCenter() - m_mapView.getSize() / 2.f;
+    sf::Vector2f bottomRight = topLeft + m_mapView.getSize();
+    float gridSize = static_cast<float>(m_gridSize);
+    int x0 = static_cast<int>(std::floor(topLeft.x / gridSize));
+    int y0 = static_cast<int>(std::floor(topLeft.y / gridSize));
+    int x1 = static_cast<int>(std::ceil(bottomRight.x / gridSize));
+    int y1 = static_cast<int>(std::ceil(bottomRight.y / gridSize));
+    return {{x0, y0}, {x1 - x0, y1 - y0}};
 }
 
 sf::Vector2i Editor::screenToTile(sf::Vector2i screenPos) const {
@@ -1075,21 +1478,28 @@ void Editor::setTile(int x, int y, TileType type) {
     if (m_currentLayerIndex < 0 || m_currentLayerIndex >= static_cast<int>(m_layers.size())) return;
     auto& layer = m_layers[m_currentLayerIndex];
 
-    if (y >= 0 && y < static_cast<int>(layer.tiles.size()) &&
-        x >= 0 && x < static_cast<int>(layer.tiles[y].size())) {
-        layer.tiles[y][x].type = type;
+    if (layer.tiles.contains(x, y)) {
+        loadPendingChunk(layer, x >> EditorLayer::Grid::CHUNK_SHIFT, y >> EditorLayer::Grid::CHUNK_SHIFT);
+        // 빈 칸 지우기는 청크를 할당하지 않음
+        if (type == TileType::Empty && layer.tiles.get(x, y).type == TileType::Empty) return;
+
+        EditorTile& tile = layer.tiles.edit(x, y);
+        EditorTile oldTile = tile;
+        tile.type = type;
         // 타일 타입에 따라 기본 충돌 형태 설정
         if (type == TileType::Empty) {
-            layer.tiles[y][x].shape = CollisionShape::None;
+            tile.shape = CollisionShape::None;
         } else if (type == TileType::Platform) {
-            layer.tiles[y][x].shape = CollisionShape::Platform;
+            tile.shape = CollisionShape::Platform;
         } else if (type == TileType::Solid) {
             // Solid 타일은 기존 shape이 None이면 Full로 설정
-            if (layer.tiles[y][x].shape == CollisionShape::None ||
-                layer.tiles[y][x].shape == CollisionShape::Platform) {
-                layer.tiles[y][x].shape = CollisionShape::Full;
+            if (tile.shape == CollisionShape::None ||
+                tile.shape == CollisionShape::Platform) {
+                tile.shape = CollisionShape::Full;
             }
         }
+        layer.invalidate({{x, y}, {1, 1}});
+        m_history.recordTile(static_cast<uint32_t>(y * m_mapWidth + x), oldTile, tile);
     }
 }
 
@@ -1097,11 +1507,15 @@ void Editor::setTileShape(int x, int y, CollisionShape shape) {
     if (m_currentLayerIndex < 0 || m_currentLayerIndex >= static_cast<int>(m_layers.size())) return;
     auto& layer = m_layers[m_currentLayerIndex];
 
-    if (y >= 0 && y < static_cast<int>(layer.tiles.size()) &&
-        x >= 0 && x < static_cast<int>(layer.tiles[y].size())) {
+    if (layer.tiles.contains(x, y)) {
+        loadPendingChunk(layer, x >> EditorLayer::Grid::CHUNK_SHIFT, y >> EditorLayer::Grid::CHUNK_SHIFT);
         // 빈 타일이 아닌 경우에만 충돌 형태 설정
-        if (layer.tiles[y][x].type != TileType::Empty) {
-            layer.tiles[y][x].shape = shape;
+        if (layer.tiles.get(x, y).type != TileType::Empty) {
+            EditorTile& tile = layer.tiles.edit(x, y);
+            EditorTile oldTile = tile;
+            tile.shape = shape;
+            layer.invalidate({{x, y}, {1, 1}});
+            m_history.recordTile(static_cast<uint32_t>(y * m_mapWidth + x), oldTile, tile);
         }
     }
 }
@@ -1112,9 +1526,8 @@ TileType Editor::getTile(int x, int y) const {
 
     const auto& layer = m_layers[m_currentLayerIndex];
 
-    if (y >= 0 && y < static_cast<int>(layer.tiles.size()) &&
-        x >= 0 && x < static_cast<int>(layer.tiles[y].size())) {
-        return layer.tiles[y][x].type;
+    if (layer.tiles.contains(x, y)) {
+        return layer.tiles.get(x, y).type;
     }
     return TileType::Empty;
 }
@@ -1125,33 +1538,318 @@ CollisionShape Editor::getTileShape(int x, int y) const {
 
     const auto& layer = m_layers[m_currentLayerIndex];
 
-    if (y >= 0 && y < static_cast<int>(layer.tiles.size()) &&
-        x >= 0 && x < static_cast<int>(layer.tiles[y].size())) {
-        return layer.tiles[y][x].shape;
+    if (layer.tiles.contains(x, y)) {
+        return layer.tiles.get(x, y).shape;
     }
     return CollisionShape::None;
 }
 
+void Editor::paintBrush(int x, int y, TileType type) {
+    // 크기가 짝수면 중심이 왼쪽 위 칸
+    int half = (m_brushSize - 1) / 2;
+    sf::IntRect rect = {{x - half, y - half}, {m_brushSize, m_brushSize}};
+    for (int ty = rect.position.y; ty < rect.position.y + rect.size.y; ++ty) {
+        for (int tx = rect.position.x; tx < rect.position.x + rect.size.x; ++tx) {
+            setTile(tx, ty, type);
+        }
+    }
+    if (type == TileType::Empty) {
+        eraseSpawnsIn(rect);
+    }
+}
+
+void Editor::eraseSpawnsIn(const sf::IntRect& rect) {
+    if (rect.contains(m_playerSpawn)) {
+        m_playerSpawn = {-1, -1};
+    }
+    for (sf::Vector2i tile : m_enemySpawns.removeIn(rect)) {
+        m_history.recordEnemyRemoved(tile);
+    }
+}
+
+sf::IntRect Editor::getDragRect(sf::Vector2i currentTile) const {
+    int x0 = std::clamp(std::min(m_dragStartTile.x, currentTile.x), 0, m_mapWidth);
+    int y0 = std::clamp(std::min(m_dragStartTile.y, currentTile.y), 0, m_mapHeight);
+    int x1 = std::clamp(std::max(m_dragStartTile.x, currentTile.x) + 1, 0, m_mapWidth);
+    int y1 = std::clamp(std::max(m_dragStartTile.y, currentTile.y) + 1, 0, m_mapHeight);
+    return {{x0, y0}, {std::max(0, x1 - x0), std::max(0, y1 - y0)}};
+}
+
+void Editor::applyRowEdits(const sf::IntRect& area, const RowEdit& rowEdit) {
+    using Grid = EditorLayer::Grid;
+    int y0 = std::max(0, area.position.y);
+    int y1 = std::min(m_mapHeight, area.position.y + area.size.y);
+    int columns = std::min(m_mapWidth, area.position.x + area.size.x) - std::max(0, area.position.x);
+    if (y0 >= y1 || columns <= 0) return;
+
+    // 청크 줄 하나(64줄)가 작업 단위 -> 두 스레드가 같은 청크를 복사/할당하지 않음
+    int firstBand = y0 >> Grid::CHUNK_SHIFT;
+    int bandCount = ((y1 - 1) >> Grid::CHUNK_SHIFT) - firstBand + 1;
+    int bandsPerThread = std::max(1, PARALLEL_MIN_CELLS / (columns * Grid::CHUNK_SIZE));
+
+    std::vector<std::vector<EditorHistory::Run>> bandRuns(static_cast<size_t>(bandCount));
+    parallelFor(bandCount, bandsPerThread, [&](int begin, int end) {
+        for (int band = begin; band < end; ++band) {
+            int bandY0 = std::max(y0, (firstBand + band) << Grid::CHUNK_SHIFT);
+            int bandY1 = std::min(y1, (firstBand + band + 1) << Grid::CHUNK_SHIFT);
+            for (int y = bandY0; y < bandY1; ++y) {
+                rowEdit(y, bandRuns[band]);
+            }
+        }
+    });
+
+    // 줄 순서대로 이어 붙임 (이미 시작 인덱스 순)
+    std::vector<EditorHistory::Run> runs;
+    size_t total = 0;
+    for (const auto& band : bandRuns) total += band.size();
+    runs.reserve(total);
+    for (const auto& band : bandRuns) runs.insert(runs.end(), band.begin(), band.end());
+    commitRuns(runs);
+}
+
+void Editor::commitRuns(const std::vector<EditorHistory::Run>& runs) {
+    if (runs.empty()) return;
+    auto& layer = m_layers[m_currentLayerIndex];
+
+    // 바뀐 영역을 모아 한 번에 무효화
+    int width = m_mapWidth;
+    int minX = width, minY = m_mapHeight, maxX = -1, maxY = -1;
+    for (const auto& run : runs) {
+        int y = static_cast<int>(run.start / static_cast<uint32_t>(width));
+        int x0 = static_cast<int>(run.start - static_cast<uint32_t>(y * width));
+        int x1 = x0 + static_cast<int>(run.length);
+        minX = std::min(minX, x0);
+        maxX = std::max(maxX, x1);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y + 1);
+    }
+    layer.invalidate({{minX, minY}, {maxX - minX, maxY - minY}});
+
+    // 스트로크 밖에서 불렸으면 이 편집만으로 스트로크 하나
+    bool ownStroke = !m_history.isRecording();
+    if (ownStroke) beginStroke();
+    for (const auto& run : runs) {
+        m_history.recordRun(run.start, run.length, run.oldTile, run.newTile);
+    }
+    if (ownStroke) endStroke();
+    m_hasUnsavedChanges = true;
+}
+
+void Editor::fillRect(const sf::IntRect& rect, const EditorTile& tile) {
+    if (m_currentLayerIndex < 0 || m_currentLayerIndex >= static_cast<int>(m_layers.size())) return;
+    loadPendingChunks(m_layers[m_currentLayerIndex], rect);
+    auto& grid = m_layers[m_currentLayerIndex].tiles;
+    int x0 = std::max(0, rect.position.x);
+    int x1 = std::min(m_mapWidth, rect.position.x + rect.size.x);
+    uint32_t width = static_cast<uint32_t>(m_mapWidth);
+
+    applyRowEdits(rect, [&](int y, std::vector<EditorHistory::Run>& runs) {
+        size_t first = runs.size();
+        grid.forEachRowRun(y, x0, x1, [&](int start, int end, const EditorTile& oldTile) {
+            if (oldTile != tile) {
+                runs.push_back({static_cast<uint32_t>(y) * width + static_cast<uint32_t>(start),
+                                static_cast<uint32_t>(end - start), oldTile, tile});
+            }
+        });
+        // 이미 같은 구간은 건드리지 않음 (공유 청크 복사/빈 청크 할당 방지)
+        for (size_t i = first; i < runs.size(); ++i) {
+            int start = static_cast<int>(runs[i].start - static_cast<uint32_t>(y) * width);
+            grid.fillRow(y, start, start + static_cast<int>(runs[i].length), tile);
+        }
+    });
+}
+
+void Editor::floodFill(int x, int y, const EditorTile& tile) {
+    if (m_currentLayerIndex < 0 || m_currentLayerIndex >= static_cast<int>(m_layers.size())) return;
+    // 채울 영역을 미리 알 수 없으므로 레이어 전체를 읽어 둠
+    loadPendingChunks(m_layers[m_currentLayerIndex], {{0, 0}, {m_mapWidth, m_mapHeight}});
+    auto& grid = m_layers[m_currentLayerIndex].tiles;
+    if (!grid.contains(x, y)) return;
+
+    const EditorTile target = grid.get(x, y);
+    if (target == tile) return;
+
+    // 스캔라인: 씨앗 칸이 속한 가로 구간 전체를 한 번에 채우고
+    // 위/아래 줄에서 target 구간마다 씨앗 하나씩만 쌓음
+    // 채운 칸은 target이 아니게 되므로 같은 칸을 두 번 채우지 않음 (구간끼리 겹치지 않음)
+    uint32_t width = static_cast<uint32_t>(m_mapWidth);
+    std::vector<EditorHistory::Run> runs;
+    std::vector<sf::Vector2i> seeds = {{x, y}};
+    while (!seeds.empty()) {
+        sf::Vector2i seed = seeds.back();
+        seeds.pop_back();
+        if (grid.get(seed.x, seed.y) != target) continue;
+
+        int left = seed.x;
+        while (left > 0 && grid.get(left - 1, seed.y) == target) --left;
+        int right = seed.x + 1;
+        while (right < m_mapWidth && grid.get(right, seed.y) == target) ++right;
+
+        grid.fillRow(seed.y, left, right, tile);
+        runs.push_back({static_cast<uint32_t>(seed.y) * width + static_cast<uint32_t>(left),
+                        static_cast<uint32_t>(right - left), target, tile});
+
+        for (int ny : {seed.y - 1, seed.y + 1}) {
+            grid.forEachRowRun(ny, left, right, [&](int start, int, const EditorTile& cell) {
+                if (cell == target) seeds.push_back({start, ny});
+            });
+        }
+    }
+    commitRuns(runs);
+}
+
+void Editor::copyRegion(const sf::IntRect& rect) {
+    if (m_currentLayerIndex < 0 || m_currentLayerIndex >= static_cast<int>(m_layers.size())) return;
+    loadPendingChunks(m_layers[m_currentLayerIndex], rect);
+    const auto& grid = m_layers[m_currentLayerIndex].tiles;
+    int x0 = std::max(0, rect.position.x);
+    int y0 = std::max(0, rect.position.y);
+    int x1 = std::min(m_mapWidth, rect.position.x + rect.size.x);
+    int y1 = std::min(m_mapHeight, rect.position.y + rect.size.y);
+    if (x0 >= x1 || y0 >= y1) return;
+
+    m_stamp.width = x1 - x0;
+    m_stamp.height = y1 - y0;
+    m_stamp.tiles.assign(static_cast<size_t>(m_stamp.width) * m_stamp.height, EditorTile{});
+    for (int y = y0; y < y1; ++y) {
+        EditorTile* row = &m_stamp.tiles[static_cast<size_t>(y - y0) * m_stamp.width];
+        grid.forEachRowRun(y, x0, x1, [&](int start, int end, const EditorTile& cell) {
+            std::fill(row + (start - x0), row + (end - x0), cell);
+        });
+    }
+    LOG_INFO("Copied {}x{} stamp", m_stamp.width, m_stamp.height);
+}
+
+void Editor::pasteStamp(int x, int y) {
+    if (m_currentLayerIndex < 0 || m_currentLayerIndex >= static_cast<int>(m_layers.size())) return;
+    if (m_stamp.empty()) return;
+    sf::IntRect area = {{x, y}, {m_stamp.width, m_stamp.height}};
+    loadPendingChunks(m_layers[m_currentLayerIndex], area);
+    auto& grid = m_layers[m_currentLayerIndex].tiles;
+    int x0 = std::max(0, x);
+    int x1 = std::min(m_mapWidth, x + m_stamp.width);
+    if (x0 >= x1) return;
+    uint32_t width = static_cast<uint32_t>(m_mapWidth);
+
+    applyRowEdits(area, [&](int ty, std::vector<EditorHistory::Run>& runs) {
+        const EditorTile* source = &m_stamp.tiles[static_cast<size_t>(ty - y) * m_stamp.width + (x0 - x)];
+        size_t first = runs.size();
+        // (이전, 새) 값이 모두 같은 칸끼리 구간으로 묶음
+        for (int tx = x0; tx < x1;) {
+            int start = tx;
+            const EditorTile& newTile = source[tx - x0];
+            EditorTile oldTile = grid.get(tx, ty);
+            ++tx;
+            while (tx < x1 && source[tx - x0] == newTile && grid.get(tx, ty) == oldTile) ++tx;
+            if (oldTile != newTile) {
+                runs.push_back({static_cast<uint32_t>(ty) * width + static_cast<uint32_t>(start),
+                                static_cast<uint32_t>(tx - start), oldTile, newTile});
+            }
+        }
+        for (size_t i = first; i < runs.size(); ++i) {
+            int start = static_cast<int>(runs[i].start - static_cast<uint32_t>(ty) * width);
+            grid.fillRow(ty, start, start + static_cast<int>(runs[i].length), runs[i].newTile);
+        }
+    });
+}
+
 void Editor::resizeMap(int newWidth, int newHeight) {
+    // 청크 배치가 바뀌므로 읽지 않은 청크를 먼저 모두 읽음
+    loadAllPendingChunks();
+    // 기록된 인덱스가 맵 너비 기준이므로 크기가 바뀌면 기록을 버림
+    m_history.clear();
     m_mapWidth = newWidth;
     m_mapHeight = newHeight;
 
     for (auto& layer : m_layers) {
         layer.resize(newWidth, newHeight);
     }
+    if (m_journal.isOpen() && !m_journal.appendResize(newWidth, newHeight)) {
+        LOG_ERROR("Failed to write journal: {}", m_currentFilename);
+    }
+}
+
+void Editor::beginStroke() {
+    if (m_currentLayerIndex < 0 || m_currentLayerIndex >= static_cast<int>(m_layers.size())) return;
+    m_history.beginStroke(m_currentLayerIndex, m_mapWidth, m_playerSpawn);
+}
+
+void Editor::endStroke() {
+    if (m_history.endStroke(m_playerSpawn)) {
+        noteEdit();
+        journalStroke(*m_history.lastStroke());
+    }
+}
+
+void Editor::undo() {
+    if (m_history.isRecording()) endStroke();
+    if (const EditorHistory::Stroke* stroke = m_history.undo()) {
+        applyStroke(*stroke, true);
+    }
+}
+
+void Editor::redo() {
+    if (m_history.isRecording()) endStroke();
+    if (const EditorHistory::Stroke* stroke = m_history.redo()) {
+        applyStroke(*stroke, false);
+    }
+}
+
+void Editor::applyStroke(const EditorHistory::Stroke& stroke, bool useOldState) {
+    if (stroke.layerIndex >= 0 && stroke.layerIndex < static_cast<int>(m_layers.size()) && stroke.width > 0) {
+        EditorLayer& layer = m_layers[stroke.layerIndex];
+        uint32_t width = static_cast<uint32_t>(stroke.width);
+
+        // 구간을 줄 단위로 나눠서 채움
+        for (const auto& run : stroke.runs) {
+            const EditorTile& tile = useOldState ? run.oldTile : run.newTile;
+            uint32_t index = run.start;
+            uint32_t end = run.start + run.length;
+            while (index < end) {
+                uint32_t y = index / width;
+                uint32_t rowEnd = std::min(end, (y + 1) * width);
+                int x = static_cast<int>(index - y * width);
+                layer.fillRow(static_cast<int>(y), x, x + static_cast<int>(rowEnd - index), tile);
+                index = rowEnd;
+            }
+        }
+    }
+
+    if (stroke.spawnsChanged) {
+        // 실행 취소면 추가된 것을 지우고 삭제된 것을 되살림
+        m_playerSpawn = useOldState ? stroke.oldPlayerSpawn : stroke.newPlayerSpawn;
+        const auto& toRemove = useOldState ? stroke.addedEnemies : stroke.removedEnemies;
+        const auto& toAdd = useOldState ? stroke.removedEnemies : stroke.addedEnemies;
+        for (sf::Vector2i tile : toRemove) {
+            m_enemySpawns.remove(tile);
+        }
+        for (sf::Vector2i tile : toAdd) {
+            m_enemySpawns.add(tile);
+        }
+    }
+    m_hasUnsavedChanges = true;
+    noteEdit();
+    journalStroke(stroke);
 }
 
 void Editor::addLayer(const std::string& name) {
     m_layers.emplace_back(name, m_mapWidth, m_mapHeight);
+    m_layers.back().minimap = &m_minimap;
     m_currentLayerIndex = static_cast<int>(m_layers.size()) - 1;
+    m_minimap.markAllDirty();  // 레이어 구성이 바뀜 (새로 열거나 만들 때 이전 맵 내용도 지움)
 }
 
 void Editor::removeLayer(int index) {
     if (index >= 0 && index < static_cast<int>(m_layers.size()) && m_layers.size() > 1) {
+        m_history.clear();  // 레이어 번호가 바뀌므로 기록을 버림
         m_layers.erase(m_layers.begin() + index);
+        m_minimap.markAllDirty();
         if (m_currentLayerIndex >= static_cast<int>(m_layers.size())) {
             m_currentLayerIndex = static_cast<int>(m_layers.size()) - 1;
         }
+        if (m_journal.isOpen() && !m_journal.appendRemoveLayer(index)) {
+            LOG_ERROR("Failed to write journal: {}", m_currentFilename);
+        }
     }
 }
 
@@ -1162,6 +1860,9 @@ void Editor::selectLayer(int index) {
 }
 
 void Editor::newMap() {
+    m_projectReader.close();
+    closeJournal();
+    m_history.clear();
     m_layers.clear();
     addLayer("Ground");
     m_playerSpawn = {-1, -1};
@@ -1173,19 +1874,21 @@ void Editor::newMap() {
     };
     m_mapView.setCenter(m_cameraPos);
     m_hasUnsavedChanges = false;
+    m_autosaveEdits = 0;
     m_currentFilename.clear();
 }
 
-void Editor::saveMap(const std::string& filename) {
+void Editor::exportMap(const std::string& filename) {
+    loadAllPendingChunks();
     std::ofstream file(filename, std::ios::binary);
     if (!file.is_open()) {
-        std::cerr << "Failed to save: " << filename << std::endl;
+        LOG_ERROR("Failed to export: {}", filename);
         return;
     }
 
     // Header
-    file.write(FILE_MAGIC, 4);
-    file.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+    file.write(FlatMapFile::MAGIC, 4);
+    file.write(reinterpret_cast<const char*>(&FlatMapFile::VERSION), sizeof(FlatMapFile::VERSION));
     uint16_t gridSize = static_cast<uint16_t>(m_gridSize);
     file.write(reinterpret_cast<const char*>(&gridSize), sizeof(gridSize));
     uint32_t width = static_cast<uint32_t>(m_mapWidth);
@@ -1204,19 +1907,16 @@ void Editor::saveMap(const std::string& filename) {
 
     for (const auto& layer : m_layers) {
         if (!layer.visible) continue;
-        for (int y = 0; y < m_mapHeight && y < static_cast<int>(layer.tiles.size()); ++y) {
-            for (int x = 0; x < m_mapWidth && x < static_cast<int>(layer.tiles[y].size()); ++x) {
-                const EditorTile& tile = layer.tiles[y][x];
-                if (tile.type != TileType::Empty) {
-                    nonEmptyTiles.push_back({
-                        static_cast<uint16_t>(x),
-                        static_cast<uint16_t>(y),
-                        static_cast<uint8_t>(tile.type),
-                        static_cast<uint8_t>(tile.shape)
-                    });
-                }
+        layer.tiles.forEachCell([&](int x, int y, const EditorTile& tile) {
+            if (tile.type != TileType::Empty) {
+                nonEmptyTiles.push_back({
+                    static_cast<uint16_t>(x),
+                    static_cast<uint16_t>(y),
+                    static_cast<uint8_t>(tile.type),
+                    static_cast<uint8_t>(tile.shape)
+                });
             }
-        }
+        });
     }
 
     uint32_t tileCount = static_cast<uint32_t>(nonEmptyTiles.size());
@@ -1237,7 +1937,7 @@ void Editor::saveMap(const std::string& filename) {
     // Enemy Spawns (타일 좌표 그대로 저장)
     uint32_t enemyCount = static_cast<uint32_t>(m_enemySpawns.size());
     file.write(reinterpret_cast<const char*>(&enemyCount), sizeof(enemyCount));
-    for (const auto& spawn : m_enemySpawns) {
+    for (const auto& spawn : m_enemySpawns.positions()) {
         int32_t ex = spawn.x;
         int32_t ey = spawn.y;
         uint8_t et = 0;  // 기본 적 타입
@@ -1246,101 +1946,481 @@ void Editor::saveMap(const std::string& filename) {
         file.write(reinterpret_cast<const char*>(&et), sizeof(et));
     }
 
-    m_currentFilename = filename;
-    m_hasUnsavedChanges = false;
-    std::cout << "Saved: " << filename << std::endl;
+    LOG_INFO("Exported: {}", filename);
 }
 
-void Editor::loadMap(const std::string& filename) {
+void Editor::importMap(const std::string& filename) {
     std::ifstream file(filename, std::ios::binary);
     if (!file.is_open()) {
-        std::cerr << "Failed to load: " << filename << std::endl;
-        return;
-    }
-
-    // Header
-    char magic[4];
-    file.read(magic, 4);
-    if (magic[0] != FILE_MAGIC[0] || magic[1] != FILE_MAGIC[1] ||
-        magic[2] != FILE_MAGIC[2] || magic[3] != FILE_MAGIC[3]) {
-        std::cerr << "Invalid file format" << std::endl;
+        LOG_ERROR("Failed to load: {}", filename);
         return;
     }
 
-    uint16_t version;
-    file.read(reinterpret_cast<char*>(&version), sizeof(version));
-    if (version != FILE_VERSION && version != FILE_VERSION_1) {
-        std::cerr << "Unsupported version: " << version << std::endl;
+    // 끝까지 읽고 확인한 뒤에만 현재 맵을 바꿈
+    FlatMapFile::Contents contents;
+    if (!FlatMapFile::read(file, contents, EditorLayer::gridCost())) {
+        LOG_ERROR("Invalid or corrupted map file: {}", filename);
         return;
     }
 
-    uint16_t gridSize;
-    file.read(reinterpret_cast<char*>(&gridSize), sizeof(gridSize));
-    m_gridSize = gridSize;
-
-    uint32_t width, height;
-    file.read(reinterpret_cast<char*>(&width), sizeof(width));
-    file.read(reinterpret_cast<char*>(&height), sizeof(height));
-
     // 맵 초기화
-    m_mapWidth = static_cast<int>(width);
-    m_mapHeight = static_cast<int>(height);
+    m_gridSize = contents.gridSize;
+    m_mapWidth = static_cast<int>(contents.width);
+    m_mapHeight = static_cast<int>(contents.height);
+    m_projectReader.close();
+    closeJournal();
+    m_history.clear();
     m_layers.clear();
     addLayer("Ground");
 
     // Tiles
-    uint32_t tileCount;
-    file.read(reinterpret_cast<char*>(&tileCount), sizeof(tileCount));
-    for (uint32_t i = 0; i < tileCount; ++i) {
-        uint16_t tx, ty;
-        uint8_t tt;
-        file.read(reinterpret_cast<char*>(&tx), sizeof(tx));
-        file.read(reinterpret_cast<char*>(&ty), sizeof(ty));
-        file.read(reinterpret_cast<char*>(&tt), sizeof(tt));
-
-        // Version 2: CollisionShape 읽기
-        uint8_t ts = static_cast<uint8_t>(CollisionShape::Full);  // 기본값
-        if (version == FILE_VERSION) {
-            file.read(reinterpret_cast<char*>(&ts), sizeof(ts));
-        } else {
-            // Version 1: 타입에 따라 기본 CollisionShape 설정
-            if (static_cast<TileType>(tt) == TileType::Platform) {
-                ts = static_cast<uint8_t>(CollisionShape::Platform);
-            }
-        }
+    for (const FlatMapFile::Tile& tile : contents.tiles) {
+        EditorTile& cell = m_layers[0].tiles.edit(tile.x, tile.y);
+        cell.type = static_cast<TileType>(tile.type);
+        cell.shape = static_cast<CollisionShape>(tile.shape);
+    }
 
-        if (ty < m_layers[0].tiles.size() && tx < m_layers[0].tiles[ty].size()) {
-            m_layers[0].tiles[ty][tx].type = static_cast<TileType>(tt);
-            m_layers[0].tiles[ty][tx].shape = static_cast<CollisionShape>(ts);
+    // Spawns (타일 좌표 그대로 사용)
+    m_playerSpawn = {contents.playerSpawn.x, contents.playerSpawn.y};
+    m_enemySpawns.clear();
+    for (const FlatMapFile::Spawn& spawn : contents.enemySpawns) {
+        m_enemySpawns.add({spawn.x, spawn.y});  // 같은 타일에 중복된 스폰은 하나로
+    }
+
+    m_currentFilename = filename;
+    m_hasUnsavedChanges = false;
+    m_autosaveEdits = 0;
+    // 맵의 중앙으로 카메라 설정
+    m_cameraPos = {
+        static_cast<float>(m_mapWidth * m_gridSize) / 2.f,
+        static_cast<float>(m_mapHeight * m_gridSize) / 2.f
+    };
+    m_mapView.setCenter(m_cameraPos);
+    LOG_INFO("Loaded: {}", filename);
+}
+
+void Editor::loadMap(const std::string& filename) {
+    // 저장 중인 파일을 열 수도 있으므로 먼저 끝냄
+    finishSaves();
+    if (ProjectFile::isProjectFile(filename)) {
+        loadProject(filename);
+    } else {
+        importMap(filename);
+    }
+}
+
+void Editor::saveProject(const std::string& filename) {
+    // 같은 파일이면 바뀐 청크는 이미 저널에 있으므로 저장 지점만 남김
+    if (m_journal.isOpen() && filename == m_currentFilename) {
+        if (m_journal.appendSave()) {
+            m_hasUnsavedChanges = false;
+            m_autosaveEdits = 0;
+            LOG_INFO("Saved: {} (journal {} bytes)", filename, m_journal.getSize());
+            compactJournalIfNeeded();
+            return;
         }
+        LOG_ERROR("Failed to write journal: {}", m_journal.getPath());
     }
 
-    // Player Spawn (타일 좌표 그대로 사용)
-    int32_t spawnX, spawnY;
-    file.read(reinterpret_cast<char*>(&spawnX), sizeof(spawnX));
-    file.read(reinterpret_cast<char*>(&spawnY), sizeof(spawnY));
-    m_playerSpawn = {spawnX, spawnY};
+    // 새 파일이면 전체를 쓰고 새 저널을 시작함 (이전 파일의 저장하지 않은 기록은 버림)
+    closeJournal();
+    // 스냅샷에 모든 청크가 있어야 하므로 남은 청크를 모두 읽고 파일을 닫음
+    loadAllPendingChunks();
+    m_projectReader.close();
 
-    // Enemy Spawns (타일 좌표 그대로 사용)
-    m_enemySpawns.clear();
-    uint32_t enemyCount;
-    file.read(reinterpret_cast<char*>(&enemyCount), sizeof(enemyCount));
-    for (uint32_t i = 0; i < enemyCount; ++i) {
-        int32_t ex, ey;
-        uint8_t et;
-        file.read(reinterpret_cast<char*>(&ex), sizeof(ex));
-        file.read(reinterpret_cast<char*>(&ey), sizeof(ey));
-        file.read(reinterpret_cast<char*>(&et), sizeof(et));
-        m_enemySpawns.push_back({ex, ey});
+    uint64_t journalId = ProjectJournal<EditorTile>::newId();
+    if (!m_journal.create(ProjectJournal<EditorTile>::pathFor(filename), journalId)) {
+        LOG_WARN("Failed to create journal: {}", ProjectJournal<EditorTile>::pathFor(filename));
+        journalId = 0;
+    }
+    startSave(filename, false, journalId, 0);
+    m_currentFilename = filename;
+    m_hasUnsavedChanges = false;  // 실패하면 pollSave에서 되돌림
+    m_autosaveEdits = 0;
+}
+
+void Editor::loadProject(const std::string& filename) {
+    ProjectFile::Reader reader;
+    if (!reader.open(filename)) {
+        LOG_ERROR("Failed to load project: {}", filename);
+        return;
+    }
+    const ProjectFile::Info& info = reader.getInfo();
+    closeJournal();
+
+    m_gridSize = info.gridSize;
+    m_mapWidth = static_cast<int>(info.width);
+    m_mapHeight = static_cast<int>(info.height);
+    m_history.clear();
+    m_layers.clear();
+
+    // 레이어와 청크 표만 만들고 타일은 아직 읽지 않음
+    size_t chunkCount = 0;
+    for (const auto& layerInfo : info.layers) {
+        addLayer(layerInfo.name);
+        EditorLayer& layer = m_layers.back();
+        layer.visible = layerInfo.visible;
+        layer.pendingChunks.assign(static_cast<size_t>(layer.tiles.getChunkColumns()) * layer.tiles.getChunkRows(), {});
+        for (const auto& entry : layerInfo.chunks) {
+            ProjectFile::ChunkEntry& slot = layer.pendingChunks[static_cast<size_t>(entry.chunkY) * layer.tiles.getChunkColumns() + entry.chunkX];
+            if (slot.size == 0) ++layer.pendingCount;
+            slot = entry;
+        }
+        chunkCount += layer.pendingCount;
     }
+    if (m_layers.empty()) {
+        addLayer("Ground");
+    }
+    m_currentLayerIndex = 0;
+
+    m_playerSpawn = info.playerSpawn;
+    m_enemySpawns.assign(info.enemySpawns);
+    uint64_t journalId = info.journalId;
+    uint64_t journalSeq = info.journalSeq;
+    m_projectReader = std::move(reader);
 
     m_currentFilename = filename;
     m_hasUnsavedChanges = false;
+    m_autosaveEdits = 0;
+
+    // 파일에 아직 반영되지 않은 저널 기록 적용 (없거나 짝이 맞지 않으면 다음 저장 때 전체를 씀)
+    std::string journalPath = ProjectJournal<EditorTile>::pathFor(filename);
+    if (journalId != 0 && m_journal.open(journalPath, journalId, journalSeq,
+                                         [&](const auto& record) { applyJournalRecord(record); })) {
+        if (m_journal.hasUnsaved()) {
+            m_hasUnsavedChanges = true;
+            LOG_WARN("Recovered unsaved edits from journal: {}", journalPath);
+        }
+    } else if (std::filesystem::exists(journalPath)) {
+        LOG_WARN("Ignoring journal that does not match the project: {}", journalPath);
+    }
     // 맵의 중앙으로 카메라 설정
     m_cameraPos = {
         static_cast<float>(m_mapWidth * m_gridSize) / 2.f,
         static_cast<float>(m_mapHeight * m_gridSize) / 2.f
     };
     m_mapView.setCenter(m_cameraPos);
-    std::cout << "Loaded: " << filename << std::endl;
+
+    // 보이는 청크만 지금 읽고 나머지는 update에서
+    streamPendingChunks(sf::Time::Zero);
+    LOG_INFO("Loaded: {} ({} layers, {} chunks)", filename, m_layers.size(), chunkCount);
+}
+
+ProjectFile::ChunkEntry Editor::takePendingChunk(EditorLayer& layer, int chunkX, int chunkY) {
+    if (!layer.isPending(chunkX, chunkY)) return {};
+
+    size_t index = static_cast<size_t>(chunkY) * layer.tiles.getChunkColumns() + chunkX;
+    ProjectFile::ChunkEntry entry = layer.pendingChunks[index];
+    layer.pendingChunks[index] = {};
+    if (--layer.pendingCount == 0) {
+        layer.pendingChunks.clear();
+        layer.pendingChunks.shrink_to_fit();
+        layer.pendingCursor = 0;
+    }
+    return entry;
+}
+
+void Editor::loadPendingChunk(EditorLayer& layer, int chunkX, int chunkY) {
+    if (!layer.isPending(chunkX, chunkY)) return;
+    ProjectFile::ChunkEntry entry = takePendingChunk(layer, chunkX, chunkY);
+
+    EditorLayer::Grid::Chunk& chunk = layer.tiles.editChunk(chunkX, chunkY);
+    if (!m_projectReader.readChunk(entry, chunk)) {
+        LOG_ERROR("Failed to read chunk ({}, {}) of layer {}", chunkX, chunkY, layer.name);
+        return;
+    }
+
+    // 렌더러 텍스처와 정점 캐시 갱신
+    using Grid = EditorLayer::Grid;
+    int x0 = chunkX << Grid::CHUNK_SHIFT;
+    int y0 = chunkY << Grid::CHUNK_SHIFT;
+    int x1 = std::min(m_mapWidth, x0 + Grid::CHUNK_SIZE);
+    int y1 = std::min(m_mapHeight, y0 + Grid::CHUNK_SIZE);
+    layer.invalidate({{x0, y0}, {x1 - x0, y1 - y0}});
+}
+
+void Editor::loadPendingChunks(EditorLayer& layer, const sf::IntRect& tileRect) {
+    if (layer.pendingCount == 0) return;
+    int x0 = std::max(0, tileRect.position.x) >> EditorLayer::Grid::CHUNK_SHIFT;
+    int y0 = std::max(0, tileRect.position.y) >> EditorLayer::Grid::CHUNK_SHIFT;
+    int x1 = std::min(m_mapWidth, tileRect.position.x + tileRect.size.x) - 1;
+    int y1 = std::min(m_mapHeight, tileRect.position.y + tileRect.size.y) - 1;
+    if (x1 < 0 || y1 < 0) return;
+    for (int cy = y0; cy <= (y1 >> EditorLayer::Grid::CHUNK_SHIFT); ++cy) {
+        for (int cx = x0; cx <= (x1 >> EditorLayer::Grid::CHUNK_SHIFT); ++cx) {
+            loadPendingChunk(layer, cx, cy);
+        }
+    }
+}
+
+void Editor::loadAllPendingChunks() {
+    for (auto& layer : m_layers) {
+        loadPendingChunks(layer, {{0, 0}, {m_mapWidth, m_mapHeight}});
+    }
+    m_projectReader.close();
+}
+
+void Editor::streamPendingChunks(sf::Time budget) {
+    if (!m_projectReader.isOpen()) return;
+    if (!hasPendingChunks()) {
+        m_projectReader.close();
+        return;
+    }
+
+    // 보이는 레이어의 화면 안 청크는 예산과 상관없이 바로 읽음 (축소판으로 볼 때는 맵 전체일 수 있으므로 예산 안에서만)
+    if (!isLodActive()) {
+        sf::IntRect visible = getVisibleTileRect();
+        for (auto& layer : m_layers) {
+            if (layer.visible) loadPendingChunks(layer, visible);
+        }
+    }
+
+    // 나머지는 예산 안에서 보이는 레이어부터
+    sf::Clock clock;
+    for (bool visiblePass : {true, false}) {
+        for (auto& layer : m_layers) {
+            if (layer.visible != visiblePass) continue;
+            int columns = layer.tiles.getChunkColumns();
+            while (layer.pendingCount > 0 && clock.getElapsedTime() < budget) {
+                while (layer.pendingChunks[layer.pendingCursor].size == 0) ++layer.pendingCursor;
+                int index = static_cast<int>(layer.pendingCursor);
+                loadPendingChunk(layer, index % columns, index / columns);
+            }
+        }
+    }
+}
+
+bool Editor::hasPendingChunks() const {
+    return std::any_of(m_layers.begin(), m_layers.end(), [](const EditorLayer& layer) { return layer.pendingCount > 0; });
+}
+
+void Editor::startSave(const std::string& filename, bool autosave, uint64_t journalId, uint64_t journalSeq) {
+    Saver::Snapshot snapshot;
+    snapshot.path = filename;
+    snapshot.autosave = autosave;
+    ProjectFile::Info& info = snapshot.info;
+    info.gridSize = static_cast<uint16_t>(m_gridSize);
+    info.width = static_cast<uint32_t>(m_mapWidth);
+    info.height = static_cast<uint32_t>(m_mapHeight);
+    info.journalId = journalId;
+    info.journalSeq = journalSeq;
+    info.playerSpawn = m_playerSpawn;
+    info.enemySpawns = m_enemySpawns.positions();
+    for (const auto& layer : m_layers) {
+        info.layers.push_back({layer.name, layer.visible, {}});
+        snapshot.grids.push_back(layer.tiles);  // 청크 포인터만 복사 (이후 편집은 copy-on-write)
+    }
+
+    if (m_saver.isBusy()) {
+        // 진행 중인 저장이 끝나면 이어서 씀 (마지막 요청만 남김)
+        m_queuedSave = std::move(snapshot);
+        return;
+    }
+    m_saver.start(std::move(snapshot));
+}
+
+void Editor::pollSave() {
+    std::optional<Saver::Result> result = m_saver.poll();
+    bool ownJournal = result && result->journalId != 0 && result->journalId == m_journal.getId();
+    if (result && result->journalSeq != 0) {
+        // 저널 줄이기: 실패해도 저널에 모든 기록이 남아 있음
+        if (!result->success) {
+            LOG_WARN("Failed to compact journal into: {}", result->path);
+        } else if (ownJournal && m_journal.finishCompaction(result->journalSeq)) {
+            LOG_INFO("Compacted journal into: {} ({} ms)", result->path, result->milliseconds);
+        }
+    } else if (result) {
+        if (!result->success) {
+            LOG_ERROR("Failed to save: {}", result->path);
+            if (!result->autosave && result->path == m_currentFilename) m_hasUnsavedChanges = true;
+            if (ownJournal) m_journal.close();  // 짝이 되는 파일이 없으므로 다음 저장 때 전체를 씀
+        } else if (result->autosave) {
+            LOG_INFO("Autosaved: {} ({} ms)", result->path, result->milliseconds);
+        } else {
+            LOG_INFO("Saved: {} ({} ms)", result->path, result->milliseconds);
+            // 수동 저장이 끝나면 그 파일의 자동 저장본은 필요 없음
+            if (result->path == m_currentFilename) {
+                std::error_code error;
+                std::filesystem::remove(getAutosavePath(), error);
+            }
+        }
+    }
+
+    if (m_queuedSave && !m_saver.isBusy()) {
+        m_saver.start(std::move(*m_queuedSave));
+        m_queuedSave.reset();
+    }
+}
+
+void Editor::finishSaves() {
+    while (m_saver.isBusy() || m_queuedSave) {
+        m_saver.wait();
+        pollSave();
+    }
+}
+
+void Editor::updateAutosave() {
+    // 저널이 열려 있으면 편집마다 이미 기록됨
+    if (m_autosaveEdits == 0 || !m_hasUnsavedChanges || m_journal.isOpen()) return;
+    // 지연 로딩 중인 청크는 스냅샷에 없으므로 다 읽은 뒤에 저장
+    if (m_saver.isBusy() || m_queuedSave || hasPendingChunks()) return;
+    if (m_autosaveEdits < AUTOSAVE_EDIT_COUNT && m_autosaveClock.getElapsedTime().asSeconds() < AUTOSAVE_INTERVAL_SECONDS) return;
+
+    startSave(getAutosavePath(), true, 0, 0);
+    m_autosaveEdits = 0;
+}
+
+void Editor::noteEdit() {
+    if (m_autosaveEdits++ == 0) m_autosaveClock.restart();
+}
+
+std::string Editor::getAutosavePath() const {
+    std::filesystem::path path = m_currentFilename.empty() ? "untitled" : m_currentFilename;
+    path.replace_extension(".autosave.tmproj");
+    return path.string();
+}
+
+namespace {
+// 스트로크 구간이 걸친 청크 좌표 (중복 없이, 행 우선)
+std::vector<sf::Vector2i> strokeChunks(const EditorHistory::Stroke& stroke, int chunkColumns) {
+    using Grid = EditorLayer::Grid;
+    std::vector<uint32_t> keys;
+    uint32_t width = static_cast<uint32_t>(stroke.width);
+    auto addRow = [&](uint32_t y, uint32_t x0, uint32_t x1) {
+        for (uint32_t cx = x0 >> Grid::CHUNK_SHIFT; cx <= (x1 >> Grid::CHUNK_SHIFT); ++cx) {
+            keys.push_back((y >> Grid::CHUNK_SHIFT) * static_cast<uint32_t>(chunkColumns) + cx);
+        }
+    };
+    for (const auto& run : stroke.runs) {
+        uint32_t last = run.start + run.length - 1;
+        uint32_t y0 = run.start / width;
+        uint32_t y1 = last / width;
+        if (y0 == y1) {
+            addRow(y0, run.start % width, last % width);
+            continue;
+        }
+        addRow(y0, run.start % width, width - 1);
+        addRow(y1, 0, last % width);
+        // 가운데 줄들은 한 줄 전체이므로 청크 행 단위로
+        for (uint32_t y = y0 + 1; y < y1; y = ((y >> Grid::CHUNK_SHIFT) + 1) << Grid::CHUNK_SHIFT) {
+            addRow(y, 0, width - 1);
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    std::vector<sf::Vector2i> chunks;
+    chunks.reserve(keys.size());
+    for (uint32_t key : keys) {
+        chunks.push_back({static_cast<int>(key % static_cast<uint32_t>(chunkColumns)),
+                          static_cast<int>(key / static_cast<uint32_t>(chunkColumns))});
+    }
+    return chunks;
+}
+}
+
+// 스폰은 적용이 끝난 현재 상태를 통째로 남김 (저널 재생은 스트로크 기록 없이 순서대로 덮어씀)
+void Editor::journalStroke(const EditorHistory::Stroke& stroke) {
+    if (!m_journal.isOpen()) return;
+    if (stroke.layerIndex < 0 || stroke.layerIndex >= static_cast<int>(m_layers.size())) return;
+
+    const EditorLayer& layer = m_layers[stroke.layerIndex];
+    std::vector<sf::Vector2i> chunks;
+    if (stroke.width > 0) chunks = strokeChunks(stroke, layer.tiles.getChunkColumns());
+    if (!m_journal.appendStroke(stroke.layerIndex, layer.tiles, chunks, stroke.spawnsChanged, m_playerSpawn,
+                                m_enemySpawns.positions())) {
+        LOG_ERROR("Failed to write journal: {}", m_currentFilename);
+    }
+}
+
+void Editor::applyJournalRecord(const ProjectJournal<EditorTile>::Record& record) {
+    using RecordType = ProjectJournal<EditorTile>::RecordType;
+    switch (record.type) {
+        case RecordType::Stroke: {
+            if (record.layer < m_layers.size()) {
+                EditorLayer& layer = m_layers[record.layer];
+                EditorLayer::Grid::Chunk chunk;
+                for (const auto& chunkData : record.chunks) {
+                    if (chunkData.chunkX >= layer.tiles.getChunkColumns() || chunkData.chunkY >= layer.tiles.getChunkRows() ||
+                        !ProjectJournal<EditorTile>::decodeChunk(chunkData, chunk)) {
+                        LOG_WARN("Skipping bad journal chunk ({}, {})", chunkData.chunkX, chunkData.chunkY);
+                        continue;
+                    }
+                    replaceChunk(layer, chunkData.chunkX, chunkData.chunkY, chunk);
+                }
+            }
+            if (record.hasSpawns) {
+                m_playerSpawn = record.playerSpawn;
+                m_enemySpawns.assign(record.enemySpawns);
+            }
+            break;
+        }
+        case RecordType::RemoveLayer:
+            removeLayer(record.layer);
+            break;
+        case RecordType::Resize:
+            resizeMap(static_cast<int>(record.width), static_cast<int>(record.height));
+            break;
+        case RecordType::Save:
+            break;
+    }
+}
+
+void Editor::replaceChunk(EditorLayer& layer, int chunkX, int chunkY, const EditorLayer::Grid::Chunk& chunk) {
+    // 청크 전체를 덮어쓰므로 파일의 원래 내용은 읽을 필요 없음
+    takePendingChunk(layer, chunkX, chunkY);
+
+    using Grid = EditorLayer::Grid;
+    int x0 = chunkX << Grid::CHUNK_SHIFT;
+    int y0 = chunkY << Grid::CHUNK_SHIFT;
+    int x1 = std::min(m_mapWidth, x0 + Grid::CHUNK_SIZE);
+    int y1 = std::min(m_mapHeight, y0 + Grid::CHUNK_SIZE);
+    for (int y = y0; y < y1; ++y) {
+        const EditorTile* row = &chunk.cells[static_cast<size_t>(y - y0) << Grid::CHUNK_SHIFT];
+        for (int x = x0; x < x1;) {
+            int end = x + 1;
+            while (end < x1 && row[end - x0] == row[x - x0]) ++end;
+            layer.fillRow(y, x, end, row[x - x0]);
+            x = end;
+        }
+    }
+}
+
+void Editor::compactJournalIfNeeded() {
+    // 지연 로딩 중인 청크는 스냅샷에 없으므로 다 읽은 뒤에
+    if (!m_journal.isOpen() || m_saver.isBusy() || m_queuedSave || hasPendingChunks()) return;
+
+    std::error_code error;
+    uintmax_t baseSize = std::filesystem::file_size(m_currentFilename, error);
+    if (error) return;
+    uint64_t journalSize = m_journal.getSize();
+    if (journalSize < JOURNAL_COMPACT_MIN_BYTES || journalSize < baseSize / 2) return;
+
+    startSave(m_currentFilename, false, m_journal.getId(), m_journal.beginCompaction());
+}
+
+void Editor::closeJournal() {
+    m_journal.discardUnsaved();
+    m_journal.close();
+}
+
+void Editor::saveWithDialog() {
+    std::string path = openSaveFileDialog(defaultFileName(m_currentFilename, ".tmproj"), ".tmproj");
+    if (!path.empty()) {
+        saveProject(path);
+    }
+}
+
+void Editor::exportWithDialog() {
+    std::string path = openSaveFileDialog(defaultFileName(m_currentFilename, ".tilemap"), ".tilemap");
+    if (!path.empty()) {
+        exportMap(path);
+    }
+}
+
+void Editor::loadWithDialog() {
+    std::string path = openLoadFileDialog();
+    if (!path.empty()) {
+        loadMap(path);
+    }
 }
@@ -1,9 +1,22 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "TileIndexRenderer.hpp"
+#include "Minimap.hpp"
+#include "ProfilerOverlay.hpp"
+#include "InputState.hpp"
+#include "TileChunkGrid.hpp"
+#include "EditHistory.hpp"
+#include "SpawnIndex.hpp"
+#include "ProjectFile.hpp"
+#include "ProjectSaver.hpp"
+#include "ProjectJournal.hpp"
+#include "FlatMapFile.hpp"
 #include <vector>
 #include <string>
 #include <functional>
+#include <algorithm>
+#include <optional>
 
 // 타일 타입 (게임의 TileMap과 동일)
 enum class TileType : uint8_t {
@@ -31,31 +44,145 @@ enum class EditorTool {
     Eraser,
     PlayerSpawn,
     EnemySpawn,
-    CollisionShape  // 충돌 형태 설정 도구
+    CollisionShape,  // 충돌 형태 설정 도구
+    Rect,            // 드래그한 사각형 채우기 (우클릭 드래그: 지우기)
+    Fill,            // 같은 타일로 이어진 영역 채우기 (우클릭: 지우기)
+    Stamp            // 우클릭 드래그로 영역 복사, 좌클릭으로 붙여넣기
 };
 
 // 개별 타일 데이터
 struct EditorTile {
     TileType type = TileType::Empty;
     CollisionShape shape = CollisionShape::None;
+
+    bool operator==(const EditorTile& other) const { return type == other.type && shape == other.shape; }
+    bool operator!=(const EditorTile& other) const { return !(*this == other); }
+};
+
+using EditorHistory = EditHistory<EditorTile>;
+
+// 복사한 타일 영역 (스탬프)
+struct EditorStamp {
+    int width = 0;
+    int height = 0;
+    std::vector<EditorTile> tiles;  // 행 우선
+
+    bool empty() const { return tiles.empty(); }
+};
+
+// 청크 하나의 캐시된 정점 (타일 사각형, 충돌 오버레이)
+// 청크 안의 타일이 바뀌었을 때만 다시 만듦
+struct EditorChunkMesh {
+    sf::VertexArray tiles{sf::PrimitiveType::Triangles};    // 셰이더를 못 쓸 때의 타일 사각형
+    sf::VertexArray overlay{sf::PrimitiveType::Triangles};  // 충돌 형태 오버레이
+    bool tilesDirty = true;
+    bool overlayDirty = true;
 };
 
 // 레이어 정보
 struct EditorLayer {
+    using Grid = TileChunkGrid<EditorTile>;
+
     std::string name;
     bool visible = true;
-    std::vector<std::vector<EditorTile>> tiles;
+    Grid tiles;  // 64x64 청크 단위 (빈 청크는 할당 안 함)
+    TileIndexRenderer renderer;  // 셰이더 렌더링용 인덱스 텍스처 (CPU 텍셀 없음, 보이는 페이지만 tiles에서 채움)
+    std::vector<EditorChunkMesh> meshes;  // 청크별 정점 캐시 (tiles의 청크와 같은 순서)
+    Minimap* minimap = nullptr;  // 바뀐 영역을 알릴 미니맵 (에디터의 것, 보이는 레이어를 합쳐서 그림)
+
+    // 프로젝트 파일에서 아직 읽지 않은 청크 (tiles의 청크와 같은 순서, size 0 = 읽을 것 없음)
+    std::vector<ProjectFile::ChunkEntry> pendingChunks;
+    size_t pendingCount = 0;
+    size_t pendingCursor = 0;  // 백그라운드로 읽을 다음 위치
+
+    // .tilemap을 가져오기 전에 메모리 상한을 확인할 때 쓰는 격자 크기
+    static FlatMapFile::GridCost gridCost() {
+        return {Grid::CHUNK_SHIFT, sizeof(Grid::Chunk), sizeof(std::shared_ptr<Grid::Chunk>) + sizeof(EditorChunkMesh)};
+    }
+
+    bool isPending(int chunkX, int chunkY) const {
+        return pendingCount > 0 && pendingChunks[static_cast<size_t>(chunkY) * tiles.getChunkColumns() + chunkX].size != 0;
+    }
 
     EditorLayer(const std::string& layerName, int width, int height)
         : name(layerName)
+        , tiles(width, height)
+        , meshes(static_cast<size_t>(tiles.getChunkColumns()) * tiles.getChunkRows())
     {
-        tiles.resize(height, std::vector<EditorTile>(width));
+        renderer.setTileColors(static_cast<uint8_t>(TileType::Solid), tileColor(TileType::Solid));
+        renderer.setTileColors(static_cast<uint8_t>(TileType::Platform), tileColor(TileType::Platform));
+        renderer.setGap(1.f);
+        renderer.resize(static_cast<unsigned int>(width), static_cast<unsigned int>(height));
+    }
+
+    static sf::Color tileColor(TileType type) {
+        switch (type) {
+            case TileType::Solid: return {80, 60, 40};
+            case TileType::Platform: return {60, 100, 60};
+            default: return sf::Color::Transparent;
+        }
     }
 
     void resize(int width, int height) {
-        tiles.resize(height);
-        for (auto& row : tiles) {
-            row.resize(width);
+        tiles.resize(width, height);
+        meshes.clear();
+        meshes.resize(static_cast<size_t>(tiles.getChunkColumns()) * tiles.getChunkRows());
+        renderer.resize(static_cast<unsigned int>(width), static_cast<unsigned int>(height));
+    }
+
+    // 렌더러가 업로드할 때 읽을 소스 (레이어가 vector 안에서 옮겨지므로 그리기 직전에 연결)
+    void bindRendererSource() {
+        renderer.setSource([this](int y, int x0, int x1, std::uint8_t* out) {
+            std::fill(out, out + static_cast<size_t>(x1 - x0) * 4u, std::uint8_t{0});
+            tiles.forEachRowRun(y, x0, x1, [&](int start, int end, const EditorTile& tile) {
+                // 가져온 파일의 모르는 타입은 빈 칸으로 올림
+                if (tile == EditorTile{} || static_cast<int>(tile.type) >= TileIndexRenderer::MAX_TILE_TYPES) return;
+                for (int x = start; x < end; ++x) {
+                    std::uint8_t* texel = out + static_cast<size_t>(x - x0) * 4u;
+                    texel[0] = static_cast<uint8_t>(tile.type);
+                    texel[1] = static_cast<uint8_t>(tile.shape);
+                }
+            });
+        });
+    }
+
+    // y 줄의 [x0, x1) 칸을 같은 타일로 채움 (렌더러/캐시 무효화 포함)
+    void fillRow(int y, int x0, int x1, const EditorTile& tile) {
+        x0 = std::max(0, x0);
+        x1 = std::min(tiles.getWidth(), x1);
+        if (y < 0 || y >= tiles.getHeight() || x0 >= x1) return;
+        tiles.fillRow(y, x0, x1, tile);
+        invalidate({{x0, y}, {x1 - x0, 1}});
+    }
+
+    EditorChunkMesh& meshAt(int chunkX, int chunkY) {
+        return meshes[static_cast<size_t>(chunkY) * tiles.getChunkColumns() + chunkX];
+    }
+
+    // 타일 영역이 바뀜 -> 렌더러 텍스처와 겹치는 청크의 정점 캐시 무효화
+    void invalidate(const sf::IntRect& rect) {
+        int x0 = std::max(0, rect.position.x) >> Grid::CHUNK_SHIFT;
+        int y0 = std::max(0, rect.position.y) >> Grid::CHUNK_SHIFT;
+        int x1 = std::min(tiles.getWidth(), rect.position.x + rect.size.x) - 1;
+        int y1 = std::min(tiles.getHeight(), rect.position.y + rect.size.y) - 1;
+        if (x1 < 0 || y1 < 0) return;
+        renderer.markDirty(rect);
+        if (minimap) minimap->markDirty(rect);
+        for (int cy = y0; cy <= (y1 >> Grid::CHUNK_SHIFT); ++cy) {
+            for (int cx = x0; cx <= (x1 >> Grid::CHUNK_SHIFT); ++cx) {
+                EditorChunkMesh& mesh = meshAt(cx, cy);
+                mesh.tilesDirty = true;
+                mesh.overlayDirty = true;
+            }
+        }
+    }
+
+    void invalidateAll() {
+        renderer.markAllDirty();
+        if (minimap) minimap->markAllDirty();
+        for (auto& mesh : meshes) {
+            mesh.tilesDirty = true;
+            mesh.overlayDirty = true;
         }
     }
 };
@@ -63,25 +190,84 @@ struct EditorLayer {
 class Editor {
 public:
     Editor(unsigned int windowWidth, unsigned int windowHeight);
+    // 창 없이 주어진 타겟(RenderTexture 등)에 그리는 헤드리스 에디터 (벤치마크용, run은 사용 불가)
+    explicit Editor(sf::RenderTarget& target);
 
     void run();
 
+    // 맵 조작
+    void setTile(int x, int y, TileType type);
+    void setTileShape(int x, int y, CollisionShape shape);
+    TileType getTile(int x, int y) const;
+    CollisionShape getTileShape(int x, int y) const;
+    void resizeMap(int newWidth, int newHeight);
+
+    // 영역 편집 (현재 레이어, 줄 구간 단위로 채움, 큰 영역은 작업 스레드로 나눔)
+    // 마우스 스트로크 밖에서 부르면 호출 하나가 실행 취소 단위 하나
+    void fillRect(const sf::IntRect& rect, const EditorTile& tile);
+    void floodFill(int x, int y, const EditorTile& tile);  // (x, y)와 같은 타일로 4방향 연결된 영역
+    void copyRegion(const sf::IntRect& rect);               // 영역을 스탬프로 복사
+    void pasteStamp(int x, int y);                          // 스탬프 왼쪽 위를 (x, y)에 맞춰 붙여넣기
+    const EditorStamp& getStamp() const { return m_stamp; }
+
+    // 카메라 (줌은 0.25 ~ 맵 전체가 보이는 정도까지, 타일이 LOD_MAX_TILE_PIXELS보다 작아지면 축소판으로 그림)
+    void setCamera(sf::Vector2f center, float zoom);
+    float getMaxZoom() const;
+    bool isLodActive() const;
+    void setCollisionOverlayVisible(bool visible) { m_showCollisionOverlay = visible; }
+
+    // 맵 캔버스 렌더링 단계 (헤드리스에서 단계별로 그릴 때 beginMapRender로 맵 뷰부터 설정)
+    void beginMapRender();
+    void renderGrid();
+    void renderTiles();
+    void renderCollisionOverlay();  // 충돌 오버레이 렌더링
+    void renderMinimap();           // 캔버스 오른쪽 아래 미니맵 (UI 뷰에서, 크기/스폰이 바뀌었으면 먼저 맞춤)
+    const Minimap& getMinimap() const { return m_minimap; }
+
 private:
+    void initialize(unsigned int windowWidth, unsigned int windowHeight);
+
     // 이벤트 처리
     void handleEvents();
     void handleMouseClick(sf::Vector2i mousePos, bool isLeftButton);
     void handleMouseDrag(sf::Vector2i mousePos, bool isLeftButton);
+    void handleMouseRelease(sf::Vector2i mousePos, bool isLeftButton);
     void handleKeyPress(sf::Keyboard::Key key);
+    bool isCommandDown() const;  // Ctrl 또는 Cmd
+
+    // 실행 취소/다시 실행 (마우스를 누르고 뗄 때까지가 스트로크 하나)
+    void beginStroke();
+    void endStroke();
+    void undo();
+    void redo();
+    void applyStroke(const EditorHistory::Stroke& stroke, bool useOldState);
+
+    // 브러시 (크기 x 크기 정사각형, Empty면 스폰도 지움)
+    void paintBrush(int x, int y, TileType type);
+    void eraseSpawnsIn(const sf::IntRect& rect);
+    sf::IntRect getDragRect(sf::Vector2i currentTile) const;  // 드래그 시작 타일 ~ currentTile (맵 안으로 자름)
+    // 영역 편집 공통: area의 줄마다 rowEdit(y, runs)가 그리드를 바꾸고 바뀐 구간을 runs에 넣음
+    // 청크 높이 단위 줄 묶음이 서로 다른 스레드에서 돌 수 있음 (같은 청크를 두 스레드가 건드리지 않음)
+    using RowEdit = std::function<void(int, std::vector<EditorHistory::Run>&)>;
+    void applyRowEdits(const sf::IntRect& area, const RowEdit& rowEdit);
+    // 그리드에 이미 적용한 구간을 렌더러/정점 캐시/실행 취소 기록에 반영
+    void commitRuns(const std::vector<EditorHistory::Run>& runs);
 
     // 업데이트
     void update(float deltaTime);
 
     // 렌더링
     void render();
-    void renderGrid();
-    void renderTiles();
-    void renderCollisionOverlay();  // 충돌 오버레이 렌더링
+    void rebuildGrid(int visibleX0, int visibleY0, int visibleX1, int visibleY1);
+    void rebuildTileMesh(EditorLayer& layer, int chunkX, int chunkY);
+    void rebuildOverlayMesh(EditorLayer& layer, int chunkX, int chunkY);
+    // 보이는 청크마다 f(chunkX, chunkY) (타일이 없는 청크는 건너뜀)
+    void forEachVisibleChunk(EditorLayer& layer, const std::function<void(int, int)>& f);
     void renderSpawns();
+    void rebuildSpawnMesh(const sf::IntRect& visible);
+    void renderSelection();  // 사각형/스탬프 드래그 영역 미리보기
+    Minimap::Occupancy countMinimapBlock(const sf::IntRect& rect) const;  // 보이는 레이어 합산
+    bool moveCameraToMinimap(sf::Vector2i mousePos);  // 미니맵 위면 그 위치로 카메라 이동
     void renderUI();
     void renderToolbar();
     void renderLayerPanel();
@@ -92,13 +278,7 @@ private:
     // UI 상호작용
     bool isMouseOverUI(sf::Vector2i mousePos) const;
     sf::Vector2i screenToTile(sf::Vector2i screenPos) const;
-
-    // 맵 조작
-    void setTile(int x, int y, TileType type);
-    void setTileShape(int x, int y, CollisionShape shape);
-    TileType getTile(int x, int y) const;
-    CollisionShape getTileShape(int x, int y) const;
-    void resizeMap(int newWidth, int newHeight);
+    sf::IntRect getVisibleTileRect() const;  // 맵 뷰에 보이는 타일 범위
 
     // 레이어 조작
     void addLayer(const std::string& name);
@@ -106,18 +286,58 @@ private:
     void selectLayer(int index);
 
     // 파일 조작
+    // 프로젝트(.tmproj)는 레이어를 그대로 저장하고, 내보내기(.tilemap)는 보이는 레이어를 합친 게임용 맵
     void newMap();
-    void saveMap(const std::string& filename);
-    void loadMap(const std::string& filename);
+    void saveProject(const std::string& filename);
+    void loadMap(const std::string& filename);      // 파일 앞부분을 보고 프로젝트 / .tilemap 구분
+    void loadProject(const std::string& filename);
+    void importMap(const std::string& filename);    // .tilemap -> 레이어 하나
+    void exportMap(const std::string& filename);
+    void saveWithDialog();
+    void exportWithDialog();
+    void loadWithDialog();
+
+    // 백그라운드 저장 / 자동 저장
+    // 저장 요청 시 UI 스레드에서는 청크 포인터만 복사한 스냅샷을 만들고 파일 쓰기는 작업 스레드가 함
+    // 자동 저장은 편집 후 일정 시간이 지나거나 편집이 많이 쌓이면 <파일명>.autosave.tmproj에 씀
+    void startSave(const std::string& filename, bool autosave, uint64_t journalId, uint64_t journalSeq);
+    void pollSave();
+    void finishSaves();   // 진행 중/대기 중인 저장을 모두 끝냄 (종료, 다른 파일 열기 전)
+    void updateAutosave();
+    void noteEdit();      // 자동 저장용 편집 횟수 증가
+    std::string getAutosavePath() const;
+
+    // 편집 저널 (프로젝트 파일 옆 .journal)
+    // 스트로크마다 바뀐 청크를 덧붙이고, 같은 파일에 다시 저장할 때는 저장 지점만 기록함
+    // 저널이 커지면 저장할 때 프로젝트 파일을 백그라운드로 새로 써서 저널을 줄임
+    void journalStroke(const EditorHistory::Stroke& stroke);
+    void applyJournalRecord(const ProjectJournal<EditorTile>::Record& record);
+    void compactJournalIfNeeded();
+    void closeJournal();  // 저장하지 않은 기록은 버리고 닫음
+    void replaceChunk(EditorLayer& layer, int chunkX, int chunkY, const EditorLayer::Grid::Chunk& chunk);
+
+    // 프로젝트 청크 지연 로딩
+    // 열 때는 보이는 레이어의 화면 안 청크만 읽고, 나머지는 프레임마다 시간 예산만큼 읽음
+    // 아직 읽지 않은 청크를 편집/저장하려 하면 그 자리에서 먼저 읽음
+    void loadPendingChunk(EditorLayer& layer, int chunkX, int chunkY);
+    ProjectFile::ChunkEntry takePendingChunk(EditorLayer& layer, int chunkX, int chunkY);  // 읽지 않고 목록에서만 뺌
+    void loadPendingChunks(EditorLayer& layer, const sf::IntRect& tileRect);
+    void loadAllPendingChunks();
+    void streamPendingChunks(sf::Time budget);
+    bool hasPendingChunks() const;
 
     // 윈도우 및 뷰
     sf::RenderWindow m_window;
+    sf::RenderTarget& m_target;  // 그리는 대상 (보통 m_window, 헤드리스면 외부 타겟)
     sf::View m_mapView;      // 맵 캔버스 뷰
     sf::View m_uiView;       // UI 뷰 (고정)
 
     // 폰트
     sf::Font m_font;
 
+    // 프로파일러 오버레이 (F3: 표시 전환, F4: Chrome trace 저장)
+    ProfilerOverlay m_profilerOverlay;
+
     // 맵 설정
     int m_gridSize = 32;
     int m_mapWidth = 60;
@@ -132,20 +352,69 @@ private:
     TileType m_currentTileType = TileType::Solid;
     CollisionShape m_currentCollisionShape = CollisionShape::Full;  // 현재 선택된 충돌 형태
     bool m_showCollisionOverlay = true;  // 충돌 오버레이 표시 여부
+    static constexpr int MAX_BRUSH_SIZE = 32;
+    int m_brushSize = 1;  // [ ] 키로 조절
+    EditorStamp m_stamp;
 
     // 스폰 위치
     sf::Vector2i m_playerSpawn = {-1, -1};
-    std::vector<sf::Vector2i> m_enemySpawns;
+    SpawnIndex m_enemySpawns;  // 타일 좌표로 O(1) 추가/삭제/조회
+
+    // 스폰 정점 캐시 (보이는 범위 주변만, 마커 한 묶음 + 글자 한 묶음)
+    static constexpr unsigned int SPAWN_LABEL_SIZE = 16;
+    static constexpr float SPAWN_DETAIL_MIN_PIXELS = 12.f;  // 타일이 화면에서 이보다 작으면 사각형 마커만
+    static constexpr int SPAWN_CACHE_ALIGN = 32;
+    struct SpawnCache {
+        sf::IntRect area;
+        uint64_t revision = ~0ull;
+        sf::Vector2i playerSpawn;
+        float zoom = 0.f;
+        int gridSize = 0;
+    };
+    sf::VertexArray m_spawnMarkers{sf::PrimitiveType::Triangles};
+    sf::VertexArray m_spawnLabels{sf::PrimitiveType::Triangles};
+    SpawnCache m_spawnCache;
+
+    // 미니맵 (레이어가 바뀐 블록만 다시 셈, 클릭/드래그로 카메라 이동)
+    static constexpr float MINIMAP_SIZE = 180.f;
+    static constexpr float MINIMAP_MARGIN = 10.f;
+    Minimap m_minimap;
+    uint64_t m_minimapSpawnRevision = ~0ull;
+    sf::Vector2i m_minimapPlayerSpawn = {-1, -1};
+    bool m_minimapDragging = false;
 
     // 카메라
     sf::Vector2f m_cameraPos = {0.f, 0.f};
     float m_zoom = 1.f;
     sf::Vector2f m_defaultViewSize;  // 초기 뷰 크기 저장
 
+    // 그리드 정점 캐시 (LOD 적용, 보이는 범위 주변만)
+    static constexpr float GRID_MIN_SPACING = 8.f;  // 화면에서 선 사이 최소 간격 (픽셀)
+    static constexpr float LOD_MAX_TILE_PIXELS = 4.f;  // 타일이 화면에서 이보다 작으면 인덱스 페이지를 팔레트 색만으로 그림
+    static constexpr float MIN_ZOOM = 0.25f;
+    static constexpr float MAX_ZOOM_MARGIN = 1.25f;  // 최대 줌에서 맵 바깥으로 보이는 여유
+    static constexpr int GRID_CACHE_ALIGN = 16;      // 캐시 범위 정렬 단위 (선 간격의 배수)
+    struct GridCache {
+        int x0 = 0, y0 = 0, x1 = -1, y1 = -1;  // 정점을 만든 타일 범위
+        float zoom = 0.f;
+        int gridSize = 0;
+        sf::Vector2i mapSize;
+    };
+    sf::VertexArray m_gridVertices{sf::PrimitiveType::Triangles};
+    GridCache m_gridCache;
+
+    // 편집 기록 (Ctrl+Z 실행 취소, Ctrl+Shift+Z / Ctrl+Y 다시 실행)
+    EditorHistory m_history;
+
+    // 키보드 상태 (이벤트로만 갱신, update에서 OS 호출 없음)
+    InputState m_input;
+
     // 마우스 상태
     bool m_isDragging = false;
     sf::Vector2i m_lastMousePos;
     sf::Vector2i m_currentMousePos;  // 현재 마우스 위치 (화면 좌표)
+    sf::Vector2i m_dragStartTile = {-1, -1};  // 사각형/스탬프 선택 시작 타일 (-1 = 선택 중 아님)
+    bool m_dragStartLeft = true;
 
     // UI 영역
     sf::FloatRect m_toolbarRect;
@@ -155,6 +424,23 @@ private:
     sf::FloatRect m_mapSettingsRect;
     sf::FloatRect m_canvasRect;
 
+    // 지연 로딩 중인 프로젝트 파일 (읽을 청크가 남아 있는 동안만 열려 있음)
+    ProjectFile::Reader m_projectReader;
+    static constexpr float CHUNK_STREAM_BUDGET_MS = 4.f;  // 프레임당 백그라운드 청크 읽기 시간
+
+    // 백그라운드 저장
+    using Saver = ProjectSaver<EditorTile>;
+    Saver m_saver;
+    std::optional<Saver::Snapshot> m_queuedSave;  // 저장 중에 요청된 수동 저장
+    sf::Clock m_autosaveClock;                    // 마지막 자동 저장 이후 첫 편집부터
+    int m_autosaveEdits = 0;                      // 마지막 저장 이후 편집 횟수
+    static constexpr float AUTOSAVE_INTERVAL_SECONDS = 60.f;
+    static constexpr int AUTOSAVE_EDIT_COUNT = 200;
+
+    // 편집 저널 (프로젝트를 열거나 저장한 뒤 열려 있음)
+    ProjectJournal<EditorTile> m_journal;
+    static constexpr uint64_t JOURNAL_COMPACT_MIN_BYTES = 8u * 1024u * 1024u;  // 이보다 작으면 줄이지 않음
+
     // 상태
     bool m_isRunning = true;
     std::string m_currentFilename;
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "BoundedReader.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <utility>
+#include <vector>
+
+// 에디터가 내보내고 가져오는 단일 레이어 .tilemap (게임의 TileMap::readFile과 같은 형식)
+//
+// 파일 구조:
+//   - Magic "TMAP" (4), Version (uint16_t), Grid Size (uint16_t), Width/Height (uint32_t)
+//   - Tile Count (uint32_t), Tiles: x(uint16_t) y(uint16_t) type(uint8_t) [shape(uint8_t), Version 2만]
+//   - Player Spawn (int32_t x, y, 타일 좌표), Enemy Count (uint32_t), Enemies: x(int32_t) y(int32_t) type(uint8_t)
+//
+// read는 믿을 수 없는 파일을 가정함: 개수는 할당 전에 남은 파일 크기로, 불러온 뒤 격자가 차지할
+// 메모리(청크 칸 표 + 타일이 있는 청크)는 메모리 상한으로 확인하고, 실패하면 contents는 그대로
+namespace FlatMapFile {
+
+constexpr char MAGIC[4] = {'T', 'M', 'A', 'P'};
+constexpr uint16_t VERSION = 2;    // Version 2: CollisionShape 추가
+constexpr uint16_t VERSION_1 = 1;  // 이전 버전 호환용
+constexpr uint32_t MAX_MAP_SIZE = 65536;  // 타일 좌표가 uint16_t
+
+constexpr uint8_t SHAPE_FULL = 1;      // CollisionShape::Full
+constexpr uint8_t SHAPE_PLATFORM = 8;  // CollisionShape::Platform
+constexpr uint8_t TYPE_PLATFORM = 2;   // TileType::Platform
+
+struct Tile {
+    uint16_t x = 0;
+    uint16_t y = 0;
+    uint8_t type = 0;
+    uint8_t shape = 0;
+};
+
+struct Spawn {
+    int32_t x = -1;
+    int32_t y = -1;
+};
+
+struct Contents {
+    uint16_t gridSize = 32;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    std::vector<Tile> tiles;  // 맵 안의 타일만, 파일 순서 (같은 칸이 다시 나오면 나중 것이 이김)
+    Spawn playerSpawn;
+    std::vector<Spawn> enemySpawns;  // 타일 좌표 그대로
+};
+
+// 불러온 맵을 담을 격자의 크기 (청크 한 변 = 1 << chunkShift)
+struct GridCost {
+    int chunkShift = 6;
+    size_t chunkBytes = 0;  // 타일이 있는 청크 하나
+    size_t slotBytes = 0;   // 청크 칸 하나 (빈 칸도 포인터, 정점 캐시 등을 들고 있음)
+};
+
+inline bool read(std::istream& stream, Contents& contents, const GridCost& cost, const LoadLimits& limits = {}) {
+    BoundedReader in(stream, limits);
+    Contents result;
+
+    // Header
+    char magic[4];
+    if (!in.readBytes(magic, 4) || !std::equal(magic, magic + 4, MAGIC)) return false;
+
+    uint16_t version;
+    if (!in.read(version) || (version != VERSION && version != VERSION_1)) return false;
+
+    if (!in.read(result.gridSize) || !in.read(result.width) || !in.read(result.height)) return false;
+    if (result.gridSize == 0) return false;
+    if (result.width == 0 || result.height == 0 || result.width > MAX_MAP_SIZE || result.height > MAX_MAP_SIZE) return false;
+
+    // 청크 칸 표는 파일 크기와 상관없이 맵 크기만큼 생김
+    uint64_t chunkMask = (uint64_t{1} << cost.chunkShift) - 1;
+    uint64_t columns = (result.width + chunkMask) >> cost.chunkShift;
+    uint64_t rows = (result.height + chunkMask) >> cost.chunkShift;
+    if (!in.charge(columns * rows, cost.slotBytes)) return false;
+
+    // Tiles
+    uint32_t tileCount;
+    if (!in.read(tileCount)) return false;
+    const size_t tileRecordSize = version == VERSION ? 6 : 5;
+    if (!in.reserve(tileCount, tileRecordSize, sizeof(Tile))) return false;
+    result.tiles.reserve(tileCount);
+
+    std::vector<bool> usedChunks(static_cast<size_t>(columns * rows));
+    uint64_t usedChunkCount = 0;
+    for (uint32_t i = 0; i < tileCount; ++i) {
+        Tile tile;
+        in.read(tile.x);
+        in.read(tile.y);
+        in.read(tile.type);
+
+        if (version == VERSION) {
+            in.read(tile.shape);
+        } else {
+            // Version 1: 타입에 따라 기본 CollisionShape 설정
+            tile.shape = tile.type == TYPE_PLATFORM ? SHAPE_PLATFORM : SHAPE_FULL;
+        }
+        if (tile.x >= result.width || tile.y >= result.height) continue;
+
+        size_t chunk = static_cast<size_t>((tile.y >> cost.chunkShift) * columns + (tile.x >> cost.chunkShift));
+        if (!usedChunks[chunk]) {
+            usedChunks[chunk] = true;
+            ++usedChunkCount;
+        }
+        result.tiles.push_back(tile);
+    }
+    if (!in.charge(usedChunkCount, cost.chunkBytes)) return false;
+
+    // Spawns
+    uint32_t enemyCount;
+    if (!in.read(result.playerSpawn.x) || !in.read(result.playerSpawn.y) || !in.read(enemyCount)) return false;
+    constexpr size_t ENEMY_RECORD_SIZE = sizeof(int32_t) * 2 + sizeof(uint8_t);
+    if (!in.reserve(enemyCount, ENEMY_RECORD_SIZE, sizeof(Spawn))) return false;
+    result.enemySpawns.resize(enemyCount);
+    for (Spawn& spawn : result.enemySpawns) {
+        uint8_t enemyType;
+        in.read(spawn.x);
+        in.read(spawn.y);
+        in.read(enemyType);
+    }
+    if (in.failed()) return false;
+
+    contents = std::move(result);
+    return true;
+}
+
+} // namespace FlatMapFile
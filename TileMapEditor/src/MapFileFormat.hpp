@@ -1,5 +1,7 @@
 #pragma once
 
+#include "BoundedReader.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -137,48 +139,51 @@ struct MapData {
         return true;
     }
 
-    bool loadFromFile(const std::string& filename) {
+    // 실패하면(잘린 파일, 개수가 파일 크기나 메모리 상한을 넘음) 기존 내용은 그대로
+    bool loadFromFile(const std::string& filename, const LoadLimits& limits = {}) {
         std::ifstream file(filename, std::ios::binary);
         if (!file.is_open()) return false;
+        return loadFromStream(file, limits);
+    }
+
+    bool loadFromStream(std::istream& stream, const LoadLimits& limits = {}) {
+        BoundedReader in(stream, limits);
+        MapData data;
 
         // Header
         char magic[4];
-        file.read(magic, 4);
-        if (magic[0] != MAGIC[0] || magic[1] != MAGIC[1] ||
-            magic[2] != MAGIC[2] || magic[3] != MAGIC[3]) {
-            return false;
-        }
+        if (!in.readBytes(magic, 4) || !std::equal(magic, magic + 4, MAGIC)) return false;
 
         uint16_t version;
-        file.read(reinterpret_cast<char*>(&version), sizeof(version));
-        if (version != VERSION && version != VERSION_1) return false;
+        if (!in.read(version) || (version != VERSION && version != VERSION_1)) return false;
 
-        file.read(reinterpret_cast<char*>(&gridSize), sizeof(gridSize));
-        file.read(reinterpret_cast<char*>(&width), sizeof(width));
-        file.read(reinterpret_cast<char*>(&height), sizeof(height));
         uint16_t layerCount;
-        file.read(reinterpret_cast<char*>(&layerCount), sizeof(layerCount));
+        if (!in.read(data.gridSize) || !in.read(data.width) || !in.read(data.height) || !in.read(layerCount)) {
+            return false;
+        }
 
-        // Layers
-        layers.clear();
-        layers.resize(layerCount);
-        for (auto& layer : layers) {
+        // Layers (레이어 하나는 최소 nameLen + visible + tileCount)
+        constexpr size_t MIN_LAYER_SIZE = sizeof(uint8_t) * 2 + sizeof(uint32_t);
+        if (!in.reserve(layerCount, MIN_LAYER_SIZE, sizeof(Layer))) return false;
+        data.layers.resize(layerCount);
+        for (auto& layer : data.layers) {
             uint8_t nameLen;
-            file.read(reinterpret_cast<char*>(&nameLen), sizeof(nameLen));
+            if (!in.read(nameLen)) return false;
             layer.name.resize(nameLen);
-            file.read(&layer.name[0], nameLen);
             uint8_t visible;
-            file.read(reinterpret_cast<char*>(&visible), sizeof(visible));
-            layer.visible = visible != 0;
             uint32_t tileCount;
-            file.read(reinterpret_cast<char*>(&tileCount), sizeof(tileCount));
+            if (!in.readBytes(&layer.name[0], nameLen) || !in.read(visible) || !in.read(tileCount)) return false;
+            layer.visible = visible != 0;
+
+            static_assert(sizeof(TileDataV1) == sizeof(TileData), "both versions use 8-byte tile records");
+            if (!in.reserve(tileCount, sizeof(TileData), sizeof(TileData))) return false;
             layer.tiles.resize(tileCount);
 
             if (version == VERSION_1) {
                 // Version 1: TileDataV1에서 읽고 TileData로 변환
                 for (auto& tile : layer.tiles) {
                     TileDataV1 v1Tile;
-                    file.read(reinterpret_cast<char*>(&v1Tile), sizeof(TileDataV1));
+                    in.read(v1Tile);
                     tile.x = v1Tile.x;
                     tile.y = v1Tile.y;
                     tile.type = v1Tile.type;
@@ -194,23 +199,24 @@ struct MapData {
                     }
                 }
             } else {
-                // Version 2: TileData 직접 읽기
+                // Version 2: TileData 직접 읽기 (개수는 위에서 확인했으므로 잘릴 수 없음)
                 for (auto& tile : layer.tiles) {
-                    file.read(reinterpret_cast<char*>(&tile), sizeof(TileData));
+                    in.read(tile);
                 }
             }
         }
 
         // Spawns
-        file.read(reinterpret_cast<char*>(&playerSpawnX), sizeof(playerSpawnX));
-        file.read(reinterpret_cast<char*>(&playerSpawnY), sizeof(playerSpawnY));
         uint32_t enemyCount;
-        file.read(reinterpret_cast<char*>(&enemyCount), sizeof(enemyCount));
-        enemySpawns.resize(enemyCount);
-        for (auto& spawn : enemySpawns) {
-            file.read(reinterpret_cast<char*>(&spawn), sizeof(EnemySpawn));
+        if (!in.read(data.playerSpawnX) || !in.read(data.playerSpawnY) || !in.read(enemyCount)) return false;
+        if (!in.reserve(enemyCount, sizeof(EnemySpawn), sizeof(EnemySpawn))) return false;
+        data.enemySpawns.resize(enemyCount);
+        for (auto& spawn : data.enemySpawns) {
+            in.read(spawn);
         }
+        if (in.failed()) return false;
 
+        *this = std::move(data);
         return true;
     }
 };
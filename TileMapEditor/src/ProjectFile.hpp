@@ -0,0 +1,346 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+#include "TileChunkGrid.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// 에디터 프로젝트 파일 형식 (.tmproj) - 레이어를 그대로 보존
+// 게임용 .tilemap(MapFileFormat.hpp)은 보이는 레이어를 합친 내보내기 결과물
+//
+// 파일 구조:
+// [Header]
+//   - Magic Number: 4 bytes ("TMPJ")
+//   - Version: 2 bytes (uint16_t)
+//   - Grid Size: 2 bytes (uint16_t)
+//   - Map Width / Height: 4 + 4 bytes (uint32_t, 타일 개수)
+//   - Journal Id / Seq: 8 + 8 bytes (uint64_t) - 버전 2부터, 이 파일에 반영된 편집 저널(ProjectJournal.hpp) 위치
+//   - Player Spawn: 8 bytes (int32_t x, int32_t y) - 타일 좌표, 없으면 (-1,-1)
+//   - Enemy Spawn Count: 4 bytes (uint32_t), Enemy Spawns: N * (int32_t x, int32_t y)
+//   - Layer Count: 2 bytes (uint16_t)
+// [Layer Table]
+//   For each layer:
+//     - Name Length: 1 byte (uint8_t), Name: N bytes
+//     - Visible: 1 byte
+//     - Chunk Count: 4 bytes (uint32_t) - 타일이 있는 청크만
+//     - Chunks: N * (uint16_t chunkX, uint16_t chunkY, uint32_t size, uint64_t offset)
+// [Chunk Data]
+//   청크(64x64) 하나 = (개수 uint16_t, 타일 바이트) 런의 나열, 행 우선으로 4096칸
+//
+// 표는 작아서 열 때 전부 읽고, 청크 데이터는 offset으로 필요한 것만 읽음 (보이는 레이어/청크부터)
+namespace ProjectFile {
+
+constexpr char MAGIC[4] = {'T', 'M', 'P', 'J'};
+constexpr uint16_t VERSION = 2;  // 1은 저널 필드 없이 읽음
+constexpr uint32_t MAX_MAP_SIZE = 65536;  // 가로/세로 타일 수 상한 (.tilemap 타일 좌표가 uint16_t)
+constexpr uint16_t MAX_LAYERS = 256;
+constexpr uint32_t CHUNK_SIZE = 64;        // TileChunkGrid 청크 크기와 같아야 함
+
+struct ChunkEntry {
+    uint16_t chunkX = 0;
+    uint16_t chunkY = 0;
+    uint32_t size = 0;    // 0 = 읽을 데이터 없음
+    uint64_t offset = 0;  // 파일 처음부터의 위치
+};
+
+struct LayerInfo {
+    std::string name;
+    bool visible = true;
+    std::vector<ChunkEntry> chunks;
+};
+
+struct Info {
+    uint16_t gridSize = 32;
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint64_t journalId = 0;   // 0 = 저널 없음
+    uint64_t journalSeq = 0;  // 이 번호까지의 저널 기록이 반영되어 있음
+    sf::Vector2i playerSpawn = {-1, -1};
+    std::vector<sf::Vector2i> enemySpawns;
+    std::vector<LayerInfo> layers;
+};
+
+namespace detail {
+template<typename T>
+void write(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read(std::istream& in, T& value) {
+    return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+inline void writeEntry(std::ostream& out, const ChunkEntry& entry) {
+    write(out, entry.chunkX);
+    write(out, entry.chunkY);
+    write(out, entry.size);
+    write(out, entry.offset);
+}
+
+template<typename Cell>
+constexpr size_t maxChunkSize() {
+    return static_cast<size_t>(TileChunkGrid<Cell>::CHUNK_SIZE) * TileChunkGrid<Cell>::CHUNK_SIZE * (sizeof(uint16_t) + sizeof(Cell));
+}
+
+// 같은 값이 이어지는 칸을 (개수, 값)으로
+template<typename Chunk>
+void encodeChunk(const Chunk& chunk, std::vector<char>& out) {
+    using Cell = typename decltype(chunk.cells)::value_type;
+    static_assert(std::is_trivially_copyable_v<Cell>, "cells are stored as raw bytes");
+    out.clear();
+    const auto& cells = chunk.cells;
+    for (size_t i = 0; i < cells.size();) {
+        size_t end = i + 1;
+        while (end < cells.size() && cells[end] == cells[i]) ++end;
+        uint16_t count = static_cast<uint16_t>(end - i);
+        const char* countBytes = reinterpret_cast<const char*>(&count);
+        const char* cellBytes = reinterpret_cast<const char*>(&cells[i]);
+        out.insert(out.end(), countBytes, countBytes + sizeof(count));
+        out.insert(out.end(), cellBytes, cellBytes + sizeof(Cell));
+        i = end;
+    }
+}
+
+template<typename Chunk>
+bool decodeChunk(const std::vector<char>& data, Chunk& chunk) {
+    using Cell = typename decltype(chunk.cells)::value_type;
+    auto& cells = chunk.cells;
+    size_t filled = 0;
+    size_t pos = 0;
+    while (pos + sizeof(uint16_t) + sizeof(Cell) <= data.size()) {
+        uint16_t count;
+        Cell cell;
+        std::memcpy(&count, &data[pos], sizeof(count));
+        std::memcpy(&cell, &data[pos + sizeof(count)], sizeof(Cell));
+        pos += sizeof(count) + sizeof(Cell);
+        if (count == 0 || count > cells.size() - filled) return false;
+        std::fill(cells.begin() + filled, cells.begin() + filled + count, cell);
+        filled += count;
+    }
+    return pos == data.size() && filled == cells.size();
+}
+}
+
+// grids[i]가 info.layers[i]의 타일 (info.layers[i].chunks는 무시하고 새로 만듦)
+template<typename Cell>
+bool save(const std::string& filename, const Info& info, const std::vector<const TileChunkGrid<Cell>*>& grids) {
+    using Grid = TileChunkGrid<Cell>;
+    static_assert(Grid::CHUNK_SIZE == static_cast<int>(CHUNK_SIZE), "chunk size is part of the file format");
+    if (grids.size() != info.layers.size() || grids.size() > MAX_LAYERS) return false;
+    if (info.width > MAX_MAP_SIZE || info.height > MAX_MAP_SIZE) return false;
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    // Header
+    file.write(MAGIC, 4);
+    detail::write(file, VERSION);
+    detail::write(file, info.gridSize);
+    detail::write(file, info.width);
+    detail::write(file, info.height);
+    detail::write(file, info.journalId);
+    detail::write(file, info.journalSeq);
+    detail::write(file, static_cast<int32_t>(info.playerSpawn.x));
+    detail::write(file, static_cast<int32_t>(info.playerSpawn.y));
+    detail::write(file, static_cast<uint32_t>(info.enemySpawns.size()));
+    for (const auto& spawn : info.enemySpawns) {
+        detail::write(file, static_cast<int32_t>(spawn.x));
+        detail::write(file, static_cast<int32_t>(spawn.y));
+    }
+    detail::write(file, static_cast<uint16_t>(grids.size()));
+
+    // Layer Table (청크 표는 자리만 잡고 데이터를 쓴 뒤 채움)
+    std::vector<std::vector<ChunkEntry>> tables(grids.size());
+    std::vector<std::streamoff> tableOffsets(grids.size());
+    for (size_t i = 0; i < grids.size(); ++i) {
+        const LayerInfo& layer = info.layers[i];
+        const Grid& grid = *grids[i];
+        uint8_t nameLen = static_cast<uint8_t>(std::min<size_t>(layer.name.size(), 255));
+        detail::write(file, nameLen);
+        file.write(layer.name.data(), nameLen);
+        detail::write(file, static_cast<uint8_t>(layer.visible ? 1 : 0));
+
+        for (int cy = 0; cy < grid.getChunkRows(); ++cy) {
+            for (int cx = 0; cx < grid.getChunkColumns(); ++cx) {
+                const auto* chunk = grid.getChunk(cx, cy);
+                if (!chunk) continue;
+                bool empty = std::all_of(chunk->cells.begin(), chunk->cells.end(),
+                                         [](const Cell& cell) { return cell == Cell{}; });
+                if (!empty) tables[i].push_back({static_cast<uint16_t>(cx), static_cast<uint16_t>(cy), 0, 0});
+            }
+        }
+        detail::write(file, static_cast<uint32_t>(tables[i].size()));
+        tableOffsets[i] = file.tellp();
+        for (size_t c = 0; c < tables[i].size(); ++c) {
+            detail::writeEntry(file, ChunkEntry{});
+        }
+    }
+
+    // Chunk Data
+    std::vector<char> encoded;
+    for (size_t i = 0; i < grids.size(); ++i) {
+        for (ChunkEntry& entry : tables[i]) {
+            detail::encodeChunk(*grids[i]->getChunk(entry.chunkX, entry.chunkY), encoded);
+            entry.offset = static_cast<uint64_t>(file.tellp());
+            entry.size = static_cast<uint32_t>(encoded.size());
+            file.write(encoded.data(), static_cast<std::streamsize>(encoded.size()));
+        }
+    }
+
+    for (size_t i = 0; i < grids.size(); ++i) {
+        file.seekp(tableOffsets[i]);
+        for (const ChunkEntry& entry : tables[i]) {
+            detail::writeEntry(file, entry);
+        }
+    }
+    file.close();
+    return !file.fail();
+}
+
+// 같은 폴더의 임시 파일에 다 쓴 뒤 rename으로 바꿔치기 (쓰다 실패해도 기존 파일은 그대로)
+template<typename Cell>
+bool saveAtomic(const std::string& filename, const Info& info, const std::vector<const TileChunkGrid<Cell>*>& grids) {
+    std::string temp = filename + ".tmp";
+    std::error_code error;
+    if (!save(temp, info, grids)) {
+        std::filesystem::remove(temp, error);
+        return false;
+    }
+    std::filesystem::rename(temp, filename, error);
+    if (error) {
+        std::filesystem::remove(temp, error);
+        return false;
+    }
+    return true;
+}
+
+// 파일 앞부분만 보고 프로젝트 파일인지 확인
+inline bool isProjectFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[4];
+    return file.read(magic, 4) && std::equal(magic, magic + 4, MAGIC);
+}
+
+// 헤더와 표만 먼저 읽고, 청크는 readChunk로 하나씩 읽는 리더
+// 열어둔 동안 파일 핸들을 들고 있음
+class Reader {
+public:
+    bool open(const std::string& filename) {
+        close();
+        m_file.open(filename, std::ios::binary);
+        if (!m_file.is_open()) return false;
+        if (!readTables()) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+        if (m_file.is_open()) m_file.close();
+        m_file.clear();
+        m_info = Info{};
+    }
+
+    bool isOpen() const { return m_file.is_open(); }
+    const Info& getInfo() const { return m_info; }
+
+    // 청크 하나 읽기 (실패하면 chunk는 건드리지 않음)
+    template<typename Chunk>
+    bool readChunk(const ChunkEntry& entry, Chunk& chunk) {
+        using Cell = typename decltype(chunk.cells)::value_type;
+        if (!m_file.is_open() || entry.size == 0 || entry.size > detail::maxChunkSize<Cell>()) return false;
+
+        m_buffer.resize(entry.size);
+        m_file.clear();
+        m_file.seekg(static_cast<std::streamoff>(entry.offset));
+        if (!m_file.read(m_buffer.data(), entry.size)) return false;
+
+        Chunk decoded;
+        if (!detail::decodeChunk(m_buffer, decoded)) return false;
+        chunk.cells = decoded.cells;
+        return true;
+    }
+
+private:
+    bool readTables() {
+        char magic[4];
+        if (!m_file.read(magic, 4) || !std::equal(magic, magic + 4, MAGIC)) return false;
+        uint16_t version;
+        if (!detail::read(m_file, version) || version == 0 || version > VERSION) return false;
+
+        Info& info = m_info;
+        int32_t spawnX, spawnY;
+        uint32_t enemyCount;
+        if (!detail::read(m_file, info.gridSize) || !detail::read(m_file, info.width) ||
+            !detail::read(m_file, info.height)) {
+            return false;
+        }
+        if (version >= 2 && (!detail::read(m_file, info.journalId) || !detail::read(m_file, info.journalSeq))) {
+            return false;
+        }
+        if (!detail::read(m_file, spawnX) || !detail::read(m_file, spawnY) || !detail::read(m_file, enemyCount)) {
+            return false;
+        }
+        if (info.gridSize == 0 || info.width > MAX_MAP_SIZE || info.height > MAX_MAP_SIZE) return false;
+        info.playerSpawn = {spawnX, spawnY};
+
+        // 개수는 파일 크기로 상한을 두고 읽음 (깨진 파일이 큰 할당을 만들지 않도록)
+        std::streamoff headerEnd = m_file.tellg();
+        m_file.seekg(0, std::ios::end);
+        std::streamoff fileSize = m_file.tellg();
+        m_file.seekg(headerEnd);
+        if (enemyCount > static_cast<uint64_t>(fileSize - headerEnd) / (2 * sizeof(int32_t))) return false;
+
+        info.enemySpawns.resize(enemyCount);
+        for (auto& spawn : info.enemySpawns) {
+            int32_t x, y;
+            if (!detail::read(m_file, x) || !detail::read(m_file, y)) return false;
+            spawn = {x, y};
+        }
+
+        uint16_t layerCount;
+        if (!detail::read(m_file, layerCount) || layerCount > MAX_LAYERS) return false;
+
+        uint32_t chunkColumns = (info.width + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        uint32_t chunkRows = (info.height + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        info.layers.resize(layerCount);
+        for (LayerInfo& layer : info.layers) {
+            uint8_t nameLen, visible;
+            uint32_t chunkCount;
+            if (!detail::read(m_file, nameLen)) return false;
+            layer.name.resize(nameLen);
+            if (nameLen > 0 && !m_file.read(&layer.name[0], nameLen)) return false;
+            if (!detail::read(m_file, visible) || !detail::read(m_file, chunkCount)) return false;
+            layer.visible = visible != 0;
+            if (chunkCount > static_cast<uint64_t>(chunkColumns) * chunkRows) return false;
+
+            layer.chunks.resize(chunkCount);
+            for (ChunkEntry& entry : layer.chunks) {
+                if (!detail::read(m_file, entry.chunkX) || !detail::read(m_file, entry.chunkY) ||
+                    !detail::read(m_file, entry.size) || !detail::read(m_file, entry.offset)) {
+                    return false;
+                }
+                if (entry.chunkX >= chunkColumns || entry.chunkY >= chunkRows || entry.size == 0 ||
+                    entry.offset > static_cast<uint64_t>(fileSize) ||
+                    entry.size > static_cast<uint64_t>(fileSize) - entry.offset) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    std::ifstream m_file;
+    Info m_info;
+    std::vector<char> m_buffer;
+};
+
+} // namespace ProjectFile
@@ -0,0 +1,402 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "ProjectFile.hpp"
+#include "TileChunkGrid.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// 프로젝트 편집 저널 (<프로젝트>.journal) - 바뀐 만큼만 저장하고 비정상 종료 후 복구
+//
+// 파일 구조:
+// [Header]
+//   - Magic Number: 4 bytes ("TMJL")
+//   - Version: 2 bytes (uint16_t)
+//   - Journal Id: 8 bytes (uint64_t) - 프로젝트 파일 헤더의 Journal Id와 같아야 함
+// [Records] (끝에 덧붙이기만 함)
+//   - Payload Size: 4 bytes (uint32_t), Checksum: 4 bytes (uint32_t, Payload의 FNV-1a)
+//   - Payload: Seq 8 bytes (uint64_t, 1부터 증가), Type 1 byte, 내용
+//     - Stroke: 레이어 uint16_t, 청크 수 uint32_t, 청크마다 (uint16_t x, uint16_t y, uint32_t 크기, 데이터),
+//               스폰 포함 여부 1 byte [+ 플레이어 int32_t x, y, 적 수 uint32_t, 적 N * (int32_t x, y)]
+//       청크 데이터는 프로젝트 파일과 같은 RLE로 바뀐 청크 전체 (여러 번 적용해도 결과가 같음)
+//     - RemoveLayer: uint16_t 레이어 / Resize: uint32_t 너비, 높이
+//     - Save: 내용 없음 (여기까지가 사용자가 저장한 상태)
+//
+// 프로젝트 파일에는 journalSeq까지의 기록이 반영되어 있어서 열 때 그 뒤 기록만 다시 적용함
+// 마지막 Save 뒤의 기록은 저장하지 않은 편집 (비정상 종료 후에는 복구, 정상 종료 시 버림)
+// 기록이 쌓이면 프로젝트 파일을 새로 쓰고(compaction) 반영된 앞부분을 저널에서 잘라냄
+template<typename Cell>
+class ProjectJournal {
+public:
+    using Grid = TileChunkGrid<Cell>;
+
+    static constexpr char MAGIC[4] = {'T', 'M', 'J', 'L'};
+    static constexpr uint16_t VERSION = 1;
+    static constexpr uint64_t HEADER_SIZE = 4 + sizeof(uint16_t) + sizeof(uint64_t);
+    static constexpr uint32_t MAX_PAYLOAD = 1u << 30;
+
+    enum class RecordType : uint8_t {
+        Stroke = 1,
+        RemoveLayer = 2,
+        Resize = 3,
+        Save = 4
+    };
+
+    struct ChunkData {
+        uint16_t chunkX = 0;
+        uint16_t chunkY = 0;
+        std::vector<char> data;  // RLE (decodeChunk로 풀기)
+    };
+
+    struct Record {
+        uint64_t seq = 0;
+        RecordType type = RecordType::Save;
+        uint16_t layer = 0;
+        std::vector<ChunkData> chunks;
+        bool hasSpawns = false;
+        sf::Vector2i playerSpawn = {-1, -1};
+        std::vector<sf::Vector2i> enemySpawns;
+        uint32_t width = 0;
+        uint32_t height = 0;
+    };
+
+    static std::string pathFor(const std::string& projectFile) { return projectFile + ".journal"; }
+
+    // 프로젝트 파일과 저널을 짝지을 id (0은 저널 없음이라 쓰지 않음)
+    static uint64_t newId() {
+        std::random_device random;
+        uint64_t id = (static_cast<uint64_t>(random()) << 32) ^ random() ^
+                      static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        return id != 0 ? id : 1;
+    }
+
+    static bool decodeChunk(const ChunkData& chunkData, typename Grid::Chunk& chunk) {
+        return chunkData.data.size() <= ProjectFile::detail::maxChunkSize<Cell>() &&
+               ProjectFile::detail::decodeChunk(chunkData.data, chunk);
+    }
+
+    // 새 저널 (같은 경로의 기존 저널은 지움)
+    bool create(const std::string& path, uint64_t id) {
+        close();
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+        file.write(MAGIC, 4);
+        ProjectFile::detail::write(file, VERSION);
+        ProjectFile::detail::write(file, id);
+        file.close();
+        if (file.fail()) return false;
+
+        m_path = path;
+        m_id = id;
+        m_lastSeq = 0;
+        m_savedSeq = 0;
+        m_size = HEADER_SIZE;
+        m_savedSize = HEADER_SIZE;
+        return openForAppend();
+    }
+
+    // 기존 저널을 열고 afterSeq 뒤의 기록마다 visit(record) 호출 (프로젝트 파일에 다시 적용)
+    // id가 다르거나 파일이 없으면 false, 끝의 깨진 기록(쓰다 멈춘 것)은 잘라냄
+    template<typename Visitor>
+    bool open(const std::string& path, uint64_t id, uint64_t afterSeq, Visitor&& visit) {
+        close();
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open() || !readHeader(file, id)) return false;
+
+        m_lastSeq = afterSeq;
+        m_savedSeq = afterSeq;
+        m_size = HEADER_SIZE;
+        m_savedSize = HEADER_SIZE;
+        Record record;
+        readRecords(file, [&](const std::vector<char>& payload) {
+            if (!parseRecord(payload, record)) return false;
+            m_size += 2 * sizeof(uint32_t) + payload.size();
+            m_lastSeq = std::max(m_lastSeq, record.seq);
+            if (record.type == RecordType::Save) {
+                m_savedSize = m_size;
+                m_savedSeq = std::max(m_savedSeq, record.seq);
+            }
+            if (record.seq > afterSeq) visit(static_cast<const Record&>(record));
+            return true;
+        });
+        file.close();
+
+        std::error_code error;
+        if (std::filesystem::file_size(path, error) != m_size && !error) {
+            std::filesystem::resize_file(path, m_size, error);
+        }
+        m_path = path;
+        m_id = id;
+        return openForAppend();
+    }
+
+    void close() {
+        if (m_file.is_open()) m_file.close();
+        m_file.clear();
+        m_path.clear();
+        m_id = 0;
+    }
+
+    bool isOpen() const { return m_file.is_open(); }
+    const std::string& getPath() const { return m_path; }
+    uint64_t getId() const { return m_id; }
+    uint64_t getSize() const { return m_size; }
+    bool hasUnsaved() const { return m_size > m_savedSize; }
+
+    // chunks의 현재 내용을 기록 (스폰은 바뀐 경우만)
+    bool appendStroke(int layer, const Grid& grid, const std::vector<sf::Vector2i>& chunks, bool hasSpawns,
+                      sf::Vector2i playerSpawn, const std::vector<sf::Vector2i>& enemySpawns) {
+        beginRecord(RecordType::Stroke);
+        put(static_cast<uint16_t>(layer));
+        put(static_cast<uint32_t>(chunks.size()));
+        static const typename Grid::Chunk emptyChunk{};
+        for (sf::Vector2i coord : chunks) {
+            const typename Grid::Chunk* chunk = grid.getChunk(coord.x, coord.y);
+            ProjectFile::detail::encodeChunk(chunk ? *chunk : emptyChunk, m_encoded);
+            put(static_cast<uint16_t>(coord.x));
+            put(static_cast<uint16_t>(coord.y));
+            put(static_cast<uint32_t>(m_encoded.size()));
+            m_payload.insert(m_payload.end(), m_encoded.begin(), m_encoded.end());
+        }
+        put(static_cast<uint8_t>(hasSpawns ? 1 : 0));
+        if (hasSpawns) {
+            put(static_cast<int32_t>(playerSpawn.x));
+            put(static_cast<int32_t>(playerSpawn.y));
+            put(static_cast<uint32_t>(enemySpawns.size()));
+            for (sf::Vector2i spawn : enemySpawns) {
+                put(static_cast<int32_t>(spawn.x));
+                put(static_cast<int32_t>(spawn.y));
+            }
+        }
+        return endRecord();
+    }
+
+    bool appendRemoveLayer(int layer) {
+        beginRecord(RecordType::RemoveLayer);
+        put(static_cast<uint16_t>(layer));
+        return endRecord();
+    }
+
+    bool appendResize(int width, int height) {
+        beginRecord(RecordType::Resize);
+        put(static_cast<uint32_t>(width));
+        put(static_cast<uint32_t>(height));
+        return endRecord();
+    }
+
+    // 저장 지점 (이후 discardUnsaved는 여기까지 되돌림)
+    bool appendSave() {
+        beginRecord(RecordType::Save);
+        if (!endRecord()) return false;
+        m_savedSeq = m_lastSeq;
+        m_savedSize = m_size;
+        return true;
+    }
+
+    // 마지막 저장 뒤의 기록을 버림 (저장하지 않고 닫을 때)
+    void discardUnsaved() {
+        if (!isOpen() || !hasUnsaved()) return;
+        m_file.close();
+        std::error_code error;
+        std::filesystem::resize_file(m_path, m_savedSize, error);
+        if (!error) m_size = m_savedSize;
+        openForAppend();
+    }
+
+    // 저장한 상태를 프로젝트 파일에 다시 쓰기 전에 호출, 반환한 번호를 파일의 journalSeq로 씀
+    // 스냅샷은 마지막 Save 시점의 상태여야 함 (appendSave 직후)
+    uint64_t beginCompaction() {
+        m_compactSeq = m_savedSeq;
+        m_compactOffset = m_savedSize;
+        return m_compactSeq;
+    }
+
+    // 프로젝트 파일을 다 쓴 뒤 호출, 반영된 기록을 잘라냄 (그 사이에 덧붙인 기록만 옮겨 씀)
+    bool finishCompaction(uint64_t seq) {
+        if (!isOpen() || seq == 0 || seq != m_compactSeq) return false;
+        m_compactSeq = 0;
+        m_file.close();
+
+        std::string temp = m_path + ".tmp";
+        {
+            std::ifstream in(m_path, std::ios::binary);
+            std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+            if (in.is_open() && out.is_open()) {
+                char header[HEADER_SIZE];
+                in.read(header, HEADER_SIZE);
+                out.write(header, HEADER_SIZE);
+                in.seekg(static_cast<std::streamoff>(m_compactOffset));
+                std::vector<char> buffer(64 * 1024);
+                while (in.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || in.gcount() > 0) {
+                    out.write(buffer.data(), in.gcount());
+                }
+            }
+            out.close();
+            if (!in.is_open() || out.fail()) {
+                std::error_code error;
+                std::filesystem::remove(temp, error);
+                openForAppend();
+                return false;
+            }
+        }
+
+        std::error_code error;
+        std::filesystem::rename(temp, m_path, error);
+        if (error) {
+            std::filesystem::remove(temp, error);
+            openForAppend();
+            return false;
+        }
+        uint64_t removed = m_compactOffset - HEADER_SIZE;
+        m_size -= removed;
+        m_savedSize = m_savedSize > m_compactOffset ? m_savedSize - removed : HEADER_SIZE;
+        return openForAppend();
+    }
+
+private:
+    bool openForAppend() {
+        m_file.clear();
+        m_file.open(m_path, std::ios::binary | std::ios::app);
+        return m_file.is_open();
+    }
+
+    static uint32_t checksum(const std::vector<char>& data) {
+        uint32_t hash = 2166136261u;
+        for (char c : data) {
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        }
+        return hash;
+    }
+
+    bool readHeader(std::istream& in, uint64_t id) {
+        char magic[4];
+        uint16_t version;
+        uint64_t fileId;
+        return in.read(magic, 4) && std::equal(magic, magic + 4, MAGIC) &&
+               ProjectFile::detail::read(in, version) && version == VERSION &&
+               ProjectFile::detail::read(in, fileId) && fileId == id;
+    }
+
+    // 체크섬이 맞는 기록마다 f(payload), f가 false를 반환하거나 깨진 기록을 만나면 멈춤
+    template<typename Func>
+    void readRecords(std::istream& in, Func&& f) {
+        std::vector<char> payload;
+        uint32_t size, sum;
+        while (ProjectFile::detail::read(in, size) && ProjectFile::detail::read(in, sum)) {
+            if (size < sizeof(uint64_t) + 1 || size > MAX_PAYLOAD) return;
+            payload.resize(size);
+            if (!in.read(payload.data(), size) || checksum(payload) != sum) return;
+            if (!f(payload)) return;
+        }
+    }
+
+    template<typename T>
+    static bool get(const std::vector<char>& data, size_t& pos, T& value) {
+        if (data.size() - pos < sizeof(T)) return false;
+        std::memcpy(&value, &data[pos], sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    static bool parseRecord(const std::vector<char>& payload, Record& record) {
+        size_t pos = 0;
+        uint8_t type;
+        record = Record{};
+        if (!get(payload, pos, record.seq) || !get(payload, pos, type)) return false;
+        record.type = static_cast<RecordType>(type);
+
+        switch (record.type) {
+            case RecordType::Stroke: {
+                uint32_t chunkCount;
+                if (!get(payload, pos, record.layer) || !get(payload, pos, chunkCount)) return false;
+                // 청크 하나에 최소 8바이트이므로 개수는 남은 크기로 상한
+                if (chunkCount > (payload.size() - pos) / 8) return false;
+                record.chunks.resize(chunkCount);
+                for (ChunkData& chunk : record.chunks) {
+                    uint32_t size;
+                    if (!get(payload, pos, chunk.chunkX) || !get(payload, pos, chunk.chunkY) ||
+                        !get(payload, pos, size) || size > payload.size() - pos) {
+                        return false;
+                    }
+                    chunk.data.assign(payload.begin() + pos, payload.begin() + pos + size);
+                    pos += size;
+                }
+                uint8_t hasSpawns;
+                if (!get(payload, pos, hasSpawns)) return false;
+                record.hasSpawns = hasSpawns != 0;
+                if (record.hasSpawns) {
+                    int32_t x, y;
+                    uint32_t enemyCount;
+                    if (!get(payload, pos, x) || !get(payload, pos, y) || !get(payload, pos, enemyCount)) return false;
+                    record.playerSpawn = {x, y};
+                    if (enemyCount > (payload.size() - pos) / (2 * sizeof(int32_t))) return false;
+                    record.enemySpawns.resize(enemyCount);
+                    for (sf::Vector2i& spawn : record.enemySpawns) {
+                        get(payload, pos, x);
+                        get(payload, pos, y);
+                        spawn = {x, y};
+                    }
+                }
+                break;
+            }
+            case RecordType::RemoveLayer:
+                if (!get(payload, pos, record.layer)) return false;
+                break;
+            case RecordType::Resize:
+                if (!get(payload, pos, record.width) || !get(payload, pos, record.height)) return false;
+                if (record.width > ProjectFile::MAX_MAP_SIZE || record.height > ProjectFile::MAX_MAP_SIZE) return false;
+                break;
+            case RecordType::Save:
+                break;
+            default:
+                return false;
+        }
+        return pos == payload.size();
+    }
+
+    template<typename T>
+    void put(const T& value) {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        m_payload.insert(m_payload.end(), bytes, bytes + sizeof(T));
+    }
+
+    void beginRecord(RecordType type) {
+        m_payload.clear();
+        put(m_lastSeq + 1);
+        put(static_cast<uint8_t>(type));
+    }
+
+    // 기록 하나를 통째로 쓰고 바로 내보냄 (실패하면 저널을 닫음)
+    bool endRecord() {
+        if (!isOpen() || m_payload.size() > MAX_PAYLOAD) return false;
+        ProjectFile::detail::write(m_file, static_cast<uint32_t>(m_payload.size()));
+        ProjectFile::detail::write(m_file, checksum(m_payload));
+        m_file.write(m_payload.data(), static_cast<std::streamsize>(m_payload.size()));
+        m_file.flush();
+        if (!m_file) {
+            close();
+            return false;
+        }
+        ++m_lastSeq;
+        m_size += 2 * sizeof(uint32_t) + m_payload.size();
+        return true;
+    }
+
+    std::ofstream m_file;
+    std::string m_path;
+    uint64_t m_id = 0;
+    uint64_t m_lastSeq = 0;
+    uint64_t m_size = 0;       // 파일 크기 (헤더 포함)
+    uint64_t m_savedSize = 0;  // 마지막 Save 기록까지의 크기
+    uint64_t m_savedSeq = 0;   // 마지막 Save 기록 (없으면 프로젝트 파일)의 번호
+    uint64_t m_compactSeq = 0;
+    uint64_t m_compactOffset = 0;
+    std::vector<char> m_payload;
+    std::vector<char> m_encoded;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "ProjectFile.hpp"
+#include "TileChunkGrid.hpp"
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// 프로젝트 스냅샷을 작업 스레드에서 저장 (한 번에 하나)
+//
+// 스냅샷의 격자는 TileChunkGrid 복사본이라 청크 포인터만 공유하고,
+// 에디터가 그 뒤에 고치는 청크는 copy-on-write로 복사되므로 저장 중에도 편집을 막지 않음
+// 파일은 임시 파일에 다 쓴 뒤 rename으로 바꿔치기 (중간에 죽어도 이전 파일이 남음)
+template<typename Cell>
+class ProjectSaver {
+public:
+    struct Snapshot {
+        std::string path;
+        bool autosave = false;
+        ProjectFile::Info info;
+        std::vector<TileChunkGrid<Cell>> grids;  // info.layers와 같은 순서
+    };
+
+    struct Result {
+        std::string path;
+        bool autosave = false;
+        bool success = false;
+        double milliseconds = 0.0;
+        uint64_t journalId = 0;   // 저장한 파일의 info.journalId / journalSeq
+        uint64_t journalSeq = 0;
+    };
+
+    ProjectSaver() = default;
+    ProjectSaver(const ProjectSaver&) = delete;
+    ProjectSaver& operator=(const ProjectSaver&) = delete;
+    ~ProjectSaver() { wait(); }
+
+    bool isBusy() const { return m_thread.joinable(); }
+
+    // 저장 시작 (이미 저장 중이면 false)
+    bool start(Snapshot snapshot) {
+        if (isBusy()) return false;
+        m_done = false;
+        m_thread = std::thread([this, snapshot = std::move(snapshot)]() {
+            auto begin = std::chrono::steady_clock::now();
+            std::vector<const TileChunkGrid<Cell>*> grids;
+            for (const auto& grid : snapshot.grids) {
+                grids.push_back(&grid);
+            }
+            bool success = ProjectFile::saveAtomic(snapshot.path, snapshot.info, grids);
+            std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+            m_result = Result{snapshot.path, snapshot.autosave, success, elapsed.count(),
+                              snapshot.info.journalId, snapshot.info.journalSeq};
+            m_done = true;
+        });
+        return true;
+    }
+
+    // 끝난 저장이 있으면 결과를 한 번 돌려줌 (매 프레임 호출)
+    std::optional<Result> poll() {
+        if (!m_done) return std::nullopt;
+        wait();
+        m_done = false;
+        return m_result;
+    }
+
+    // 저장이 끝날 때까지 기다림 (결과는 다음 poll에서)
+    void wait() {
+        if (m_thread.joinable()) m_thread.join();
+    }
+
+private:
+    std::thread m_thread;
+    std::atomic<bool> m_done{false};
+    Result m_result;
+};
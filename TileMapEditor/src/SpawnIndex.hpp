@@ -0,0 +1,124 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 타일 좌표를 키로 하는 스폰 위치 집합 (한 타일에 스폰 하나)
+//
+// - 추가/삭제/조회는 좌표 해시로 O(1)
+// - 64x64 타일 버킷으로도 나눠 둬서 영역 조회(화면 컬링, 영역 지우기)는 겹치는 버킷만 훑음
+// - positions()는 저장/실행 취소용 목록 (삭제하면 마지막 항목이 빈 자리로 옮겨짐)
+class SpawnIndex {
+public:
+    static constexpr int BUCKET_SHIFT = 6;
+
+    bool add(sf::Vector2i tile) {
+        if (!m_slots.emplace(key(tile.x, tile.y), m_positions.size()).second) return false;
+        m_positions.push_back(tile);
+        m_buckets[bucketKey(tile)].push_back(tile);
+        ++m_revision;
+        return true;
+    }
+
+    bool remove(sf::Vector2i tile) {
+        auto found = m_slots.find(key(tile.x, tile.y));
+        if (found == m_slots.end()) return false;
+
+        // 배열에서는 마지막 항목을 빈 자리로 옮김
+        size_t slot = found->second;
+        m_slots.erase(found);
+        if (slot + 1 != m_positions.size()) {
+            m_positions[slot] = m_positions.back();
+            m_slots[key(m_positions[slot].x, m_positions[slot].y)] = slot;
+        }
+        m_positions.pop_back();
+
+        auto bucket = m_buckets.find(bucketKey(tile));
+        std::vector<sf::Vector2i>& cells = bucket->second;
+        *std::find(cells.begin(), cells.end(), tile) = cells.back();
+        cells.pop_back();
+        if (cells.empty()) m_buckets.erase(bucket);
+
+        ++m_revision;
+        return true;
+    }
+
+    bool contains(sf::Vector2i tile) const { return m_slots.count(key(tile.x, tile.y)) != 0; }
+
+    // 영역 안의 스폰을 모두 지우고 지운 위치 반환 (실행 취소 기록용)
+    std::vector<sf::Vector2i> removeIn(const sf::IntRect& rect) {
+        std::vector<sf::Vector2i> inside;
+        forEachIn(rect, [&](sf::Vector2i tile) { inside.push_back(tile); });
+        for (sf::Vector2i tile : inside) {
+            remove(tile);
+        }
+        return inside;
+    }
+
+    // 영역 안의 스폰마다 f(tile) (순서는 정해져 있지 않음)
+    template<typename Func>
+    void forEachIn(const sf::IntRect& rect, Func&& f) const {
+        if (rect.size.x <= 0 || rect.size.y <= 0 || m_buckets.empty()) return;
+        int bx0 = rect.position.x >> BUCKET_SHIFT;
+        int by0 = rect.position.y >> BUCKET_SHIFT;
+        int bx1 = (rect.position.x + rect.size.x - 1) >> BUCKET_SHIFT;
+        int by1 = (rect.position.y + rect.size.y - 1) >> BUCKET_SHIFT;
+
+        auto visitBucket = [&](const std::vector<sf::Vector2i>& cells) {
+            for (sf::Vector2i tile : cells) {
+                if (rect.contains(tile)) f(tile);
+            }
+        };
+
+        // 영역이 버킷 수보다 넓으면 (많이 축소한 경우) 있는 버킷만 훑음
+        long long rangeBuckets = static_cast<long long>(bx1 - bx0 + 1) * (by1 - by0 + 1);
+        if (rangeBuckets > static_cast<long long>(m_buckets.size())) {
+            for (const auto& bucket : m_buckets) {
+                visitBucket(bucket.second);
+            }
+            return;
+        }
+        for (int by = by0; by <= by1; ++by) {
+            for (int bx = bx0; bx <= bx1; ++bx) {
+                auto bucket = m_buckets.find(key(bx, by));
+                if (bucket != m_buckets.end()) visitBucket(bucket->second);
+            }
+        }
+    }
+
+    void assign(const std::vector<sf::Vector2i>& positions) {
+        clear();
+        for (sf::Vector2i tile : positions) {
+            add(tile);
+        }
+    }
+
+    void clear() {
+        m_positions.clear();
+        m_slots.clear();
+        m_buckets.clear();
+        ++m_revision;
+    }
+
+    const std::vector<sf::Vector2i>& positions() const { return m_positions; }
+    size_t size() const { return m_positions.size(); }
+    bool empty() const { return m_positions.empty(); }
+
+    // 내용이 바뀔 때마다 증가 (렌더링 캐시 확인용)
+    uint64_t getRevision() const { return m_revision; }
+
+private:
+    static uint64_t key(int x, int y) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+    }
+    static uint64_t bucketKey(sf::Vector2i tile) { return key(tile.x >> BUCKET_SHIFT, tile.y >> BUCKET_SHIFT); }
+
+    std::vector<sf::Vector2i> m_positions;
+    std::unordered_map<uint64_t, size_t> m_slots;                        // 좌표 -> m_positions 위치
+    std::unordered_map<uint64_t, std::vector<sf::Vector2i>> m_buckets;  // 버킷 좌표 -> 그 안의 스폰
+    uint64_t m_revision = 0;
+};
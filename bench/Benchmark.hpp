@@ -0,0 +1,335 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// bench/ 실행 파일들이 같이 쓰는 트리 내 벤치마크 하네스 (외부 라이브러리 없음)
+//
+// 케이스마다 워밍업 후 최소 시간과 최소 횟수를 채울 때까지 반복하면서 반복당 시간을 재고
+// 평균/중앙값/p95와 케이스가 붙인 카운터(draw call 수 등)를 출력함
+// 케이스 안의 expect가 실패하면 종료 코드가 1이 됨
+//
+// 옵션:
+//   --filter <문자열>       이름에 문자열이 들어간 케이스만 실행
+//   --min-time <초>         케이스당 최소 측정 시간 (기본 0.5)
+//   --json <파일>           결과 저장
+//   --label <이름>          저장할 결과의 이름 (보통 커밋 해시)
+//   --baseline <파일>       이전에 --json으로 저장한 결과와 평균 비교
+//   --threshold <퍼센트>    이만큼 느려지면 회귀로 표시 (기본 10)
+//   --fail-on-regression    회귀가 있으면 종료 코드 1
+//   --list                  케이스 이름만 출력
+class BenchmarkRunner
+{
+public:
+    // 결과 단위: 반복당 시간(초)을 반복당 처리 개수로 나누고 scale을 곱함
+    struct Unit
+    {
+        const char* label;
+        double scale;
+    };
+
+    static constexpr Unit milliseconds(const char* label) { return {label, 1e3}; }
+    static constexpr Unit nanoseconds(const char* label) { return {label, 1e9}; }
+
+    struct Result
+    {
+        std::string name;
+        std::string unit;
+        double mean = 0.0;
+        double median = 0.0;
+        double p95 = 0.0;
+        std::size_t samples = 0;
+        std::vector<std::pair<std::string, double>> counters;
+        std::vector<std::string> failures;
+    };
+
+    // 반복 한 번에 넘겨지는 상태 (카운터는 마지막 반복의 값이 남음)
+    class State
+    {
+    public:
+        explicit State(Result& result)
+            : m_result(result)
+        {
+        }
+
+        void setCounter(const std::string& name, double value)
+        {
+            for (auto& counter : m_result.counters)
+            {
+                if (counter.first == name)
+                {
+                    counter.second = value;
+                    return;
+                }
+            }
+            m_result.counters.emplace_back(name, value);
+        }
+
+        // 결과 검사 (같은 메시지는 한 번만 기록)
+        void expect(bool condition, const std::string& message)
+        {
+            if (condition) return;
+            if (std::find(m_result.failures.begin(), m_result.failures.end(), message) == m_result.failures.end())
+            {
+                m_result.failures.push_back(message);
+            }
+        }
+
+    private:
+        Result& m_result;
+    };
+
+    BenchmarkRunner(int argc, char** argv)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--filter" && hasValue) m_filter = argv[++i];
+            else if (arg == "--min-time" && hasValue) m_minSeconds = std::atof(argv[++i]);
+            else if (arg == "--json" && hasValue) m_jsonPath = argv[++i];
+            else if (arg == "--label" && hasValue) m_label = argv[++i];
+            else if (arg == "--baseline" && hasValue) m_baselinePath = argv[++i];
+            else if (arg == "--threshold" && hasValue) m_thresholdPercent = std::atof(argv[++i]);
+            else if (arg == "--fail-on-regression") m_failOnRegression = true;
+            else if (arg == "--list") m_listOnly = true;
+            else
+            {
+                std::fprintf(stderr, "Unknown or incomplete argument: %s\n", arg.c_str());
+                m_valid = false;
+            }
+        }
+    }
+
+    bool isValid() const { return m_valid; }
+
+    bool shouldRun(const std::string& name) const
+    {
+        return m_filter.empty() || name.find(m_filter) != std::string::npos;
+    }
+
+    // iteration 한 번이 샘플 하나, itemsPerIteration은 반복당 처리하는 개수 (프레임, 엔티티 스텝, 쿼리 등)
+    void run(const std::string& name, Unit unit, double itemsPerIteration, const std::function<void(State&)>& iteration)
+    {
+        runWithSetup(name, unit, itemsPerIteration, {}, iteration);
+    }
+
+    // setup은 매 반복 전에 측정 밖에서 호출됨 (반복마다 같은 상태에서 시작해야 할 때)
+    void runWithSetup(const std::string& name, Unit unit, double itemsPerIteration, const std::function<void()>& setup,
+                      const std::function<void(State&)>& iteration)
+    {
+        if (!shouldRun(name)) return;
+        if (m_listOnly)
+        {
+            std::printf("%s\n", name.c_str());
+            return;
+        }
+
+        Result result;
+        result.name = name;
+        result.unit = unit.label;
+        State state(result);
+
+        for (int i = 0; i < WARMUP_ITERATIONS; ++i)
+        {
+            if (setup) setup();
+            iteration(state);
+        }
+
+        std::vector<double> seconds;
+        double total = 0.0;
+        while (total < m_minSeconds || seconds.size() < MIN_ITERATIONS)
+        {
+            if (setup) setup();
+            auto start = std::chrono::steady_clock::now();
+            iteration(state);
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            seconds.push_back(elapsed);
+            total += elapsed;
+            if (seconds.size() >= MAX_ITERATIONS) break;
+        }
+
+        double scale = unit.scale / std::max(itemsPerIteration, 1.0);
+        std::sort(seconds.begin(), seconds.end());
+        result.samples = seconds.size();
+        result.mean = total / seconds.size() * scale;
+        result.median = seconds[seconds.size() / 2] * scale;
+        result.p95 = seconds[std::min(seconds.size() - 1, seconds.size() * 95 / 100)] * scale;
+
+        printResult(result);
+        m_results.push_back(std::move(result));
+    }
+
+    // 결과 저장/비교 후 종료 코드 반환
+    int finish()
+    {
+        if (m_listOnly) return m_valid ? 0 : 1;
+
+        bool failed = !m_valid;
+        for (const auto& result : m_results)
+        {
+            failed = failed || !result.failures.empty();
+        }
+
+        if (!m_jsonPath.empty() && !writeJson(m_jsonPath))
+        {
+            std::fprintf(stderr, "Failed to write %s\n", m_jsonPath.c_str());
+            failed = true;
+        }
+
+        if (!m_baselinePath.empty())
+        {
+            bool regressed = false;
+            if (!compareWithBaseline(m_baselinePath, regressed)) failed = true;
+            if (regressed && m_failOnRegression) failed = true;
+        }
+
+        return failed ? 1 : 0;
+    }
+
+    // 컴파일러가 계산 결과를 지우지 못하게 함
+    template<typename T>
+    static void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static const void* volatile sink;
+        sink = &value;
+#endif
+    }
+
+private:
+    static constexpr int WARMUP_ITERATIONS = 2;
+    static constexpr std::size_t MIN_ITERATIONS = 5;
+    static constexpr std::size_t MAX_ITERATIONS = 100000;
+
+    static void printResult(const Result& result)
+    {
+        std::printf("%-44s %12.4f %-16s median %10.4f  p95 %10.4f  n=%zu", result.name.c_str(), result.mean,
+                    result.unit.c_str(), result.median, result.p95, result.samples);
+        for (const auto& counter : result.counters)
+        {
+            std::printf("  %s=%.0f", counter.first.c_str(), counter.second);
+        }
+        std::printf("\n");
+        for (const auto& failure : result.failures)
+        {
+            std::printf("    FAILED: %s\n", failure.c_str());
+        }
+    }
+
+    // 결과 하나를 한 줄로 씀 (compareWithBaseline이 줄 단위로 읽음)
+    bool writeJson(const std::string& path) const
+    {
+        std::ofstream file(path);
+        if (!file) return false;
+
+        file << "{\n  \"label\": \"" << m_label << "\",\n  \"results\": [\n";
+        for (std::size_t i = 0; i < m_results.size(); ++i)
+        {
+            const Result& result = m_results[i];
+            file << "    {\"name\": \"" << result.name << "\", \"unit\": \"" << result.unit
+                 << "\", \"mean\": " << result.mean << ", \"median\": " << result.median
+                 << ", \"p95\": " << result.p95 << ", \"samples\": " << result.samples << ", \"counters\": {";
+            for (std::size_t c = 0; c < result.counters.size(); ++c)
+            {
+                file << (c ? ", " : "") << "\"" << result.counters[c].first << "\": " << result.counters[c].second;
+            }
+            file << "}}" << (i + 1 < m_results.size() ? "," : "") << "\n";
+        }
+        file << "  ]\n}\n";
+        return static_cast<bool>(file);
+    }
+
+    static bool readField(const std::string& line, const std::string& key, std::string& value)
+    {
+        std::string pattern = "\"" + key + "\": ";
+        std::size_t begin = line.find(pattern);
+        if (begin == std::string::npos) return false;
+        begin += pattern.size();
+        if (begin < line.size() && line[begin] == '"')
+        {
+            std::size_t end = line.find('"', begin + 1);
+            if (end == std::string::npos) return false;
+            value = line.substr(begin + 1, end - begin - 1);
+            return true;
+        }
+        std::size_t end = line.find_first_of(",}", begin);
+        value = line.substr(begin, end == std::string::npos ? std::string::npos : end - begin);
+        return true;
+    }
+
+    bool compareWithBaseline(const std::string& path, bool& regressed) const
+    {
+        std::ifstream file(path);
+        if (!file)
+        {
+            std::fprintf(stderr, "Failed to open baseline %s\n", path.c_str());
+            return false;
+        }
+
+        std::vector<std::pair<std::string, double>> baseline;
+        std::string baselineLabel = "baseline";
+        std::string line;
+        while (std::getline(file, line))
+        {
+            std::string name;
+            std::string mean;
+            if (readField(line, "name", name) && readField(line, "mean", mean))
+            {
+                baseline.emplace_back(name, std::atof(mean.c_str()));
+            }
+            else
+            {
+                readField(line, "label", baselineLabel);
+            }
+        }
+
+        std::printf("\nCompared with %s (%s), threshold %.1f%%\n", baselineLabel.c_str(), path.c_str(),
+                    m_thresholdPercent);
+        for (const auto& result : m_results)
+        {
+            auto it = std::find_if(baseline.begin(), baseline.end(),
+                                   [&](const auto& entry) { return entry.first == result.name; });
+            if (it == baseline.end() || it->second <= 0.0)
+            {
+                std::printf("%-44s %12s\n", result.name.c_str(), "new");
+                continue;
+            }
+
+            double change = (result.mean - it->second) / it->second * 100.0;
+            const char* verdict = "";
+            if (change > m_thresholdPercent)
+            {
+                verdict = "  REGRESSION";
+                regressed = true;
+            }
+            else if (change < -m_thresholdPercent)
+            {
+                verdict = "  improved";
+            }
+            std::printf("%-44s %12.4f -> %12.4f %-16s %+7.1f%%%s\n", result.name.c_str(), it->second, result.mean,
+                        result.unit.c_str(), change, verdict);
+        }
+        return true;
+    }
+
+    std::string m_filter;
+    std::string m_jsonPath;
+    std::string m_label = "unlabeled";
+    std::string m_baselinePath;
+    double m_minSeconds = 0.5;
+    double m_thresholdPercent = 10.0;
+    bool m_failOnRegression = false;
+    bool m_listOnly = false;
+    bool m_valid = true;
+    std::vector<Result> m_results;
+};
@@ -0,0 +1,347 @@
+// 오프스크린 렌더링 벤치마크 (TileMap, 인벤토리/장비 UI, 에디터 맵 캔버스)
+//
+// 창 없이 sf::RenderTexture에 그리므로 GPU 없이 소프트웨어 GL에서도 돌아감
+//   Linux: xvfb-run -a env LIBGL_ALWAYS_SOFTWARE=1 ./render_bench --json after.json --baseline before.json
+// 프레임마다 display + glFinish로 GL 작업이 끝날 때까지 기다린 시간을 ms/frame으로 보고하고,
+// RenderStats의 draw call/정점/텍스처 전환 수를 카운터로 붙임
+// 커밋 사이 비교는 이전 커밋에서 --json으로 저장한 파일을 --baseline으로 넘김
+
+#include <SFML/Graphics.hpp>
+#include <SFML/OpenGL.hpp>
+#include "Benchmark.hpp"
+#include "SyntheticMap.hpp"
+#include "RenderStats.hpp"
+#include "RenderSnapshot.hpp"
+#include "TileMap.hpp"
+#include "InventoryWindow.hpp"
+#include "EquipmentWindow.hpp"
+#include "Editor.hpp"
+#include "Log.hpp"
+#include <cmath>
+#include <string>
+
+namespace
+{
+constexpr sf::Vector2u GAME_TARGET_SIZE{1280, 720};
+constexpr sf::Vector2u EDITOR_TARGET_SIZE{1400, 800};
+constexpr std::uint32_t MAP_SEED = 20240611;
+
+// 한 프레임: 통계 시작 - 그리기 - GL 작업 완료 대기 - 카운터 기록
+template<typename DrawFunction>
+void renderFrame(sf::RenderTexture& target, BenchmarkRunner::State& state, DrawFunction&& drawFrame)
+{
+    RenderStats& stats = RenderStats::current();
+    stats.beginFrame();
+    target.clear(sf::Color{40, 40, 40});
+    drawFrame();
+    target.display();
+    glFinish();
+
+    const RenderStats::Frame& frame = stats.endFrame();
+    state.setCounter("draws", frame.total.drawCalls);
+    state.setCounter("vertices", frame.total.vertices);
+    state.setCounter("textures", frame.total.textureSwitches);
+    state.setCounter("shaders", frame.total.shaderSwitches);
+}
+
+unsigned int pageCount(unsigned int width, unsigned int height)
+{
+    unsigned int pageSize = TileIndexRenderer::MAX_PAGE_SIZE;
+    return ((width + pageSize - 1) / pageSize) * ((height + pageSize - 1) / pageSize);
+}
+
+void benchmarkTileMap(BenchmarkRunner& runner, sf::RenderTexture& target)
+{
+    const sf::Vector2u sizes[] = {{60, 33}, {256, 256}, {1024, 1024}};
+    bool shaderPath = TileIndexRenderer::isAvailable();
+
+    for (const sf::Vector2u& size : sizes)
+    {
+        std::string prefix = "TileMap/" + std::to_string(size.x) + "x" + std::to_string(size.y);
+        if (!runner.shouldRun(prefix)) continue;
+
+        TileMap tileMap(static_cast<int>(size.x), static_cast<int>(size.y));
+        SyntheticMap map(SyntheticMap::Kind::OpenField, static_cast<int>(size.x), static_cast<int>(size.y), MAP_SEED);
+        map.forEachTile([&](int x, int y, std::uint8_t type, std::uint8_t shape) {
+            tileMap.setTile(x, y, static_cast<TileMap::TileType>(type));
+            tileMap.setTileShape(x, y, static_cast<TileMap::CollisionShape>(shape));
+        });
+
+        sf::Vector2f mapSize(static_cast<float>(size.x * TileMap::TILE_SIZE), static_cast<float>(size.y * TileMap::TILE_SIZE));
+
+        // 게임 화면 크기 뷰 (맵 바닥 쪽) / 맵 전체를 한 화면에 담은 뷰
+        sf::View playView(sf::FloatRect({0.f, std::max(0.f, mapSize.y - GAME_TARGET_SIZE.y)}, sf::Vector2f(GAME_TARGET_SIZE)));
+        float overviewScale = std::max(mapSize.x / GAME_TARGET_SIZE.x, mapSize.y / GAME_TARGET_SIZE.y);
+        sf::View overview(mapSize / 2.f, sf::Vector2f(GAME_TARGET_SIZE) * overviewScale);
+
+        const std::pair<const char*, sf::View> views[] = {{"play", playView}, {"overview", overview}};
+        for (const auto& [name, view] : views)
+        {
+            const sf::View& caseView = view;
+            runner.run(prefix + "/" + name, BenchmarkRunner::milliseconds("ms/frame"), 1.0, [&](BenchmarkRunner::State& state) {
+                renderFrame(target, state, [&] {
+                    RenderStats::setView(target, caseView);
+                    target.draw(tileMap);
+                });
+                state.setCounter("shaderPath", shaderPath);
+                if (shaderPath)
+                {
+                    // 인덱스 텍스처 경로는 보이는 페이지마다 draw call 하나
+                    const RenderStats::Counters& total = RenderStats::current().getLastFrame().total;
+                    state.expect(total.drawCalls >= 1 && total.drawCalls <= pageCount(size.x, size.y),
+                                 "tile map should take one draw call per visible index page");
+                }
+            });
+        }
+    }
+}
+
+void fillInventory(InventoryWindow& inventory)
+{
+    int total = InventoryWindow::GRID_COLS * InventoryWindow::GRID_ROWS;
+    for (int i = 0; i < total; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            inventory.setItem(i, Item(i + 1, "Weapon " + std::to_string(i), SpriteSheetType::Weapons, i % 8, (i / 8) % 5,
+                                      EquipmentSlot::Weapon));
+        }
+        else
+        {
+            inventory.setItem(i, Item(i + 1, "Armor " + std::to_string(i), SpriteSheetType::Items, i % 8, (i / 8) % 5,
+                                      EquipmentSlot::Armor));
+        }
+    }
+}
+
+void fillEquipment(EquipmentWindow& equipment)
+{
+    equipment.setItem(EquipmentSlot::Weapon, Item(101, "Iron Sword", SpriteSheetType::Weapons, 0, 0, EquipmentSlot::Weapon));
+    equipment.setItem(EquipmentSlot::Shield, Item(102, "Wood Shield", SpriteSheetType::Weapons, 5, 1, EquipmentSlot::Shield));
+    equipment.setItem(EquipmentSlot::Helmet, Item(103, "Iron Helmet", SpriteSheetType::Weapons, 2, 1, EquipmentSlot::Helmet));
+    equipment.setItem(EquipmentSlot::Armor, Item(104, "Chain Mail", SpriteSheetType::Items, 2, 0, EquipmentSlot::Armor));
+    equipment.setItem(EquipmentSlot::Gloves, Item(105, "Iron Gloves", SpriteSheetType::Weapons, 6, 4, EquipmentSlot::Gloves));
+    equipment.setItem(EquipmentSlot::Boots, Item(106, "Leather Boots", SpriteSheetType::Weapons, 0, 4, EquipmentSlot::Boots));
+}
+
+void benchmarkUI(BenchmarkRunner& runner, sf::RenderTexture& target)
+{
+    if (!runner.shouldRun("UI/")) return;
+
+    // 리소스가 없으면 폴백 색상/빈 텍스트로 그려짐 (draw call 구조는 같음)
+    sf::Font font;
+    if (!font.openFromFile("/System/Library/Fonts/Supplemental/Arial.ttf") &&
+        !font.openFromFile("/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf"))
+    {
+        LOG_WARN("No font found, UI text will be empty");
+    }
+    sf::Texture itemsTexture;
+    sf::Texture weaponsTexture;
+    bool hasTextures = itemsTexture.loadFromFile("items.png") && weaponsTexture.loadFromFile("weapons.png");
+    if (!hasTextures)
+    {
+        LOG_WARN("items.png / weapons.png not found, items use fallback colors");
+    }
+
+    sf::View uiView(sf::FloatRect({0.f, 0.f}, sf::Vector2f(GAME_TARGET_SIZE)));
+
+    InventoryWindow bag({50.f, 100.f}, font, "Bag");
+    InventoryWindow storage({400.f, 100.f}, font, "Storage");
+    EquipmentWindow equipment({750.f, 100.f}, font);
+    for (InventoryWindow* inventory : {&bag, &storage})
+    {
+        inventory->setUIView(&uiView);
+        if (hasTextures)
+        {
+            inventory->setItemsTexture(&itemsTexture);
+            inventory->setWeaponsTexture(&weaponsTexture);
+        }
+        fillInventory(*inventory);
+    }
+    equipment.setUIView(&uiView);
+    if (hasTextures)
+    {
+        equipment.setItemsTexture(&itemsTexture);
+        equipment.setWeaponsTexture(&weaponsTexture);
+    }
+    fillEquipment(equipment);
+
+    // 게임과 같은 경로: 시뮬레이션 스레드가 DrawList에 기록하고 렌더 스레드가 재생
+    DrawList list;
+    auto record = [&](auto&&... widgets) {
+        list.clear();
+        (list.draw(widgets), ...);
+    };
+
+    runner.run("UI/Inventory/record", BenchmarkRunner::milliseconds("ms/frame"), 1.0, [&](BenchmarkRunner::State& state) {
+        record(bag);
+        state.setCounter("commands", static_cast<double>(list.size()));
+    });
+
+    auto replayCase = [&](const std::string& name, auto&&... widgets) {
+        record(widgets...);
+        runner.run(name, BenchmarkRunner::milliseconds("ms/frame"), 1.0, [&](BenchmarkRunner::State& state) {
+            renderFrame(target, state, [&] {
+                RenderStats::setView(target, uiView);
+                list.replay(target);
+            });
+            state.expect(RenderStats::current().getLastFrame().total.drawCalls >= list.size(),
+                         "every recorded UI command should reach the target");
+        });
+    };
+    replayCase("UI/Inventory/replay", bag);
+    replayCase("UI/Equipment/replay", equipment);
+    replayCase("UI/All/replay", bag, storage, equipment);
+}
+
+void benchmarkEditor(BenchmarkRunner& runner, sf::RenderTexture& target)
+{
+    if (!runner.shouldRun("Editor/")) return;
+
+    const sf::Vector2u sizes[] = {{60, 33}, {256, 256}, {512, 512}};
+    const float zooms[] = {0.25f, 1.f, 4.f};
+
+    Editor editor(target);
+    for (const sf::Vector2u& size : sizes)
+    {
+        std::string prefix = "Editor/" + std::to_string(size.x) + "x" + std::to_string(size.y);
+        if (!runner.shouldRun(prefix)) continue;
+
+        // 이전 크기의 타일을 지우고 새 맵을 채움
+        editor.resizeMap(0, 0);
+        editor.resizeMap(static_cast<int>(size.x), static_cast<int>(size.y));
+        SyntheticMap map(SyntheticMap::Kind::Cave, static_cast<int>(size.x), static_cast<int>(size.y), MAP_SEED);
+        map.forEachTile([&](int x, int y, std::uint8_t type, std::uint8_t shape) {
+            editor.setTile(x, y, static_cast<TileType>(type));
+            editor.setTileShape(x, y, static_cast<CollisionShape>(shape));
+        });
+        editor.setCollisionOverlayVisible(false);
+
+        sf::Vector2f center(size.x * 32.f / 2.f, size.y * 32.f / 2.f);
+        for (float zoom : zooms)
+        {
+            editor.setCamera(center, zoom);
+            std::string suffix = "/zoom" + std::to_string(static_cast<int>(std::lround(zoom * 100.f)));
+
+            auto pass = [&](const char* name, auto&& renderPass) {
+                runner.run(prefix + "/" + name + suffix, BenchmarkRunner::milliseconds("ms/frame"), 1.0,
+                           [&](BenchmarkRunner::State& state) {
+                               renderFrame(target, state, [&] {
+                                   editor.beginMapRender();
+                                   renderPass();
+                               });
+                           });
+            };
+            pass("Grid", [&] { editor.renderGrid(); });
+            pass("Tiles", [&] { editor.renderTiles(); });
+            pass("CollisionOverlay", [&] { editor.renderCollisionOverlay(); });
+        }
+    }
+
+    // 영역 편집 (4096x1024 맵, 채우기 하나가 실행 취소 기록 하나)
+    if (runner.shouldRun("Editor/Edit/"))
+    {
+        editor.resizeMap(0, 0);
+        editor.resizeMap(4096, 1024);
+        const sf::IntRect wholeMap({0, 0}, {4096, 1024});
+        const sf::IntRect region({48, 12}, {4000, 1000});
+        const EditorTile solid{TileType::Solid, CollisionShape::Full};
+
+        runner.runWithSetup("Editor/Edit/FillRect4000x1000", BenchmarkRunner::milliseconds("ms/op"), 1.0,
+                            [&] { editor.fillRect(wholeMap, EditorTile{}); },
+                            [&](BenchmarkRunner::State& state) {
+                                editor.fillRect(region, solid);
+                                state.expect(editor.getTile(4047, 1011) == TileType::Solid, "rect filled");
+                            });
+        runner.runWithSetup("Editor/Edit/FloodFill4096x1024", BenchmarkRunner::milliseconds("ms/op"), 1.0,
+                            [&] {
+                                editor.fillRect(wholeMap, EditorTile{});
+                                editor.fillRect({{0, 512}, {4096, 1}}, solid);
+                            },
+                            [&](BenchmarkRunner::State& state) {
+                                editor.floodFill(100, 100, solid);
+                                state.expect(editor.getTile(4095, 511) == TileType::Solid, "upper half filled");
+                                state.expect(editor.getTile(0, 513) == TileType::Empty, "wall stops the fill");
+                            });
+    }
+
+    // 맵 전체가 보이게 축소한 큰 맵 (인덱스 페이지마다 팔레트 색 사각형 하나, 타일을 바꾸면 그 영역만 다시 올림)
+    if (runner.shouldRun("Editor/Lod/"))
+    {
+        editor.resizeMap(0, 0);
+        editor.resizeMap(8192, 4096);
+        const EditorTile solid{TileType::Solid, CollisionShape::Full};
+        for (int y = 0; y < 4096; y += 64)
+        {
+            editor.fillRect({{0, y}, {8192, 16}}, solid);
+        }
+        editor.setCamera({8192 * 32.f / 2.f, 4096 * 32.f / 2.f}, 1000.f);  // 최대 줌으로 제한됨
+
+        auto lodFrame = [&](BenchmarkRunner::State& state) {
+            renderFrame(target, state, [&] {
+                editor.beginMapRender();
+                editor.renderTiles();
+            });
+        };
+        runner.run("Editor/Lod/8192x4096/Tiles", BenchmarkRunner::milliseconds("ms/frame"), 1.0, lodFrame);
+
+        int x = 0;
+        runner.run("Editor/Lod/8192x4096/EditTiles", BenchmarkRunner::milliseconds("ms/frame"), 1.0,
+                   [&](BenchmarkRunner::State& state) {
+                       editor.setTile(x % 8192, 32, x < 8192 ? TileType::Platform : TileType::Empty);
+                       x = (x + 1) % (8192 * 2);
+                       lodFrame(state);
+                   });
+    }
+
+    // 큰 맵의 미니맵 (처음 전체를 센 뒤에는 setTile로 바뀐 블록 하나만 다시 세서 올림)
+    if (runner.shouldRun("Editor/Minimap/"))
+    {
+        editor.resizeMap(0, 0);
+        editor.resizeMap(8192, 4096);
+        const EditorTile solid{TileType::Solid, CollisionShape::Full};
+        for (int y = 0; y < 4096; y += 64)
+        {
+            editor.fillRect({{0, y}, {8192, 16}}, solid);
+        }
+        target.setView(target.getDefaultView());
+        do
+        {
+            editor.renderMinimap();
+        } while (editor.getMinimap().getPendingBlockCount() > 0);
+
+        int x = 0;
+        runner.run("Editor/Minimap/8192x4096/EditTiles", BenchmarkRunner::milliseconds("ms/frame"), 1.0,
+                   [&](BenchmarkRunner::State& state) {
+                       editor.setTile(x % 8192, 32, x < 8192 ? TileType::Platform : TileType::Empty);
+                       x = (x + 1) % (8192 * 2);
+                       renderFrame(target, state, [&] {
+                           target.setView(target.getDefaultView());
+                           editor.renderMinimap();
+                       });
+                   });
+    }
+}
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkRunner runner(argc, argv);
+    if (!runner.isValid()) return runner.finish();
+
+    sf::RenderTexture gameTarget;
+    sf::RenderTexture editorTarget;
+    if (!gameTarget.resize(GAME_TARGET_SIZE) || !editorTarget.resize(EDITOR_TARGET_SIZE))
+    {
+        LOG_ERROR("Failed to create render textures (no OpenGL context available?)");
+        return 1;
+    }
+
+    benchmarkTileMap(runner, gameTarget);
+    benchmarkUI(runner, gameTarget);
+    benchmarkEditor(runner, editorTarget);
+
+    int exitCode = runner.finish();
+    Log::instance().flush();
+    return exitCode;
+}
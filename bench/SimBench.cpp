@@ -0,0 +1,196 @@
+// 물리/AI 마이크로벤치마크 (창 없이 Player::update, Enemy::update, TileMap 쿼리)
+//
+// 합성 맵(동굴/평지/긴 바닥)과 스폰 위치, 쿼리 좌표는 모두 고정 시드로 만들어서
+// 커밋 사이에 같은 작업량을 비교할 수 있음 (--json / --baseline은 Benchmark.hpp 참고)
+// 엔티티 업데이트는 ns/entity-step, 타일 쿼리는 ns/query로 보고함
+// 반복마다 엔티티를 처음 상태로 되돌리고(측정 밖) 같은 스텝 수만큼 돌림
+
+#include "Benchmark.hpp"
+#include "SyntheticMap.hpp"
+#include "TileMap.hpp"
+#include "Player.hpp"
+#include "Enemy.hpp"
+#include "Log.hpp"
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr float STEP_SECONDS = 1.f / 144.f;  // 게임 시뮬레이션과 같은 고정 스텝
+constexpr std::uint32_t MAP_SEED = 20240611;
+constexpr std::uint32_t QUERY_SEED = 7;
+constexpr int QUERY_COUNT = 1 << 20;
+
+struct MapCase
+{
+    SyntheticMap::Kind kind;
+    int width;
+    int height;
+};
+
+const MapCase MAP_CASES[] = {
+    {SyntheticMap::Kind::Cave, 512, 256},
+    {SyntheticMap::Kind::OpenField, 2048, 64},
+    {SyntheticMap::Kind::LongFloor, 16384, 12},
+};
+
+std::string mapName(const MapCase& mapCase)
+{
+    return std::string(SyntheticMap::kindName(mapCase.kind)) + "_" + std::to_string(mapCase.width) + "x" +
+           std::to_string(mapCase.height);
+}
+
+void fillTileMap(const SyntheticMap& map, TileMap& tileMap)
+{
+    map.forEachTile([&](int x, int y, std::uint8_t type, std::uint8_t shape) {
+        tileMap.setTile(x, y, static_cast<TileMap::TileType>(type));
+        tileMap.setTileShape(x, y, static_cast<TileMap::CollisionShape>(shape));
+    });
+}
+
+// 설 수 있는 칸 위에 엔티티를 놓음 (바닥에 붙여서)
+template<typename Entity>
+std::vector<Entity> spawnEntities(const SyntheticMap& map, std::size_t count, float entityHeight)
+{
+    std::vector<Entity> entities;
+    entities.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        int x = 1;
+        int y = 1;
+        map.findStandingSpot(static_cast<std::uint32_t>(i), x, y);
+        float tile = static_cast<float>(TileMap::TILE_SIZE);
+        entities.emplace_back(sf::Vector2f(x * tile, (y + 1) * tile - entityHeight));
+    }
+    return entities;
+}
+
+std::size_t stepsFor(std::size_t entityCount)
+{
+    // 엔티티 수가 적으면 스텝을 늘려서 반복당 작업량을 비슷하게 맞춤
+    return std::max<std::size_t>(16, 65536 / entityCount);
+}
+
+void benchmarkEnemies(BenchmarkRunner& runner, const MapCase& mapCase, const SyntheticMap& map, const TileMap& tileMap)
+{
+    const std::size_t counts[] = {1, 100, 10000, 100000};
+    for (std::size_t count : counts)
+    {
+        std::string name = "Enemy::update/" + mapName(mapCase) + "/N=" + std::to_string(count);
+        if (!runner.shouldRun(name)) continue;
+
+        const std::vector<Enemy> initial = spawnEntities<Enemy>(map, count, Enemy::HEIGHT);
+        std::vector<Enemy> enemies;
+        std::size_t steps = stepsFor(count);
+
+        runner.runWithSetup(
+            name, BenchmarkRunner::nanoseconds("ns/entity-step"), static_cast<double>(count * steps),
+            [&] { enemies = initial; },
+            [&](BenchmarkRunner::State& state) {
+                for (std::size_t step = 0; step < steps; ++step)
+                {
+                    for (Enemy& enemy : enemies)
+                    {
+                        enemy.update(STEP_SECONDS, &tileMap);
+                    }
+                }
+                BenchmarkRunner::doNotOptimize(enemies.front().getPosition());
+                state.setCounter("steps", static_cast<double>(steps));
+            });
+    }
+}
+
+void benchmarkPlayers(BenchmarkRunner& runner, const MapCase& mapCase, const SyntheticMap& map, const TileMap& tileMap)
+{
+    const std::size_t counts[] = {1, 1000};
+    for (std::size_t count : counts)
+    {
+        std::string name = "Player::update/" + mapName(mapCase) + "/N=" + std::to_string(count);
+        if (!runner.shouldRun(name)) continue;
+
+        // 입력이 없으므로 넉백으로 좌우/위 방향 이동을 만들어서 충돌 처리를 거치게 함
+        std::vector<Player> initial = spawnEntities<Player>(map, count, Player::HEIGHT);
+        for (std::size_t i = 0; i < initial.size(); ++i)
+        {
+            sf::Vector2f center = initial[i].getCenter();
+            float side = (i % 2 == 0) ? -1.f : 1.f;
+            initial[i].takeHit(0.f, 600.f, center + sf::Vector2f(side * 10.f, 0.f));
+        }
+        std::vector<Player> players;
+        std::size_t steps = stepsFor(count);
+
+        runner.runWithSetup(
+            name, BenchmarkRunner::nanoseconds("ns/entity-step"), static_cast<double>(count * steps),
+            [&] { players = initial; },
+            [&](BenchmarkRunner::State& state) {
+                for (std::size_t step = 0; step < steps; ++step)
+                {
+                    for (Player& player : players)
+                    {
+                        player.update(STEP_SECONDS, &tileMap);
+                    }
+                }
+                BenchmarkRunner::doNotOptimize(players.front().getPosition());
+                state.setCounter("steps", static_cast<double>(steps));
+            });
+    }
+}
+
+void benchmarkQueries(BenchmarkRunner& runner, const MapCase& mapCase, const TileMap& tileMap)
+{
+    std::string prefix = "TileMap/" + mapName(mapCase);
+
+    // 맵 안쪽 좌표에 경계 밖 좌표를 조금 섞음 (맵 밖 처리 분기 포함)
+    std::mt19937 random(QUERY_SEED);
+    std::vector<sf::Vector2i> queries(QUERY_COUNT);
+    int width = tileMap.getWidth();
+    int height = tileMap.getHeight();
+    for (auto& query : queries)
+    {
+        query.x = static_cast<int>(random() % static_cast<std::uint32_t>(width + 32)) - 16;
+        query.y = static_cast<int>(random() % static_cast<std::uint32_t>(height + 2)) - 1;
+    }
+
+    runner.run(prefix + "/isSolid", BenchmarkRunner::nanoseconds("ns/query"), QUERY_COUNT, [&](BenchmarkRunner::State& state) {
+        std::size_t solid = 0;
+        for (const sf::Vector2i& query : queries)
+        {
+            solid += tileMap.isSolid(query.x, query.y);
+        }
+        BenchmarkRunner::doNotOptimize(solid);
+        state.setCounter("solidPercent", solid * 100.0 / QUERY_COUNT);
+    });
+
+    runner.run(prefix + "/getTileShape", BenchmarkRunner::nanoseconds("ns/query"), QUERY_COUNT, [&](BenchmarkRunner::State&) {
+        std::size_t shapes = 0;
+        for (const sf::Vector2i& query : queries)
+        {
+            shapes += static_cast<std::size_t>(tileMap.getTileShape(query.x, query.y));
+        }
+        BenchmarkRunner::doNotOptimize(shapes);
+    });
+}
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkRunner runner(argc, argv);
+    if (!runner.isValid()) return runner.finish();
+
+    for (const MapCase& mapCase : MAP_CASES)
+    {
+        SyntheticMap map(mapCase.kind, mapCase.width, mapCase.height, MAP_SEED);
+        TileMap tileMap(mapCase.width, mapCase.height);
+        fillTileMap(map, tileMap);
+
+        benchmarkEnemies(runner, mapCase, map, tileMap);
+        benchmarkPlayers(runner, mapCase, map, tileMap);
+        benchmarkQueries(runner, mapCase, tileMap);
+    }
+
+    int exitCode = runner.finish();
+    Log::instance().flush();
+    return exitCode;
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// 벤치마크용 합성 맵 (같은 시드면 어느 플랫폼에서나 같은 맵)
+// 타입/형태 값은 게임 TileMap과 에디터의 TileType/CollisionShape 값과 같음
+// (std::uniform_int_distribution은 표준 라이브러리마다 결과가 달라서 mt19937 출력을 직접 나눠 씀)
+class SyntheticMap
+{
+public:
+    enum class Kind
+    {
+        Cave,       // 세포 자동자로 만든 빽빽한 동굴 (경사면 포함)
+        OpenField,  // 바닥 + 흩어진 플랫폼과 기둥
+        LongFloor   // 긴 바닥에 가끔 경사면/반 타일 굴곡
+    };
+
+    struct Tile
+    {
+        std::uint8_t type = 0;   // 0 Empty, 1 Solid, 2 Platform
+        std::uint8_t shape = 0;  // CollisionShape 값
+    };
+
+    static constexpr std::uint8_t EMPTY = 0;
+    static constexpr std::uint8_t SOLID = 1;
+    static constexpr std::uint8_t PLATFORM = 2;
+
+    static constexpr std::uint8_t SHAPE_NONE = 0;
+    static constexpr std::uint8_t SHAPE_FULL = 1;
+    static constexpr std::uint8_t SHAPE_SLOPE_LEFT_UP = 2;
+    static constexpr std::uint8_t SHAPE_SLOPE_RIGHT_UP = 3;
+    static constexpr std::uint8_t SHAPE_HALF_TOP = 4;
+    static constexpr std::uint8_t SHAPE_HALF_BOTTOM = 5;
+    static constexpr std::uint8_t SHAPE_PLATFORM = 8;
+
+    static const char* kindName(Kind kind)
+    {
+        switch (kind)
+        {
+            case Kind::Cave: return "Cave";
+            case Kind::OpenField: return "OpenField";
+            case Kind::LongFloor: return "LongFloor";
+        }
+        return "Unknown";
+    }
+
+    SyntheticMap(Kind kind, int width, int height, std::uint32_t seed)
+        : m_width(width)
+        , m_height(height)
+        , m_tiles(static_cast<std::size_t>(width) * height)
+        , m_random(seed)
+    {
+        switch (kind)
+        {
+            case Kind::Cave: generateCave(); break;
+            case Kind::OpenField: generateOpenField(); break;
+            case Kind::LongFloor: generateLongFloor(); break;
+        }
+    }
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+
+    const Tile& at(int x, int y) const { return m_tiles[static_cast<std::size_t>(y) * m_width + x]; }
+
+    bool isOpen(int x, int y) const
+    {
+        return x >= 0 && x < m_width && y >= 0 && y < m_height && at(x, y).type == EMPTY;
+    }
+
+    // 비어있지 않은 타일마다 f(x, y, type, shape) 호출
+    template<typename F>
+    void forEachTile(F&& f) const
+    {
+        for (int y = 0; y < m_height; ++y)
+        {
+            for (int x = 0; x < m_width; ++x)
+            {
+                const Tile& tile = at(x, y);
+                if (tile.type != EMPTY) f(x, y, tile.type, tile.shape);
+            }
+        }
+    }
+
+    // 2x2 타일 크기의 엔티티가 설 수 있는 칸 (2x2가 비어있고 바로 아래가 막혀있음) 중 하나를 결정적으로 고름
+    // index가 같으면 항상 같은 칸, 설 곳이 없으면 false
+    bool findStandingSpot(std::uint32_t index, int& outX, int& outY) const
+    {
+        std::size_t count = m_tiles.size();
+        if (count == 0) return false;
+        std::size_t start = static_cast<std::size_t>(index) * 2654435761u % count;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::size_t cell = (start + i) % count;
+            int x = static_cast<int>(cell % m_width);
+            int y = static_cast<int>(cell / m_width);
+            bool open = isOpen(x, y) && isOpen(x + 1, y) && isOpen(x, y - 1) && isOpen(x + 1, y - 1);
+            if (open && !isOpen(x, y + 1) && y + 1 < m_height)
+            {
+                outX = x;
+                outY = y;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    Tile& tile(int x, int y) { return m_tiles[static_cast<std::size_t>(y) * m_width + x]; }
+
+    int randomInt(int minValue, int maxValue)
+    {
+        return minValue + static_cast<int>(m_random() % static_cast<std::uint32_t>(maxValue - minValue + 1));
+    }
+
+    void setSolid(int x, int y, std::uint8_t shape = SHAPE_FULL)
+    {
+        if (x < 0 || x >= m_width || y < 0 || y >= m_height) return;
+        tile(x, y) = {SOLID, shape};
+    }
+
+    void generateCave()
+    {
+        std::vector<std::uint8_t> solid(m_tiles.size());
+        for (int y = 0; y < m_height; ++y)
+        {
+            for (int x = 0; x < m_width; ++x)
+            {
+                bool border = x == 0 || y == 0 || x == m_width - 1 || y == m_height - 1;
+                solid[y * m_width + x] = border || randomInt(0, 99) < 45;
+            }
+        }
+
+        // 주변 8칸 중 5칸 이상이 막혀있으면 막힘
+        std::vector<std::uint8_t> next(solid.size());
+        for (int pass = 0; pass < 4; ++pass)
+        {
+            for (int y = 0; y < m_height; ++y)
+            {
+                for (int x = 0; x < m_width; ++x)
+                {
+                    int neighbors = 0;
+                    for (int dy = -1; dy <= 1; ++dy)
+                    {
+                        for (int dx = -1; dx <= 1; ++dx)
+                        {
+                            if (dx == 0 && dy == 0) continue;
+                            int nx = x + dx;
+                            int ny = y + dy;
+                            bool outside = nx < 0 || ny < 0 || nx >= m_width || ny >= m_height;
+                            neighbors += outside || solid[ny * m_width + nx];
+                        }
+                    }
+                    next[y * m_width + x] = neighbors >= 5 || (neighbors == 4 && solid[y * m_width + x]);
+                }
+            }
+            solid.swap(next);
+        }
+
+        for (int y = 0; y < m_height; ++y)
+        {
+            for (int x = 0; x < m_width; ++x)
+            {
+                if (solid[y * m_width + x]) setSolid(x, y);
+            }
+        }
+
+        // 위가 비어있는 모서리는 경사면으로
+        for (int y = 1; y < m_height - 1; ++y)
+        {
+            for (int x = 1; x < m_width - 1; ++x)
+            {
+                if (at(x, y).type != SOLID || !isOpen(x, y - 1)) continue;
+                bool openLeft = isOpen(x - 1, y);
+                bool openRight = isOpen(x + 1, y);
+                if (openLeft && !openRight) tile(x, y).shape = SHAPE_SLOPE_LEFT_UP;
+                else if (openRight && !openLeft) tile(x, y).shape = SHAPE_SLOPE_RIGHT_UP;
+            }
+        }
+    }
+
+    void generateOpenField()
+    {
+        for (int x = 0; x < m_width; ++x)
+        {
+            setSolid(x, m_height - 1);
+            setSolid(x, m_height - 2);
+        }
+
+        // 6줄마다 플랫폼 띠, 가끔 기둥
+        for (int y = m_height - 6; y > 2; y -= 6)
+        {
+            for (int x = randomInt(0, 8); x < m_width; x += randomInt(6, 16))
+            {
+                int length = randomInt(3, 8);
+                for (int i = 0; i < length && x + i < m_width; ++i)
+                {
+                    tile(x + i, y) = {PLATFORM, SHAPE_PLATFORM};
+                }
+            }
+        }
+        for (int x = randomInt(4, 20); x < m_width; x += randomInt(20, 40))
+        {
+            int top = m_height - 2 - randomInt(2, 5);
+            for (int y = top; y < m_height - 2; ++y)
+            {
+                setSolid(x, y);
+            }
+            setSolid(x, top - 1, SHAPE_HALF_BOTTOM);
+        }
+    }
+
+    void generateLongFloor()
+    {
+        int floorY = m_height - 3;
+        for (int x = 0; x < m_width; ++x)
+        {
+            for (int y = floorY; y < m_height; ++y)
+            {
+                setSolid(x, y);
+            }
+        }
+
+        // 굴곡: 오르막 경사 - 한 칸 턱 - 내리막 경사
+        for (int x = randomInt(8, 24); x + 4 < m_width; x += randomInt(16, 48))
+        {
+            setSolid(x, floorY - 1, SHAPE_SLOPE_LEFT_UP);
+            setSolid(x + 1, floorY - 1);
+            setSolid(x + 2, floorY - 1, SHAPE_HALF_TOP);
+            setSolid(x + 3, floorY - 1, SHAPE_SLOPE_RIGHT_UP);
+        }
+    }
+
+    int m_width;
+    int m_height;
+    std::vector<Tile> m_tiles;
+    std::mt19937 m_random;
+};
@@ -0,0 +1,54 @@
+// 맵 로더 libFuzzer 하네스 (TileMap::readFile, MapFile::MapData::loadFromStream, 에디터 가져오기의 FlatMapFile::read)
+//
+// Clang으로 -DGIVEITUP_FUZZERS=ON 빌드 후:
+//   ./map_loader_fuzz -rss_limit_mb=512 -max_len=4096 ../fuzz/corpus
+// 입력은 세 로더에 모두 넘김 (모두 "TMAP"으로 시작하는 .tilemap)
+// 메모리 상한을 작게 줘서 상한 검사를 건너뛰는 할당이 생기면 rss_limit에 걸리게 함
+
+#include "TileMap.hpp"
+#include "MapFileFormat.hpp"
+#include "Editor.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace
+{
+constexpr std::size_t FUZZ_MEMORY_LIMIT = 64u * 1024u * 1024u;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    LoadLimits limits;
+    limits.maxMemoryBytes = FUZZ_MEMORY_LIMIT;
+    const std::string bytes(reinterpret_cast<const char*>(data), size);
+
+    {
+        std::istringstream stream(bytes);
+        TileMap::FileContents contents;
+        if (TileMap::readFile(stream, contents, limits))
+        {
+            // 읽은 결과는 항상 격자 크기와 맞아야 함
+            if (contents.tiles.size() != static_cast<std::size_t>(contents.width) * contents.height) __builtin_trap();
+        }
+    }
+    {
+        std::istringstream stream(bytes);
+        MapFile::MapData map;
+        (void)map.loadFromStream(stream, limits);
+    }
+    {
+        std::istringstream stream(bytes);
+        FlatMapFile::Contents contents;
+        if (FlatMapFile::read(stream, contents, EditorLayer::gridCost(), limits))
+        {
+            // 에디터는 검사 없이 edit(x, y)로 넣으므로 모든 타일이 맵 안이어야 함
+            for (const FlatMapFile::Tile& tile : contents.tiles)
+            {
+                if (tile.x >= contents.width || tile.y >= contents.height) __builtin_trap();
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "InputState.hpp"
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+// 게임 액션
+enum class Action
+{
+    MoveLeft,
+    MoveRight,
+    Jump,
+    Dash,
+    Slash,
+    Thrust,
+    Uppercut,
+    ToggleBag,
+    ToggleEquipment,
+    Count
+};
+
+// 액션 -> 키 바인딩 (액션 하나에 여러 키)
+// 액션마다 키 비트 마스크를 들고 있어서 조회는 InputState 비트셋과 AND 한 번
+class ActionMap
+{
+public:
+    static constexpr std::size_t ACTION_COUNT = static_cast<std::size_t>(Action::Count);
+
+    // 기본 키 배치
+    static ActionMap defaults()
+    {
+        using Key = sf::Keyboard::Key;
+        ActionMap map;
+        map.bind(Action::MoveLeft, {Key::Left, Key::A});
+        map.bind(Action::MoveRight, {Key::Right, Key::D});
+        map.bind(Action::Jump, {Key::Space, Key::Up, Key::W});
+        map.bind(Action::Dash, {Key::LShift});
+        map.bind(Action::Slash, {Key::Z});
+        map.bind(Action::Thrust, {Key::X});
+        map.bind(Action::Uppercut, {Key::C});
+        map.bind(Action::ToggleBag, {Key::B});
+        map.bind(Action::ToggleEquipment, {Key::I});
+        return map;
+    }
+
+    void bind(Action action, std::initializer_list<sf::Keyboard::Key> keys)
+    {
+        for (sf::Keyboard::Key key : keys)
+        {
+            int index = InputState::keyIndex(key);
+            if (index >= 0) m_bindings[slot(action)].set(index);
+        }
+    }
+
+    void unbindAll(Action action) { m_bindings[slot(action)].reset(); }
+
+    bool isDown(Action action, const InputState& input) const { return (input.getDown() & m_bindings[slot(action)]).any(); }
+    bool wasPressed(Action action, const InputState& input) const { return (input.getPressed() & m_bindings[slot(action)]).any(); }
+    bool wasReleased(Action action, const InputState& input) const { return (input.getReleased() & m_bindings[slot(action)]).any(); }
+
+private:
+    static std::size_t slot(Action action) { return static_cast<std::size_t>(action); }
+
+    std::array<InputState::KeyBits, ACTION_COUNT> m_bindings;
+};
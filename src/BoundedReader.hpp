@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+
+// 믿을 수 없는 맵 파일을 읽을 때 쓰는 메모리 상한
+struct LoadLimits
+{
+    static constexpr std::size_t DEFAULT_MAX_MEMORY = 256u * 1024u * 1024u;
+
+    std::size_t maxMemoryBytes = DEFAULT_MAX_MEMORY;  // 로더가 파일 내용 때문에 할당하는 총량 상한
+};
+
+// 스트림 끝까지 남은 바이트 수를 알고 읽는 바이너리 리더
+// - read는 다 읽지 못하면 false (잘린 파일)
+// - reserve는 헤더의 개수를 할당 전에 남은 파일 크기와 메모리 예산으로 확인함
+//   (20바이트짜리 파일이 "타일 40억 개"라고 해도 할당하지 않음)
+class BoundedReader
+{
+public:
+    BoundedReader(std::istream& stream, const LoadLimits& limits)
+        : m_stream(stream)
+        , m_memoryLeft(limits.maxMemoryBytes)
+    {
+        std::streampos start = stream.tellg();
+        stream.seekg(0, std::ios::end);
+        std::streampos end = stream.tellg();
+        stream.seekg(start);
+        if (start >= 0 && end >= start && stream.good())
+        {
+            m_remaining = static_cast<std::uint64_t>(end - start);
+        }
+        else
+        {
+            m_failed = true;
+        }
+    }
+
+    template<typename T>
+    bool read(T& value)
+    {
+        return readBytes(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+
+    bool readBytes(char* out, std::size_t size)
+    {
+        if (m_failed || size > m_remaining) return fail();
+        if (size > 0 && !m_stream.read(out, static_cast<std::streamsize>(size))) return fail();
+        m_remaining -= size;
+        return true;
+    }
+
+    // count개 레코드(파일에서 recordSize 바이트, 메모리에서 elementSize 바이트)를 읽기 전에 확인
+    bool reserve(std::uint64_t count, std::size_t recordSize, std::size_t elementSize)
+    {
+        if (m_failed) return false;
+        if (recordSize > 0 && count > m_remaining / recordSize) return fail();
+        return charge(count, elementSize);
+    }
+
+    // 파일 크기와 상관없이 할당하는 메모리 (빈 칸까지 들고 있는 격자 등)
+    bool charge(std::uint64_t count, std::size_t elementSize)
+    {
+        if (m_failed) return false;
+        if (elementSize > 0 && count > m_memoryLeft / elementSize) return fail();
+        m_memoryLeft -= static_cast<std::size_t>(count) * elementSize;
+        return true;
+    }
+
+    std::uint64_t remaining() const { return m_remaining; }
+    bool failed() const { return m_failed; }
+
+private:
+    bool fail()
+    {
+        m_failed = true;
+        return false;
+    }
+
+    std::istream& m_stream;
+    std::uint64_t m_remaining = 0;
+    std::size_t m_memoryLeft;
+    bool m_failed = false;
+};
@@ -107,13 +107,20 @@ public:
     void setHoverColor(const sf::Color& color) { m_hoverColor = color; updateColor(); }
     void setPressedColor(const sf::Color& color) { m_pressedColor = color; updateColor(); }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // RenderTarget 또는 DrawList(렌더 스냅샷)에 그림
+    template<typename Target>
+    void render(Target& target, sf::RenderStates states) const
     {
         target.draw(m_shape, states);
         target.draw(m_text, states);
     }
 
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        render(target, states);
+    }
+
     void centerText()
     {
         sf::FloatRect textBounds = m_text.getLocalBounds();
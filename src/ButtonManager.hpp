@@ -56,8 +56,9 @@ public:
         return false;
     }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // RenderTarget 또는 DrawList(렌더 스냅샷)에 그림
+    template<typename Target>
+    void render(Target& target, sf::RenderStates states) const
     {
         // 순서대로 그리기 (먼저 추가된 버튼이 아래에)
         for (const auto& button : m_buttons)
@@ -66,5 +67,11 @@ private:
         }
     }
 
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        render(target, states);
+    }
+
     std::vector<std::shared_ptr<Button>> m_buttons;
 };
@@ -226,8 +226,9 @@ public:
         return false;
     }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // RenderTarget 또는 DrawList(렌더 스냅샷)에 그림
+    template<typename Target>
+    void render(Target& target, sf::RenderStates states) const
     {
         if (m_isDragging)
         {
@@ -242,6 +243,12 @@ private:
         }
     }
 
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        render(target, states);
+    }
+
     void updateGhostPosition()
     {
         m_ghostRect.setPosition({m_mousePos.x - 23.f, m_mousePos.y - 23.f});
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "RenderStats.hpp"
+#include <algorithm>
+#include <cstdint>
+
+// 게임 월드를 오프스크린 RenderTexture에 낮춘 해상도로 그리고 창 크기로 늘려서 출력하는 동적 해상도
+//
+// RenderTexture는 원래 해상도로 한 번만 만들고, 뷰의 viewport를 줄여서 왼쪽 위 일부에만 그림
+// (스케일이 바뀔 때마다 텍스처를 다시 만들지 않음)
+// begin부터 창의 display()가 끝날 때까지(endFrame) 걸린 시간이 예산보다 길면 스케일을 내리고, 충분히 오래 여유가 있으면 다시 올림
+// - draw 호출은 큐에 쌓이기만 하고 GPU 채우기 비용은 창 display()에서 드러나므로 display까지 포함해서 잼
+// - 프레임 제한은 display 밖에서 쉬어야 함 (RenderThread::setFrameInterval, setFramerateLimit/vsync는 쓰지 않음)
+// - 벽시계 프레임 시간은 지연/대기 시간을 세는 데만 씀
+class DynamicResolution
+{
+public:
+    enum class Filter
+    {
+        Nearest,
+        Bilinear
+    };
+
+    // 외부에서 볼 수 있는 스케일 결정 지표
+    struct Metrics
+    {
+        float scale = 1.f;                  // 현재 해상도 스케일 (0.5 ~ 1.0)
+        sf::Vector2u renderSize;            // 실제로 그리는 해상도
+        float averageRenderMs = 0.f;        // begin ~ 창 display 완료 시간 이동 평균
+        float lastDisplayMs = 0.f;          // 그중 마지막 프레임이 창 display()에서 GPU를 기다린 시간
+        float budgetMs = 0.f;               // 목표 프레임 시간
+        std::uint32_t scaleDownCount = 0;   // 스케일을 내린 횟수
+        std::uint32_t scaleUpCount = 0;     // 스케일을 올린 횟수
+        bool changedLastFrame = false;      // 마지막 update에서 스케일이 바뀌었는지
+    };
+
+    // 원래 해상도로 오프스크린 타겟 생성
+    bool create(const sf::Vector2u& nativeSize)
+    {
+        if (!m_target.resize(nativeSize)) return false;
+        m_nativeSize = nativeSize;
+        m_target.setSmooth(m_filter == Filter::Bilinear);
+        m_presentView = sf::View(sf::FloatRect({0.f, 0.f}, sf::Vector2f(nativeSize)));
+        updateRenderSize();
+        return true;
+    }
+
+    void setFilter(Filter filter)
+    {
+        m_filter = filter;
+        m_target.setSmooth(filter == Filter::Bilinear);
+    }
+
+    // 스케일 범위 (기본 0.5 ~ 1.0)
+    void setScaleRange(float minScale, float maxScale)
+    {
+        m_minScale = std::clamp(minScale, 0.1f, 1.f);
+        m_maxScale = std::clamp(maxScale, m_minScale, 1.f);
+        m_metrics.scale = std::clamp(m_metrics.scale, m_minScale, m_maxScale);
+        updateRenderSize();
+    }
+
+    // 목표 프레임 시간 (예: 144fps면 1/144초)
+    void setTargetFrameTime(sf::Time frameTime) { m_targetFrameSeconds = frameTime.asSeconds(); }
+
+    // 자동 조절 끄기 (고정 스케일로 사용)
+    void setAutoScale(bool enabled) { m_autoScale = enabled; }
+
+    void setScale(float scale)
+    {
+        m_metrics.scale = std::clamp(scale, m_minScale, m_maxScale);
+        updateRenderSize();
+    }
+
+    // 지난 프레임의 렌더링 시간(begin ~ endFrame)으로 스케일 조절 (프레임마다 한 번 호출)
+    // frameTime은 벽시계 프레임 시간이며 지연/대기 시간을 세는 데만 씀
+    void update(sf::Time frameTime)
+    {
+        float seconds = frameTime.asSeconds();
+        m_metrics.changedLastFrame = false;
+        if (!m_hasRenderTime) return;
+        m_hasRenderTime = false;
+
+        float work = m_lastRenderSeconds;
+        m_averageRenderSeconds = m_averageRenderSeconds <= 0.f
+            ? work
+            : m_averageRenderSeconds + (work - m_averageRenderSeconds) * AVERAGE_WEIGHT;
+
+        m_metrics.averageRenderMs = m_averageRenderSeconds * 1000.f;
+        m_metrics.lastDisplayMs = m_lastDisplaySeconds * 1000.f;
+        m_metrics.budgetMs = m_targetFrameSeconds * 1000.f;
+        if (!m_autoScale) return;
+
+        m_cooldownSeconds = std::max(0.f, m_cooldownSeconds - seconds);
+
+        // 목표보다 느리면 빠르게 내리고, 여유가 있는 상태가 오래 유지되면 천천히 올림 (히스테리시스)
+        if (m_averageRenderSeconds > m_targetFrameSeconds * OVER_BUDGET_RATIO)
+        {
+            m_overBudgetSeconds += seconds;
+            m_underBudgetSeconds = 0.f;
+        }
+        else if (m_averageRenderSeconds < m_targetFrameSeconds * UNDER_BUDGET_RATIO)
+        {
+            m_underBudgetSeconds += seconds;
+            m_overBudgetSeconds = 0.f;
+        }
+        else
+        {
+            m_overBudgetSeconds = 0.f;
+            m_underBudgetSeconds = 0.f;
+        }
+
+        if (m_cooldownSeconds > 0.f) return;
+
+        if (m_overBudgetSeconds >= SCALE_DOWN_DELAY && m_metrics.scale > m_minScale)
+        {
+            changeScale(-SCALE_STEP);
+            ++m_metrics.scaleDownCount;
+        }
+        else if (m_underBudgetSeconds >= SCALE_UP_DELAY && m_metrics.scale < m_maxScale)
+        {
+            changeScale(SCALE_STEP);
+            ++m_metrics.scaleUpCount;
+        }
+    }
+
+    // 월드 렌더링 시작: 오프스크린 타겟을 지우고 viewport를 줄인 뷰를 설정해서 돌려줌
+    sf::RenderTarget& begin(const sf::View& view, const sf::Color& clearColor)
+    {
+        sf::View scaledView = view;
+        scaledView.setViewport(sf::FloatRect({0.f, 0.f}, {m_metrics.scale, m_metrics.scale}));
+        RenderStats::setView(m_target, scaledView);
+        m_renderClock.restart();
+        m_target.clear(clearColor);
+        return m_target;
+    }
+
+    // 그린 영역을 창 크기로 늘려서 출력 (출력 후 target의 뷰는 창 픽셀 좌표 뷰로 바뀜)
+    void present(sf::RenderTarget& target)
+    {
+        m_target.display();
+
+        sf::Sprite sprite(m_target.getTexture(), sf::IntRect({0, 0}, sf::Vector2i(m_metrics.renderSize)));
+        sprite.setScale({static_cast<float>(m_nativeSize.x) / m_metrics.renderSize.x,
+                         static_cast<float>(m_nativeSize.y) / m_metrics.renderSize.y});
+        RenderStats::setView(target, m_presentView);
+        RenderStats::draw(target, sprite);
+    }
+
+    // 창 display()가 끝난 직후 호출 (displayTime: display() 안에서 걸린 시간, 프레임 제한 대기는 빠져 있어야 함)
+    void endFrame(sf::Time displayTime)
+    {
+        m_lastRenderSeconds = m_renderClock.getElapsedTime().asSeconds();
+        m_lastDisplaySeconds = displayTime.asSeconds();
+        m_hasRenderTime = true;
+    }
+
+    const Metrics& getMetrics() const { return m_metrics; }
+
+private:
+    static constexpr float AVERAGE_WEIGHT = 0.1f;       // 이동 평균 가중치
+    static constexpr float OVER_BUDGET_RATIO = 0.9f;    // 예산의 90%를 넘으면 느림 (update와 스냅샷 전환 몫을 남김)
+    static constexpr float UNDER_BUDGET_RATIO = 0.6f;   // 예산의 60% 미만이면 여유 (한 단계 올려도 픽셀 수는 ~10%만 늘어남)
+    static constexpr float SCALE_DOWN_DELAY = 0.25f;    // 느린 상태가 이만큼 유지되면 내림 (초)
+    static constexpr float SCALE_UP_DELAY = 2.f;        // 여유 상태가 이만큼 유지되면 올림 (초)
+    static constexpr float CHANGE_COOLDOWN = 0.5f;      // 스케일 변경 후 대기 시간 (초)
+    static constexpr float SCALE_STEP = 0.05f;
+
+    void changeScale(float delta)
+    {
+        m_metrics.scale = std::clamp(m_metrics.scale + delta, m_minScale, m_maxScale);
+        m_metrics.changedLastFrame = true;
+        m_overBudgetSeconds = 0.f;
+        m_underBudgetSeconds = 0.f;
+        m_cooldownSeconds = CHANGE_COOLDOWN;
+        updateRenderSize();
+    }
+
+    void updateRenderSize()
+    {
+        m_metrics.renderSize = {
+            std::max(1u, static_cast<unsigned int>(m_nativeSize.x * m_metrics.scale + 0.5f)),
+            std::max(1u, static_cast<unsigned int>(m_nativeSize.y * m_metrics.scale + 0.5f))
+        };
+    }
+
+    sf::RenderTexture m_target;
+    sf::Vector2u m_nativeSize;
+    sf::View m_presentView;
+    Filter m_filter = Filter::Bilinear;
+
+    float m_minScale = 0.5f;
+    float m_maxScale = 1.f;
+    bool m_autoScale = true;
+    float m_targetFrameSeconds = 1.f / 60.f;
+    float m_averageRenderSeconds = 0.f;
+    float m_lastRenderSeconds = 0.f;
+    float m_lastDisplaySeconds = 0.f;
+    bool m_hasRenderTime = false;
+    sf::Clock m_renderClock;
+    float m_overBudgetSeconds = 0.f;
+    float m_underBudgetSeconds = 0.f;
+    float m_cooldownSeconds = 0.f;
+
+    Metrics m_metrics;
+};
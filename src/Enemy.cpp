@@ -1,8 +1,11 @@
 #include "Enemy.hpp"
 #include "TileMap.hpp"
+#include "Profiler.hpp"
 
 void Enemy::update(float deltaTime, const TileMap* tileMap)
 {
+    PROFILE_SCOPE("Enemy::update");
+
     if (!m_isAlive) return;
 
     updateKnockback(deltaTime);
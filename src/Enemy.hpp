@@ -1,10 +1,11 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "SpriteBatch.hpp"
 
 class TileMap;
 
-class Enemy : public sf::Drawable
+class Enemy
 {
 public:
     static constexpr float WIDTH = 40.f;
@@ -29,6 +30,7 @@ public:
 
     sf::Vector2f getPosition() const { return m_shape.getPosition(); }
     sf::Vector2f getSize() const { return m_shape.getSize(); }
+    sf::Vector2f getVelocity() const { return m_velocity; }
     sf::FloatRect getBounds() const { return m_shape.getGlobalBounds(); }
     sf::Vector2f getCenter() const
     {
@@ -65,15 +67,18 @@ public:
         m_shape.setFillColor(sf::Color{255, 200, 200});
     }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // 스프라이트 배치에 그리기 추가
+    void addToBatch(SpriteBatch& batch) const
     {
         if (m_isAlive)
         {
-            target.draw(m_shape, states);
+            batch.addOutlinedRect({m_shape.getPosition(), m_shape.getSize()}, m_shape.getFillColor(),
+                                  m_shape.getOutlineThickness(), m_shape.getOutlineColor(), DrawLayer::Enemy);
         }
     }
 
+private:
+
     void applyGravity(float deltaTime)
     {
         if (!m_isOnGround)
@@ -233,8 +233,9 @@ public:
         }
     }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // RenderTarget 또는 DrawList(렌더 스냅샷)에 그림
+    template<typename Target>
+    void render(Target& target, sf::RenderStates states) const
     {
         if (!m_window.isVisible()) return;
 
@@ -253,6 +254,12 @@ private:
         }
     }
 
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        render(target, states);
+    }
+
     static sf::Vector2f calculateWindowSize()
     {
         // 3열 레이아웃: 왼쪽 슬롯 | 아바타 | 오른쪽 슬롯
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Player.hpp"
+#include "Enemy.hpp"
+#include "TileMap.hpp"
+#include "PlayerInput.hpp"
+#include "Profiler.hpp"
+#include "Log.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+// 게임 월드 시뮬레이션 (플레이어, 적, 카메라)
+// 창/키보드/UI에 의존하지 않아서 창 있는 게임과 헤드리스 재생이 같은 코드로 진행됨
+// 같은 맵, 시드, 틱별 (입력, deltaTime)이면 상태 해시까지 똑같이 나옴
+class GameSimulation
+{
+public:
+    GameSimulation(const TileMap& tileMap, std::uint32_t seed, const sf::Vector2f& viewSize)
+        : m_tileMap(tileMap)
+        , m_player(playerStartPosition(tileMap))
+        , m_camera(sf::FloatRect({0.f, 0.f}, viewSize))
+        , m_random(seed)
+    {
+        LOG_INFO("Player position: ({}, {})", m_player.getPosition().x, m_player.getPosition().y);
+        LOG_INFO("Map size: {} x {}", tileMap.getWidth() * TileMap::TILE_SIZE, tileMap.getHeight() * TileMap::TILE_SIZE);
+
+        // 적 생성 (타일맵의 enemy spawn 위치 사용)
+        const auto& enemySpawns = tileMap.getEnemySpawns();
+        if (!enemySpawns.empty())
+        {
+            for (const auto& spawn : enemySpawns)
+            {
+                float x = static_cast<float>(std::get<0>(spawn));
+                float y = static_cast<float>(std::get<1>(spawn));
+                m_enemies.emplace_back(sf::Vector2f{x, y});
+                LOG_INFO("Enemy spawn from tilemap: ({}, {})", x, y);
+            }
+        }
+        else
+        {
+            // enemy spawn이 없으면 기본 적 생성
+            LOG_INFO("No enemy spawns in tilemap, creating default enemies");
+            m_enemies.emplace_back(sf::Vector2f{400.f, 100.f});
+            m_enemies.emplace_back(sf::Vector2f{700.f, 100.f});
+            m_enemies.emplace_back(sf::Vector2f{1000.f, 100.f});
+        }
+
+        // 초기 카메라를 플레이어 중심으로 설정
+        m_camera.setCenter(m_player.getCenter());
+        LOG_INFO("Initial camera center: ({}, {})", m_camera.getCenter().x, m_camera.getCenter().y);
+    }
+
+    // 한 틱 진행
+    void step(const PlayerInput& input, float deltaTime)
+    {
+        // 플레이어 입력 및 업데이트 (입력이 꺼진 틱은 입력 처리 생략)
+        if (input.enabled)
+        {
+            m_player.handleInput(input);
+        }
+        m_player.update(deltaTime, &m_tileMap);
+
+        {
+            PROFILE_SCOPE("Enemies");
+            // 적 업데이트 및 충돌 감지
+            for (auto& enemy : m_enemies)
+            {
+                enemy.update(deltaTime, &m_tileMap);
+
+                // 플레이어와 적의 충돌 감지 (적 -> 플레이어)
+                if (enemy.isAlive())
+                {
+                    auto intersection = m_player.getBounds().findIntersection(enemy.getBounds());
+                    if (intersection.has_value())
+                    {
+                        m_player.takeHit(enemy.getDamage(), enemy.getKnockbackForce(), enemy.getCenter());
+                    }
+                }
+
+                // 플레이어 공격 충돌 감지 (플레이어 -> 적)
+                if (m_player.isAttacking() && enemy.isAlive())
+                {
+                    sf::FloatRect attackHitbox = m_player.getAttackHitbox();
+                    auto attackHit = attackHitbox.findIntersection(enemy.getBounds());
+                    if (attackHit.has_value())
+                    {
+                        enemy.takeDamage(m_player.getAttackDamage(), m_player.getAttackKnockback(), m_player.getCenter());
+                    }
+                }
+            }
+        }
+
+        updateCamera(deltaTime);
+        ++m_tick;
+    }
+
+    Player& getPlayer() { return m_player; }
+    const Player& getPlayer() const { return m_player; }
+    const std::vector<Enemy>& getEnemies() const { return m_enemies; }
+    const sf::View& getCamera() const { return m_camera; }
+    std::uint64_t getTick() const { return m_tick; }
+
+    // 게임플레이 난수는 반드시 여기서 뽑아야 재생이 어긋나지 않음
+    std::mt19937& getRandom() { return m_random; }
+
+    // 시뮬레이션 상태 해시 (FNV-1a, float는 비트 패턴 그대로)
+    std::uint64_t computeStateHash() const
+    {
+        StateHash hash;
+        hash.add(m_tick);
+        hash.add(m_player.getPosition());
+        hash.add(m_player.getVelocity());
+        hash.add(m_player.getHealth());
+        hash.add(m_player.isOnGround());
+        hash.add(m_player.isFacingRight());
+        hash.add(m_player.isDashing());
+        hash.add(m_player.isAttacking());
+        hash.add(m_player.isKnockback());
+        hash.add(m_player.isInvincible());
+        for (const Enemy& enemy : m_enemies)
+        {
+            hash.add(enemy.getPosition());
+            hash.add(enemy.getVelocity());
+            hash.add(enemy.isAlive());
+            hash.add(enemy.isKnockback());
+        }
+        hash.add(m_camera.getCenter());
+        return hash.value;
+    }
+
+    // 타일맵 내용 해시 (기록한 맵과 재생하는 맵이 같은지 확인용)
+    static std::uint64_t computeMapHash(const TileMap& tileMap)
+    {
+        StateHash hash;
+        hash.add(tileMap.getWidth());
+        hash.add(tileMap.getHeight());
+        for (int y = 0; y < tileMap.getHeight(); ++y)
+        {
+            for (int x = 0; x < tileMap.getWidth(); ++x)
+            {
+                const TileMap::TileData& tile = tileMap.getTileData(x, y);
+                hash.add(static_cast<std::uint8_t>(tile.type));
+                hash.add(static_cast<std::uint8_t>(tile.shape));
+            }
+        }
+        hash.add(tileMap.getPlayerSpawn().x);
+        hash.add(tileMap.getPlayerSpawn().y);
+        for (const auto& [x, y, type] : tileMap.getEnemySpawns())
+        {
+            hash.add(x);
+            hash.add(y);
+            hash.add(type);
+        }
+        return hash.value;
+    }
+
+private:
+    struct StateHash
+    {
+        std::uint64_t value = 14695981039346656037ull;
+
+        void addBytes(const void* data, std::size_t size)
+        {
+            const auto* bytes = static_cast<const std::uint8_t*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                value ^= bytes[i];
+                value *= 1099511628211ull;
+            }
+        }
+
+        template<typename T>
+        void add(const T& field)
+        {
+            static_assert(std::is_arithmetic_v<T>, "hash fields one by one");
+            addBytes(&field, sizeof(field));
+        }
+
+        void add(const sf::Vector2f& vector)
+        {
+            add(vector.x);
+            add(vector.y);
+        }
+    };
+
+    static sf::Vector2f playerStartPosition(const TileMap& tileMap)
+    {
+        // 플레이어 생성 (타일맵의 spawn 위치 사용)
+        sf::Vector2i playerSpawn = tileMap.getPlayerSpawn();
+        if (playerSpawn.x >= 0 && playerSpawn.y >= 0)
+        {
+            // spawn 위치가 설정되어 있으면 사용 (픽셀 좌표 - 그대로 사용)
+            LOG_INFO("Player spawn from tilemap: ({}, {})", playerSpawn.x, playerSpawn.y);
+            return sf::Vector2f(static_cast<float>(playerSpawn.x), static_cast<float>(playerSpawn.y));
+        }
+        // 설정되지 않았으면 기본값 사용
+        LOG_INFO("Player spawn not set, using default position");
+        return {100.f, 100.f};
+    }
+
+    // 카메라를 플레이어 중심으로 부드럽게 이동 (lerp)
+    void updateCamera(float deltaTime)
+    {
+        sf::Vector2f playerCenter = m_player.getPosition() + sf::Vector2f(Player::WIDTH / 2.f, Player::HEIGHT / 2.f);
+        sf::Vector2f currentCenter = m_camera.getCenter();
+        float smoothSpeed = 5.f;  // 카메라 스무딩 속도 (높을수록 빠름)
+        sf::Vector2f newCenter = currentCenter + (playerCenter - currentCenter) * smoothSpeed * deltaTime;
+
+        // 카메라를 타일맵 범위 내로 제한
+        sf::Vector2f viewSize = m_camera.getSize();
+        float mapWidth = m_tileMap.getWidth() * m_tileMap.getTileSize();
+        float mapHeight = m_tileMap.getHeight() * m_tileMap.getTileSize();
+
+        // 카메라 중심의 최소/최대값 계산
+        float minX = viewSize.x / 2.f;
+        float maxX = mapWidth - viewSize.x / 2.f;
+        float minY = viewSize.y / 2.f;
+        float maxY = mapHeight - viewSize.y / 2.f;
+
+        // 맵이 화면보다 작은 경우 중앙에 고정
+        if (maxX < minX) newCenter.x = mapWidth / 2.f;
+        else newCenter.x = std::max(minX, std::min(newCenter.x, maxX));
+
+        if (maxY < minY) newCenter.y = mapHeight / 2.f;
+        else newCenter.y = std::max(minY, std::min(newCenter.y, maxY));
+
+        m_camera.setCenter(newCenter);
+    }
+
+    const TileMap& m_tileMap;
+    Player m_player;
+    std::vector<Enemy> m_enemies;
+    sf::View m_camera;
+    std::mt19937 m_random;
+    std::uint64_t m_tick = 0;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "PlayerInput.hpp"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// 틱별 입력과 deltaTime 기록 (재생하면 시뮬레이션이 비트 단위로 똑같이 진행됨)
+//
+// 파일 형식 (바이너리):
+//   매직 "GREC", 버전(u16), 시드(u32), 맵 해시(u64), 틱 수(u32)
+//   틱마다 deltaTime(f32), 버튼 비트(u8), 플래그(u8, bit0 = 입력 사용)
+//   마지막으로 기록 종료 시점의 상태 해시(u64)
+class InputRecording
+{
+public:
+    static constexpr char FILE_MAGIC[4] = {'G', 'R', 'E', 'C'};
+    static constexpr std::uint16_t FILE_VERSION = 1;
+
+    struct Frame
+    {
+        float deltaTime = 0.f;
+        PlayerInput input;
+    };
+
+    void setSeed(std::uint32_t seed) { m_seed = seed; }
+    std::uint32_t getSeed() const { return m_seed; }
+
+    void setMapHash(std::uint64_t hash) { m_mapHash = hash; }
+    std::uint64_t getMapHash() const { return m_mapHash; }
+
+    void setFinalStateHash(std::uint64_t hash) { m_finalStateHash = hash; }
+    std::uint64_t getFinalStateHash() const { return m_finalStateHash; }
+
+    void addFrame(float deltaTime, const PlayerInput& input) { m_frames.push_back({deltaTime, input}); }
+    const std::vector<Frame>& getFrames() const { return m_frames; }
+
+    bool saveToFile(const std::string& filename) const
+    {
+        std::ofstream file(filename, std::ios::binary);
+        if (!file.is_open()) return false;
+
+        file.write(FILE_MAGIC, 4);
+        file.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+        file.write(reinterpret_cast<const char*>(&m_seed), sizeof(m_seed));
+        file.write(reinterpret_cast<const char*>(&m_mapHash), sizeof(m_mapHash));
+        std::uint32_t frameCount = static_cast<std::uint32_t>(m_frames.size());
+        file.write(reinterpret_cast<const char*>(&frameCount), sizeof(frameCount));
+
+        for (const Frame& frame : m_frames)
+        {
+            std::uint8_t flags = frame.input.enabled ? 1 : 0;
+            file.write(reinterpret_cast<const char*>(&frame.deltaTime), sizeof(frame.deltaTime));
+            file.write(reinterpret_cast<const char*>(&frame.input.buttons), sizeof(frame.input.buttons));
+            file.write(reinterpret_cast<const char*>(&flags), sizeof(flags));
+        }
+
+        file.write(reinterpret_cast<const char*>(&m_finalStateHash), sizeof(m_finalStateHash));
+        return static_cast<bool>(file);
+    }
+
+    bool loadFromFile(const std::string& filename)
+    {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) return false;
+
+        char magic[4];
+        file.read(magic, 4);
+        if (!file || magic[0] != FILE_MAGIC[0] || magic[1] != FILE_MAGIC[1] ||
+            magic[2] != FILE_MAGIC[2] || magic[3] != FILE_MAGIC[3])
+        {
+            return false;
+        }
+
+        std::uint16_t version;
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        if (!file || version != FILE_VERSION) return false;
+
+        std::uint32_t frameCount;
+        file.read(reinterpret_cast<char*>(&m_seed), sizeof(m_seed));
+        file.read(reinterpret_cast<char*>(&m_mapHash), sizeof(m_mapHash));
+        file.read(reinterpret_cast<char*>(&frameCount), sizeof(frameCount));
+        if (!file) return false;
+
+        m_frames.clear();
+        for (std::uint32_t i = 0; i < frameCount; ++i)
+        {
+            Frame frame;
+            std::uint8_t flags;
+            file.read(reinterpret_cast<char*>(&frame.deltaTime), sizeof(frame.deltaTime));
+            file.read(reinterpret_cast<char*>(&frame.input.buttons), sizeof(frame.input.buttons));
+            file.read(reinterpret_cast<char*>(&flags), sizeof(flags));
+            if (!file) return false;
+            frame.input.enabled = (flags & 1) != 0;
+            m_frames.push_back(frame);
+        }
+
+        file.read(reinterpret_cast<char*>(&m_finalStateHash), sizeof(m_finalStateHash));
+        return static_cast<bool>(file);
+    }
+
+private:
+    std::uint32_t m_seed = 0;
+    std::uint64_t m_mapHash = 0;
+    std::uint64_t m_finalStateHash = 0;
+    std::vector<Frame> m_frames;
+};
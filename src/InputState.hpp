@@ -0,0 +1,72 @@
+#pragma once
+
+#include <SFML/Window.hpp>
+#include <bitset>
+
+// 프레임 단위 키보드 상태 (pollEvent의 키 이벤트로만 갱신)
+// 업데이트 코드는 sf::Keyboard::isKeyPressed 대신 이것을 읽으므로 OS 호출이 없음
+// 눌림/뗌 엣지는 프레임 안에서 눌렀다 뗀 키도 놓치지 않음
+//
+// 사용법: 매 프레임 이벤트 루프 전에 beginFrame, 모든 이벤트를 handleEvent에 넘김
+class InputState
+{
+public:
+    using KeyBits = std::bitset<sf::Keyboard::KeyCount>;
+
+    // 이전 프레임의 엣지 지우기 (눌린 상태는 유지)
+    void beginFrame()
+    {
+        m_pressed.reset();
+        m_released.reset();
+    }
+
+    void handleEvent(const sf::Event& event)
+    {
+        if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>())
+        {
+            int index = keyIndex(keyPressed->code);
+            if (index < 0) return;
+            // 키 반복 이벤트는 엣지로 치지 않음
+            if (!m_down.test(index)) m_pressed.set(index);
+            m_down.set(index);
+        }
+        else if (const auto* keyReleased = event.getIf<sf::Event::KeyReleased>())
+        {
+            int index = keyIndex(keyReleased->code);
+            if (index < 0) return;
+            if (m_down.test(index)) m_released.set(index);
+            m_down.reset(index);
+        }
+        else if (event.is<sf::Event::FocusLost>())
+        {
+            // 포커스가 없으면 KeyReleased가 오지 않으므로 모두 뗀 것으로 처리
+            m_released |= m_down;
+            m_down.reset();
+        }
+    }
+
+    bool isDown(sf::Keyboard::Key key) const { return test(m_down, key); }
+    bool wasPressed(sf::Keyboard::Key key) const { return test(m_pressed, key); }
+    bool wasReleased(sf::Keyboard::Key key) const { return test(m_released, key); }
+
+    const KeyBits& getDown() const { return m_down; }
+    const KeyBits& getPressed() const { return m_pressed; }
+    const KeyBits& getReleased() const { return m_released; }
+
+    static int keyIndex(sf::Keyboard::Key key)
+    {
+        int index = static_cast<int>(key);
+        return (index >= 0 && index < static_cast<int>(sf::Keyboard::KeyCount)) ? index : -1;
+    }
+
+private:
+    static bool test(const KeyBits& bits, sf::Keyboard::Key key)
+    {
+        int index = keyIndex(key);
+        return index >= 0 && bits.test(index);
+    }
+
+    KeyBits m_down;
+    KeyBits m_pressed;
+    KeyBits m_released;
+};
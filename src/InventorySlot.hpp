@@ -93,8 +93,9 @@ public:
     // 드래그 시작 가능 여부 (아이템이 있을 때만)
     bool canStartDrag() const { return m_item.has_value(); }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // RenderTarget 또는 DrawList(렌더 스냅샷)에 그림
+    template<typename Target>
+    void render(Target& target, sf::RenderStates states) const
     {
         target.draw(m_background, states);
         if (m_item)
@@ -110,6 +111,12 @@ private:
         }
     }
 
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        render(target, states);
+    }
+
     void updateItemRectPosition()
     {
         sf::Vector2f pos = m_background.getPosition();
@@ -3,11 +3,11 @@
 #include "Window.hpp"
 #include "InventorySlot.hpp"
 #include "DragDropManager.hpp"
+#include "Log.hpp"
 #include <vector>
 #include <memory>
 #include <functional>
 #include <algorithm>
-#include <iostream>
 
 class InventoryWindow : public sf::Drawable
 {
@@ -116,40 +116,40 @@ public:
             // 클릭 처리 - 드래그 시작 또는 드롭
             if (const auto* mousePressed = event.getIf<sf::Event::MouseButtonPressed>())
             {
-                std::cout << "[InventoryWindow] mousePressed detected" << std::endl;
+                LOG_TRACE("[InventoryWindow] mousePressed detected");
                 if (mousePressed->button == sf::Mouse::Button::Left)
                 {
                     // 픽셀 좌표를 UI 뷰 좌표로 변환
                     sf::Vector2f mousePos = m_dragDropManager->mapPixelToUI(mousePressed->position);
 
-                    std::cout << "[InventoryWindow] isDragging: " << m_dragDropManager->isDragging() << std::endl;
-                    std::cout << "[InventoryWindow] UI coords: (" << mousePos.x << ", " << mousePos.y << ")" << std::endl;
+                    LOG_TRACE("[InventoryWindow] isDragging: {}", m_dragDropManager->isDragging());
+                    LOG_TRACE("[InventoryWindow] UI coords: ({}, {})", mousePos.x, mousePos.y);
 
                     // 드래그 중이면 드롭 처리
                     if (m_dragDropManager->isDragging())
                     {
-                        std::cout << "[InventoryWindow] Attempting drop, contains: " << m_window.contains(mousePos) << std::endl;
+                        LOG_TRACE("[InventoryWindow] Attempting drop, contains: {}", m_window.contains(mousePos));
                         if (m_window.contains(mousePos))
                         {
                             int targetSlot = getSlotAtPosition(mousePos);
-                            std::cout << "[InventoryWindow] Dropping to slot: " << targetSlot << std::endl;
+                            LOG_DEBUG("[InventoryWindow] Dropping to slot: {}", targetSlot);
                             m_dragDropManager->endDrag(this, targetSlot);
                             return true;
                         }
                         // 이 인벤토리 밖이면 다른 인벤토리가 처리하도록 패스
-                        std::cout << "[InventoryWindow] Outside window, passing to next handler" << std::endl;
+                        LOG_TRACE("[InventoryWindow] Outside window, passing to next handler");
                         return false;
                     }
 
                     // 드래그 시작
                     int slotIndex = getSlotAtPosition(mousePos);
-                    std::cout << "[InventoryWindow] slotIndex: " << slotIndex << std::endl;
+                    LOG_TRACE("[InventoryWindow] slotIndex: {}", slotIndex);
                     if (slotIndex >= 0 && m_slots[slotIndex]->hasItem())
                     {
                         OptionalItem item = m_items[slotIndex];
                         if (item)
                         {
-                            std::cout << "[InventoryWindow] Starting drag from slot " << slotIndex << std::endl;
+                            LOG_DEBUG("[InventoryWindow] Starting drag from slot {}", slotIndex);
                             m_dragDropManager->startDrag(*item, this, slotIndex, mousePos);
                             m_items[slotIndex] = std::nullopt;
                             m_slots[slotIndex]->setItem(std::nullopt);
@@ -276,7 +276,7 @@ public:
                 clampScroll();
                 updateSlotPositions();
                 updateScrollThumbPosition();
-                std::cout << "[Scroll] offset: " << m_scrollOffset << " / max: " << getMaxScroll() << std::endl;
+                LOG_TRACE("[Scroll] offset: {} / max: {}", m_scrollOffset, getMaxScroll());
                 return true;
             }
         }
@@ -323,8 +323,9 @@ public:
         }
     }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // RenderTarget 또는 DrawList(렌더 스냅샷)에 그림
+    template<typename Target>
+    void render(Target& target, sf::RenderStates states) const
     {
         if (!m_window.isVisible()) return;
 
@@ -351,6 +352,12 @@ private:
         target.draw(m_scrollThumb, states);
     }
 
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        render(target, states);
+    }
+
     static sf::Vector2f calculateWindowSize()
     {
         float width = GRID_COLS * (SLOT_SIZE + SLOT_PADDING) + SLOT_PADDING + 15.f;
@@ -363,9 +370,9 @@ private:
         m_slots.clear();
         sf::Vector2f contentPos = m_window.getContentPosition();
 
-        std::cout << "[InventoryWindow] Content position: (" << contentPos.x << ", " << contentPos.y << ")" << std::endl;
-        std::cout << "[InventoryWindow] Content size: (" << m_window.getContentSize().x << ", " << m_window.getContentSize().y << ")" << std::endl;
-        std::cout << "[InventoryWindow] Scroll offset: " << m_scrollOffset << std::endl;
+        LOG_TRACE("[InventoryWindow] Content position: ({}, {})", contentPos.x, contentPos.y);
+        LOG_TRACE("[InventoryWindow] Content size: ({}, {})", m_window.getContentSize().x, m_window.getContentSize().y);
+        LOG_TRACE("[InventoryWindow] Scroll offset: {}", m_scrollOffset);
 
         for (int row = 0; row < GRID_ROWS; ++row)
         {
@@ -377,7 +384,7 @@ private:
 
                 if (row == 0 && col == 0)
                 {
-                    std::cout << "[InventoryWindow] First slot position: (" << x << ", " << y << ")" << std::endl;
+                    LOG_TRACE("[InventoryWindow] First slot position: ({}, {})", x, y);
                 }
 
                 auto slot = std::make_shared<InventorySlot>(
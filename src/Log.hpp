@@ -0,0 +1,369 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+// 비동기 레벨 로거
+//
+// LOG_INFO("Moved {} between inventories", name) 처럼 {} 자리에 인자를 넣어서 기록함
+// 호출한 스레드는 인자 값만 고정 크기 레코드에 복사해서 락 없는 링 버퍼에 넣고 바로 돌아가며,
+// 문자열 조립과 출력(flush 포함)은 백그라운드 스레드가 모아서 한 번에 처리함
+// 버퍼가 가득 차면 기다리지 않고 버림 (버린 개수는 getDroppedCount)
+//
+// GIVEITUP_LOG_LEVEL보다 낮은 레벨의 LOG_* 호출은 컴파일 단계에서 제거됨
+// (0 = Trace, 1 = Debug, 2 = Info, 3 = Warn, 4 = Error, 5 = Off)
+// format은 문자열 리터럴이어야 함 (포인터만 저장함)
+
+#ifndef GIVEITUP_LOG_LEVEL
+    #ifdef NDEBUG
+        #define GIVEITUP_LOG_LEVEL 2
+    #else
+        #define GIVEITUP_LOG_LEVEL 1
+    #endif
+#endif
+
+enum class LogLevel : std::uint8_t
+{
+    Trace = 0,
+    Debug = 1,
+    Info = 2,
+    Warn = 3,
+    Error = 4,
+    Off = 5
+};
+
+namespace LogDetail
+{
+    constexpr std::size_t MAX_ARGS = 8;
+    constexpr std::size_t TEXT_CAPACITY = 192;  // 레코드 하나에 담을 수 있는 문자열 인자 합계
+
+    struct Arg
+    {
+        enum class Type : std::uint8_t { Int, UInt, Double, Bool, Char, String };
+
+        Type type = Type::Int;
+        union
+        {
+            std::int64_t i;
+            std::uint64_t u;
+            double d;
+            bool b;
+            char c;
+        };
+        std::uint16_t textOffset = 0;
+        std::uint16_t textLength = 0;
+
+        Arg() : i(0) {}
+    };
+
+    struct Record
+    {
+        LogLevel level = LogLevel::Info;
+        std::uint8_t argCount = 0;
+        std::uint16_t textUsed = 0;
+        std::uint64_t timeNs = 0;
+        const char* format = nullptr;
+        Arg args[MAX_ARGS];
+        char text[TEXT_CAPACITY];
+    };
+
+    // 인자 값을 레코드에 복사 (지원하지 않는 타입은 컴파일 오류)
+    inline void encodeText(Record& record, Arg& arg, std::string_view value)
+    {
+        std::size_t available = TEXT_CAPACITY - record.textUsed;
+        std::size_t length = std::min(value.size(), available);
+        std::memcpy(record.text + record.textUsed, value.data(), length);
+        arg.type = Arg::Type::String;
+        arg.textOffset = record.textUsed;
+        arg.textLength = static_cast<std::uint16_t>(length);
+        record.textUsed = static_cast<std::uint16_t>(record.textUsed + length);
+    }
+
+    inline void encode(Record& record, Arg& arg, std::string_view value) { encodeText(record, arg, value); }
+    inline void encode(Record& record, Arg& arg, const std::string& value) { encodeText(record, arg, value); }
+    inline void encode(Record& record, Arg& arg, const char* value) { encodeText(record, arg, value ? value : "(null)"); }
+    inline void encode(Record&, Arg& arg, bool value) { arg.type = Arg::Type::Bool; arg.b = value; }
+    inline void encode(Record&, Arg& arg, char value) { arg.type = Arg::Type::Char; arg.c = value; }
+
+    template<typename T>
+    std::enable_if_t<std::is_arithmetic_v<T>> encode(Record&, Arg& arg, T value)
+    {
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            arg.type = Arg::Type::Double;
+            arg.d = static_cast<double>(value);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            arg.type = Arg::Type::Int;
+            arg.i = static_cast<std::int64_t>(value);
+        }
+        else
+        {
+            arg.type = Arg::Type::UInt;
+            arg.u = static_cast<std::uint64_t>(value);
+        }
+    }
+
+    inline void appendArg(std::string& out, const Record& record, const Arg& arg)
+    {
+        char buffer[32];
+        switch (arg.type)
+        {
+            case Arg::Type::Int:
+                out += std::to_string(arg.i);
+                break;
+            case Arg::Type::UInt:
+                out += std::to_string(arg.u);
+                break;
+            case Arg::Type::Double:
+                std::snprintf(buffer, sizeof(buffer), "%g", arg.d);
+                out += buffer;
+                break;
+            case Arg::Type::Bool:
+                out += arg.b ? "true" : "false";
+                break;
+            case Arg::Type::Char:
+                out += arg.c;
+                break;
+            case Arg::Type::String:
+                out.append(record.text + arg.textOffset, arg.textLength);
+                break;
+        }
+    }
+
+    // "{}"를 순서대로 인자로 바꿈
+    inline void format(std::string& out, const Record& record)
+    {
+        std::size_t argIndex = 0;
+        for (const char* p = record.format; *p; ++p)
+        {
+            if (p[0] == '{' && p[1] == '}')
+            {
+                if (argIndex < record.argCount)
+                {
+                    appendArg(out, record, record.args[argIndex++]);
+                }
+                ++p;
+                continue;
+            }
+            out += *p;
+        }
+    }
+
+    inline const char* levelName(LogLevel level)
+    {
+        switch (level)
+        {
+            case LogLevel::Trace: return "TRACE";
+            case LogLevel::Debug: return "DEBUG";
+            case LogLevel::Info: return "INFO";
+            case LogLevel::Warn: return "WARN";
+            case LogLevel::Error: return "ERROR";
+            default: return "";
+        }
+    }
+}
+
+class Log
+{
+public:
+    static constexpr std::size_t QUEUE_CAPACITY = 1024;  // 2의 거듭제곱
+    static constexpr std::size_t BATCH_SIZE = 64;         // 한 번에 출력하는 최대 레코드 수
+
+    static Log& instance()
+    {
+        static Log log;
+        return log;
+    }
+
+    ~Log()
+    {
+        m_running = false;
+        if (m_writer.joinable()) m_writer.join();
+    }
+
+    Log(const Log&) = delete;
+    Log& operator=(const Log&) = delete;
+
+    // 실행 중 레벨 필터 (컴파일 단계 필터보다 낮출 수는 없음)
+    void setMinLevel(LogLevel level) { m_minLevel.store(level, std::memory_order_relaxed); }
+
+    template<typename... Args>
+    void write(LogLevel level, const char* format, const Args&... args)
+    {
+        static_assert(sizeof...(Args) <= LogDetail::MAX_ARGS, "too many log arguments");
+        if (level < m_minLevel.load(std::memory_order_relaxed)) return;
+
+        std::size_t position = 0;
+        Cell* cell = claimCell(position);
+        if (!cell)
+        {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        LogDetail::Record& record = cell->record;
+        record.level = level;
+        record.format = format;
+        record.timeNs = nowNs();
+        record.textUsed = 0;
+        record.argCount = static_cast<std::uint8_t>(sizeof...(Args));
+        [[maybe_unused]] std::size_t index = 0;
+        (LogDetail::encode(record, record.args[index++], args), ...);
+
+        cell->sequence.store(position + 1, std::memory_order_release);
+    }
+
+    // 지금까지 넣은 레코드가 모두 출력될 때까지 대기
+    void flush()
+    {
+        std::size_t target = m_enqueuePosition.load(std::memory_order_acquire);
+        while (m_writtenCount.load(std::memory_order_acquire) < target && m_writer.joinable())
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::uint64_t getDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence{0};
+        LogDetail::Record record;
+    };
+
+    Log()
+        : m_startNs(nowNs())
+    {
+        for (std::size_t i = 0; i < QUEUE_CAPACITY; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_writer = std::thread([this]() { writerLoop(); });
+    }
+
+    static std::uint64_t nowNs()
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // 생산자: 빈 칸 하나를 확보 (가득 찼으면 nullptr)
+    Cell* claimCell(std::size_t& position)
+    {
+        position = m_enqueuePosition.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& cell = m_cells[position & (QUEUE_CAPACITY - 1)];
+            std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(position);
+            if (diff == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    return &cell;
+                }
+            }
+            else if (diff < 0)
+            {
+                return nullptr;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 소비자: 쌓인 레코드를 모아서 문자열로 만들고 한 번에 출력
+    std::size_t drainBatch()
+    {
+        m_out.clear();
+        m_err.clear();
+        std::size_t count = 0;
+        while (count < BATCH_SIZE)
+        {
+            Cell& cell = m_cells[m_dequeuePosition & (QUEUE_CAPACITY - 1)];
+            if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) break;
+
+            const LogDetail::Record& record = cell.record;
+            std::string& out = record.level >= LogLevel::Warn ? m_err : m_out;
+            char prefix[48];
+            std::snprintf(prefix, sizeof(prefix), "[%9.3f][%s] ",
+                          static_cast<double>(record.timeNs - m_startNs) / 1.0e9, LogDetail::levelName(record.level));
+            out += prefix;
+            LogDetail::format(out, record);
+            out += '\n';
+
+            cell.sequence.store(m_dequeuePosition + QUEUE_CAPACITY, std::memory_order_release);
+            ++m_dequeuePosition;
+            ++count;
+        }
+
+        if (!m_out.empty())
+        {
+            std::cout.write(m_out.data(), static_cast<std::streamsize>(m_out.size()));
+            std::cout.flush();
+        }
+        if (!m_err.empty())
+        {
+            std::cerr.write(m_err.data(), static_cast<std::streamsize>(m_err.size()));
+            std::cerr.flush();
+        }
+        m_writtenCount.fetch_add(count, std::memory_order_release);
+        return count;
+    }
+
+    void writerLoop()
+    {
+        while (m_running.load(std::memory_order_relaxed))
+        {
+            if (drainBatch() == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+        }
+        // 종료 전 남은 레코드 출력
+        while (drainBatch() > 0)
+        {
+        }
+    }
+
+    Cell m_cells[QUEUE_CAPACITY];
+    std::atomic<std::size_t> m_enqueuePosition{0};
+    std::size_t m_dequeuePosition = 0;               // 백그라운드 스레드 전용
+    std::atomic<std::size_t> m_writtenCount{0};
+    std::atomic<std::uint64_t> m_dropped{0};
+    std::atomic<LogLevel> m_minLevel{LogLevel::Trace};
+    std::atomic<bool> m_running{true};
+    std::uint64_t m_startNs;
+    std::string m_out;
+    std::string m_err;
+    std::thread m_writer;
+};
+
+#define GIVEITUP_LOG_AT(levelValue, level, ...)                      \
+    do                                                               \
+    {                                                                \
+        if constexpr ((levelValue) >= GIVEITUP_LOG_LEVEL)            \
+        {                                                            \
+            Log::instance().write(level, __VA_ARGS__);               \
+        }                                                            \
+    } while (0)
+
+#define LOG_TRACE(...) GIVEITUP_LOG_AT(0, LogLevel::Trace, __VA_ARGS__)
+#define LOG_DEBUG(...) GIVEITUP_LOG_AT(1, LogLevel::Debug, __VA_ARGS__)
+#define LOG_INFO(...) GIVEITUP_LOG_AT(2, LogLevel::Info, __VA_ARGS__)
+#define LOG_WARN(...) GIVEITUP_LOG_AT(3, LogLevel::Warn, __VA_ARGS__)
+#define LOG_ERROR(...) GIVEITUP_LOG_AT(4, LogLevel::Error, __VA_ARGS__)
@@ -0,0 +1,384 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "RenderStats.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+// 큰 맵에서 현재 위치를 보여주는 미니맵
+//
+// 맵을 2의 거듭제곱 크기 블록(64x64 청크와 경계가 맞음)으로 나눠 블록마다 점유율을 픽셀 하나로 그림
+// - 이미지는 긴 변이 maxImageSize 이하가 되도록 블록 크기를 고름 (맵 크기와 상관없이 작은 텍스처 하나)
+// - markDirty로 표시한 블록만 BlockSource로 다시 세고, 바뀐 줄 범위만 Texture::update로 올림
+//   (처음 채울 때도 draw 한 번에 시간 예산만큼만 세므로 큰 맵도 멈추지 않음)
+// - 스폰 마커는 바뀔 때만 정점을 다시 만들고, 플레이어/카메라 영역은 draw마다 정점 몇 개만 만듦
+class Minimap
+{
+public:
+    static constexpr unsigned int DEFAULT_MAX_IMAGE_SIZE = 256;
+    static constexpr int DEFAULT_UPDATE_BUDGET_US = 50;  // draw 한 번에 블록을 세는 시간 (최소 한 블록)
+
+    // 블록 안의 타일 개수 (타입별)
+    struct Occupancy
+    {
+        std::uint32_t solid = 0;
+        std::uint32_t platform = 0;
+    };
+
+    // 타일 영역의 점유 개수를 셈 (영역은 항상 맵 안)
+    using BlockSource = std::function<Occupancy(const sf::IntRect& tiles)>;
+
+    struct Marker
+    {
+        sf::Vector2f tile;  // 타일 좌표 (타일 중심이면 +0.5)
+        sf::Color color;
+    };
+
+    // draw마다 바뀌는 표시 (타일 좌표)
+    struct Overlay
+    {
+        sf::FloatRect frustum;               // 카메라가 보는 영역
+        std::optional<sf::Vector2f> player;  // 플레이어 위치
+    };
+
+    explicit Minimap(unsigned int maxImageSize = DEFAULT_MAX_IMAGE_SIZE)
+        : m_maxImageSize(std::max(1u, maxImageSize))
+    {
+    }
+
+    void setSource(BlockSource source) { m_source = std::move(source); }
+    void setUpdateBudget(sf::Time budget) { m_updateBudget = budget; }
+
+    void setColors(sf::Color background, sf::Color solid, sf::Color platform)
+    {
+        m_backgroundColor = background;
+        m_solidColor = solid;
+        m_platformColor = platform;
+        markAllDirty();
+    }
+
+    // 맵 크기 설정 (블록 크기를 다시 고르고 전체를 다시 셈)
+    void resize(unsigned int width, unsigned int height)
+    {
+        m_width = width;
+        m_height = height;
+        m_blockShift = 0;
+        while (((width + (1u << m_blockShift) - 1) >> m_blockShift) > m_maxImageSize ||
+               ((height + (1u << m_blockShift) - 1) >> m_blockShift) > m_maxImageSize)
+        {
+            ++m_blockShift;
+        }
+        m_imageSize = {(width + blockSize() - 1) >> m_blockShift, (height + blockSize() - 1) >> m_blockShift};
+
+        std::size_t blockCount = static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y;
+        m_pixels.assign(blockCount * 4u, 0);
+        m_dirtyFlags.assign(blockCount, 0);
+        m_dirtyBlocks.clear();
+        m_dirtyCursor = 0;
+        m_upload = {};
+        markAllDirty();
+        layout();
+    }
+
+    // 미니맵을 넣을 화면 영역 (비율을 유지해서 맞추고, 남는 공간은 align 비율로 나눔: {1, 0} = 오른쪽 위)
+    void setBounds(const sf::FloatRect& bounds, sf::Vector2f align = {1.f, 0.f})
+    {
+        m_bounds = bounds;
+        m_align = align;
+        layout();
+    }
+
+    // 실제로 그리는 화면 영역
+    const sf::FloatRect& getDisplayRect() const { return m_displayRect; }
+    unsigned int getBlockSize() const { return blockSize(); }
+    sf::Vector2u getImageSize() const { return m_imageSize; }
+    sf::Vector2u getMapSize() const { return {m_width, m_height}; }
+    std::size_t getPendingBlockCount() const { return m_dirtyBlocks.size() - m_dirtyCursor; }
+
+    // 타일 영역이 바뀜 (겹치는 블록을 다음 draw에서 다시 셈)
+    void markDirty(const sf::IntRect& rect)
+    {
+        int x0 = std::max(0, rect.position.x);
+        int y0 = std::max(0, rect.position.y);
+        int x1 = std::min(static_cast<int>(m_width), rect.position.x + rect.size.x);
+        int y1 = std::min(static_cast<int>(m_height), rect.position.y + rect.size.y);
+        if (x0 >= x1 || y0 >= y1) return;
+
+        for (unsigned int by = static_cast<unsigned int>(y0) >> m_blockShift;
+             by <= static_cast<unsigned int>(y1 - 1) >> m_blockShift; ++by)
+        {
+            for (unsigned int bx = static_cast<unsigned int>(x0) >> m_blockShift;
+                 bx <= static_cast<unsigned int>(x1 - 1) >> m_blockShift; ++bx)
+            {
+                std::uint32_t block = by * m_imageSize.x + bx;
+                if (m_dirtyFlags[block]) continue;
+                m_dirtyFlags[block] = 1;
+                m_dirtyBlocks.push_back(block);
+            }
+        }
+    }
+
+    void markTileDirty(int x, int y) { markDirty({{x, y}, {1, 1}}); }
+    void markAllDirty() { markDirty({{0, 0}, {static_cast<int>(m_width), static_cast<int>(m_height)}}); }
+
+    // 스폰 등 고정 마커 (바뀔 때만 호출)
+    void setMarkers(std::vector<Marker> markers)
+    {
+        m_markers = std::move(markers);
+        rebuildMarkers();
+    }
+
+    // 화면 좌표 -> 타일 좌표 (미니맵 밖이면 없음)
+    std::optional<sf::Vector2f> mapToTile(sf::Vector2f screen) const
+    {
+        if (m_width == 0 || !m_displayRect.contains(screen)) return std::nullopt;
+        return sf::Vector2f{(screen.x - m_displayRect.position.x) / m_scale,
+                            (screen.y - m_displayRect.position.y) / m_scale};
+    }
+
+    // 바뀐 블록을 세서 올린 뒤 이미지, 마커, 오버레이 순서로 그림 (draw call 3개)
+    void draw(sf::RenderTarget& target, const Overlay& overlay, sf::RenderStates states = sf::RenderStates::Default) const
+    {
+        if (m_width == 0 || m_height == 0) return;
+        update();
+        if (m_texture.getSize() != m_imageSize) return;
+
+        const sf::FloatRect& rect = m_displayRect;
+        // 마지막 블록이 맵 밖으로 넘치면 그만큼 덜 씀
+        float block = static_cast<float>(blockSize());
+        sf::Vector2f size = {m_width / block, m_height / block};
+        sf::Vertex image[4] = {
+            {rect.position, sf::Color::White, {0.f, 0.f}},
+            {{rect.position.x + rect.size.x, rect.position.y}, sf::Color::White, {size.x, 0.f}},
+            {{rect.position.x, rect.position.y + rect.size.y}, sf::Color::White, {0.f, size.y}},
+            {rect.position + rect.size, sf::Color::White, size}
+        };
+        sf::RenderStates imageStates = states;
+        imageStates.texture = &m_texture;
+        RenderStats::draw(target, image, 4, sf::PrimitiveType::TriangleStrip, imageStates);
+
+        RenderStats::draw(target, m_markerVertices, states);
+
+        // 테두리, 카메라 영역, 플레이어 (정점 수십 개)
+        m_overlayVertices.clear();
+        appendOutline(rect, 1.f, m_borderColor);
+        sf::FloatRect frustum = toScreen(overlay.frustum);
+        sf::Vector2f frustumMin = {std::max(frustum.position.x, rect.position.x), std::max(frustum.position.y, rect.position.y)};
+        sf::Vector2f frustumMax = {std::min(frustum.position.x + frustum.size.x, rect.position.x + rect.size.x),
+                                   std::min(frustum.position.y + frustum.size.y, rect.position.y + rect.size.y)};
+        if (frustumMin.x < frustumMax.x && frustumMin.y < frustumMax.y)
+        {
+            appendOutline({frustumMin, frustumMax - frustumMin}, 1.f, m_frustumColor);
+        }
+        if (overlay.player)
+        {
+            sf::Vector2f center = rect.position + *overlay.player * m_scale;
+            appendQuad({center - sf::Vector2f{PLAYER_SIZE, PLAYER_SIZE} / 2.f, {PLAYER_SIZE, PLAYER_SIZE}}, m_playerColor);
+        }
+        RenderStats::draw(target, m_overlayVertices, states);
+    }
+
+private:
+    static constexpr float MARKER_SIZE = 3.f;
+    static constexpr float PLAYER_SIZE = 5.f;
+    static constexpr float MIN_VISIBLE_FILL = 0.35f;  // 타일이 조금만 있어도 이만큼은 섞음
+
+    unsigned int blockSize() const { return 1u << m_blockShift; }
+
+    // 이미지를 bounds 안에 비율 유지로 맞춤 (작은 맵은 블록 하나가 여러 픽셀)
+    void layout()
+    {
+        m_scale = 0.f;
+        m_displayRect = {m_bounds.position, {0.f, 0.f}};
+        if (m_width == 0 || m_height == 0) return;
+        m_scale = std::min(m_bounds.size.x / static_cast<float>(m_width), m_bounds.size.y / static_cast<float>(m_height));
+        sf::Vector2f size = {m_width * m_scale, m_height * m_scale};
+        m_displayRect = {{m_bounds.position.x + (m_bounds.size.x - size.x) * m_align.x,
+                          m_bounds.position.y + (m_bounds.size.y - size.y) * m_align.y}, size};
+        rebuildMarkers();
+    }
+
+    sf::FloatRect toScreen(const sf::FloatRect& tiles) const
+    {
+        return {m_displayRect.position + tiles.position * m_scale, tiles.size * m_scale};
+    }
+
+    // 마커 정점을 다시 만듦 (같은 이미지 픽셀에 겹치는 마커는 하나만)
+    void rebuildMarkers()
+    {
+        m_markerVertices.clear();
+        if (m_width == 0 || m_height == 0) return;
+
+        std::vector<std::uint8_t> used(static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y, 0);
+        for (const Marker& marker : m_markers)
+        {
+            if (marker.tile.x < 0.f || marker.tile.y < 0.f || marker.tile.x >= m_width || marker.tile.y >= m_height) continue;
+            std::size_t block = (static_cast<std::size_t>(marker.tile.y) >> m_blockShift) * m_imageSize.x +
+                                (static_cast<std::size_t>(marker.tile.x) >> m_blockShift);
+            if (used[block]) continue;
+            used[block] = 1;
+
+            sf::Vector2f center = m_displayRect.position + marker.tile * m_scale;
+            appendQuad(m_markerVertices, {center - sf::Vector2f{MARKER_SIZE, MARKER_SIZE} / 2.f, {MARKER_SIZE, MARKER_SIZE}},
+                       marker.color);
+        }
+    }
+
+    static void appendQuad(sf::VertexArray& vertices, const sf::FloatRect& rect, sf::Color color)
+    {
+        sf::Vector2f a = rect.position;
+        sf::Vector2f b = {rect.position.x + rect.size.x, rect.position.y};
+        sf::Vector2f c = {rect.position.x, rect.position.y + rect.size.y};
+        sf::Vector2f d = rect.position + rect.size;
+        vertices.append({a, color});
+        vertices.append({b, color});
+        vertices.append({c, color});
+        vertices.append({b, color});
+        vertices.append({d, color});
+        vertices.append({c, color});
+    }
+
+    void appendQuad(const sf::FloatRect& rect, sf::Color color) const { appendQuad(m_overlayVertices, rect, color); }
+
+    void appendOutline(const sf::FloatRect& rect, float thickness, sf::Color color) const
+    {
+        sf::Vector2f pos = rect.position;
+        sf::Vector2f size = rect.size;
+        appendQuad({pos, {size.x, thickness}}, color);
+        appendQuad({{pos.x, pos.y + size.y - thickness}, {size.x, thickness}}, color);
+        appendQuad({{pos.x, pos.y + thickness}, {thickness, size.y - thickness * 2.f}}, color);
+        appendQuad({{pos.x + size.x - thickness, pos.y + thickness}, {thickness, size.y - thickness * 2.f}}, color);
+    }
+
+    // 점유율에 따라 배경색에서 타일색 쪽으로 섞음 (타일이 하나라도 있으면 최소한 보이게)
+    sf::Color blockColor(const Occupancy& occupancy, std::uint32_t area) const
+    {
+        std::uint32_t filled = occupancy.solid + occupancy.platform;
+        if (filled == 0 || area == 0) return m_backgroundColor;
+
+        float platformShare = static_cast<float>(occupancy.platform) / filled;
+        float fill = std::max(MIN_VISIBLE_FILL, static_cast<float>(filled) / area);
+        auto mix = [](std::uint8_t a, std::uint8_t b, float t) {
+            return static_cast<std::uint8_t>(a + (static_cast<float>(b) - a) * t);
+        };
+        sf::Color tile = {mix(m_solidColor.r, m_platformColor.r, platformShare),
+                          mix(m_solidColor.g, m_platformColor.g, platformShare),
+                          mix(m_solidColor.b, m_platformColor.b, platformShare), 255};
+        return {mix(m_backgroundColor.r, tile.r, fill), mix(m_backgroundColor.g, tile.g, fill),
+                mix(m_backgroundColor.b, tile.b, fill), mix(m_backgroundColor.a, tile.a, fill)};
+    }
+
+    // 대기 중인 블록을 예산만큼 세고 바뀐 줄 범위를 올림
+    void update() const
+    {
+        if (m_texture.getSize() != m_imageSize)
+        {
+            if (!m_texture.resize(m_imageSize)) return;
+            m_upload.add(0, 0, m_imageSize.x, m_imageSize.y);
+        }
+
+        sf::Clock clock;
+        while (m_dirtyCursor < m_dirtyBlocks.size() && m_source)
+        {
+            std::uint32_t block = m_dirtyBlocks[m_dirtyCursor++];
+            m_dirtyFlags[block] = 0;
+            unsigned int bx = block % m_imageSize.x;
+            unsigned int by = block / m_imageSize.x;
+            int x0 = static_cast<int>(bx << m_blockShift);
+            int y0 = static_cast<int>(by << m_blockShift);
+            sf::IntRect tiles = {{x0, y0}, {std::min(static_cast<int>(blockSize()), static_cast<int>(m_width) - x0),
+                                            std::min(static_cast<int>(blockSize()), static_cast<int>(m_height) - y0)}};
+            std::uint32_t area = static_cast<std::uint32_t>(tiles.size.x) * static_cast<std::uint32_t>(tiles.size.y);
+
+            sf::Color color = blockColor(m_source(tiles), area);
+            std::uint8_t* pixel = &m_pixels[static_cast<std::size_t>(block) * 4u];
+            pixel[0] = color.r;
+            pixel[1] = color.g;
+            pixel[2] = color.b;
+            pixel[3] = color.a;
+            m_upload.add(bx, by, bx + 1, by + 1);
+            if (clock.getElapsedTime() >= m_updateBudget) break;
+        }
+        if (m_dirtyCursor == m_dirtyBlocks.size())
+        {
+            m_dirtyBlocks.clear();
+            m_dirtyCursor = 0;
+        }
+
+        // 바뀐 픽셀을 감싸는 사각형만 올림 (이미지 폭 전체면 m_pixels를 그대로)
+        if (!m_upload.empty)
+        {
+            unsigned int w = m_upload.maxX - m_upload.minX;
+            unsigned int h = m_upload.maxY - m_upload.minY;
+            const std::uint8_t* source = &m_pixels[(static_cast<std::size_t>(m_upload.minY) * m_imageSize.x + m_upload.minX) * 4u];
+            if (w != m_imageSize.x)
+            {
+                m_uploadBuffer.resize(static_cast<std::size_t>(w) * h * 4u);
+                for (unsigned int y = 0; y < h; ++y)
+                {
+                    std::copy_n(source + static_cast<std::size_t>(y) * m_imageSize.x * 4u, w * 4u,
+                                &m_uploadBuffer[static_cast<std::size_t>(y) * w * 4u]);
+                }
+                source = m_uploadBuffer.data();
+            }
+            m_texture.update(source, {w, h}, {m_upload.minX, m_upload.minY});
+            m_upload = {};
+        }
+    }
+
+    // 올릴 이미지 영역 [min, max)
+    struct UploadRect
+    {
+        bool empty = true;
+        unsigned int minX = 0, minY = 0, maxX = 0, maxY = 0;
+
+        void add(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+        {
+            if (empty)
+            {
+                *this = {false, x0, y0, x1, y1};
+                return;
+            }
+            minX = std::min(minX, x0);
+            minY = std::min(minY, y0);
+            maxX = std::max(maxX, x1);
+            maxY = std::max(maxY, y1);
+        }
+    };
+
+    unsigned int m_maxImageSize;
+    unsigned int m_width = 0;
+    unsigned int m_height = 0;
+    unsigned int m_blockShift = 0;
+    sf::Vector2u m_imageSize;
+    BlockSource m_source;
+    sf::Time m_updateBudget = sf::microseconds(DEFAULT_UPDATE_BUDGET_US);
+
+    sf::Color m_backgroundColor{20, 20, 24, 200};
+    sf::Color m_solidColor{170, 130, 90};
+    sf::Color m_platformColor{100, 180, 100};
+    sf::Color m_borderColor{120, 120, 130};
+    sf::Color m_frustumColor{255, 255, 255};
+    sf::Color m_playerColor{255, 80, 80};
+
+    sf::FloatRect m_bounds;
+    sf::Vector2f m_align = {1.f, 0.f};
+    sf::FloatRect m_displayRect;
+    float m_scale = 0.f;  // 타일 하나의 화면 크기
+
+    std::vector<Marker> m_markers;
+    sf::VertexArray m_markerVertices{sf::PrimitiveType::Triangles};
+    mutable sf::VertexArray m_overlayVertices{sf::PrimitiveType::Triangles};
+
+    mutable sf::Texture m_texture;
+    mutable std::vector<std::uint8_t> m_pixels;       // 이미지 RGBA (블록 하나 = 픽셀 하나)
+    mutable std::vector<std::uint8_t> m_dirtyFlags;   // 블록이 m_dirtyBlocks에 들어 있는지
+    mutable std::vector<std::uint32_t> m_dirtyBlocks; // 다시 셀 블록 (앞에서부터 처리)
+    mutable std::size_t m_dirtyCursor = 0;
+    mutable UploadRect m_upload;
+    mutable std::vector<std::uint8_t> m_uploadBuffer;
+};
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "RenderStats.hpp"
+#include <vector>
+#include <string>
+#include <memory>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// 큰 배경 이미지를 로드 시점에 GPU 친화적인 타일로 잘라두고,
+// 현재 뷰와 겹치는 타일만 그리는 패럴럭스 배경
+class ParallaxBackground : public sf::Drawable
+{
+public:
+    static constexpr unsigned int MAX_TILE_SIZE = 512;                          // 타일 한 장의 최대 크기 (픽셀)
+    static constexpr std::size_t DEFAULT_MEMORY_BUDGET = 64u * 1024u * 1024u;   // 전체 배경 텍스처 메모리 상한
+
+    // 전체 레이어가 사용할 수 있는 텍스처 메모리 상한 (바이트)
+    void setMemoryBudget(std::size_t bytes) { m_memoryBudget = bytes; }
+    std::size_t getMemoryUsage() const { return m_memoryUsage; }
+
+    // 레이어 추가 (나중에 추가한 레이어가 위에 그려짐)
+    // scrollFactor: 1 = 월드와 같이 이동, 0 = 화면에 고정, 0~1 = 멀리 있는 배경
+    // scale: 이미지 픽셀 -> 월드 픽셀 배율
+    // offset: 레이어 원점의 월드 좌표
+    // repeatX: 가로로 반복 (월드보다 좁은 원경용)
+    bool addLayer(const std::string& filename, float scrollFactor, float scale = 1.f,
+                  const sf::Vector2f& offset = {0.f, 0.f}, bool repeatX = false)
+    {
+        sf::Image image;
+        if (!image.loadFromFile(filename)) return false;
+        if (image.getSize().x == 0 || image.getSize().y == 0) return false;
+
+        // 축소해서 그려지는 이미지는 화면에 보이는 해상도로 미리 줄여서 올림
+        // (메모리와 샘플링 비용 모두 감소)
+        float resample = std::min(1.f, scale);
+
+        // 남은 메모리 예산에 맞을 때까지 해상도를 더 낮춤
+        std::size_t remaining = (m_memoryBudget > m_memoryUsage) ? m_memoryBudget - m_memoryUsage : 0;
+        sf::Vector2u srcSize = image.getSize();
+        auto bytesAt = [&](float s) {
+            std::size_t w = std::max(1u, static_cast<unsigned int>(std::ceil(srcSize.x * s)));
+            std::size_t h = std::max(1u, static_cast<unsigned int>(std::ceil(srcSize.y * s)));
+            return w * h * 4u;
+        };
+        while (resample > 0.05f && bytesAt(resample) > remaining)
+        {
+            resample *= 0.75f;
+        }
+        if (bytesAt(resample) > remaining) return false;
+
+        if (resample < 1.f)
+        {
+            image = downsample(image, resample);
+        }
+
+        Layer layer;
+        layer.scrollFactor = scrollFactor;
+        layer.offset = offset;
+        layer.repeatX = repeatX;
+        layer.imageSize = image.getSize();
+        // 줄인 비율만큼 그릴 때 다시 키움
+        layer.scale = {scale * static_cast<float>(srcSize.x) / static_cast<float>(layer.imageSize.x),
+                       scale * static_cast<float>(srcSize.y) / static_cast<float>(layer.imageSize.y)};
+
+        if (!sliceIntoTiles(image, layer)) return false;
+
+        m_memoryUsage += static_cast<std::size_t>(layer.imageSize.x) * layer.imageSize.y * 4u;
+        m_layers.push_back(std::move(layer));
+        return true;
+    }
+
+    std::size_t getLayerCount() const { return m_layers.size(); }
+
+    // 레이어의 월드 크기 (스케일 적용 후)
+    sf::Vector2f getLayerSize(std::size_t index) const
+    {
+        if (index >= m_layers.size()) return {0.f, 0.f};
+        const Layer& layer = m_layers[index];
+        return {layer.imageSize.x * layer.scale.x, layer.imageSize.y * layer.scale.y};
+    }
+
+    // 마지막 draw에서 실제로 그린 타일 수 (디버깅용)
+    std::size_t getLastDrawnTileCount() const { return m_lastDrawnTiles; }
+
+private:
+    struct Tile
+    {
+        std::unique_ptr<sf::Texture> texture;
+        sf::Vector2f position;   // 레이어 이미지 내 위치 (픽셀)
+        sf::Vector2f size;       // 타일 크기 (픽셀)
+        sf::Vector2f texOffset;  // 경계 여백(gutter)을 제외한 텍스처 내 시작 위치
+    };
+
+    struct Layer
+    {
+        std::vector<Tile> tiles;
+        unsigned int columns = 0;
+        unsigned int rows = 0;
+        unsigned int tileSize = MAX_TILE_SIZE;
+        sf::Vector2u imageSize;
+        sf::Vector2f scale{1.f, 1.f};
+        sf::Vector2f offset;
+        float scrollFactor = 1.f;
+        bool repeatX = false;
+    };
+
+    // 박스 필터로 이미지 축소
+    static sf::Image downsample(const sf::Image& source, float ratio)
+    {
+        sf::Vector2u srcSize = source.getSize();
+        sf::Vector2u dstSize = {
+            std::max(1u, static_cast<unsigned int>(std::ceil(srcSize.x * ratio))),
+            std::max(1u, static_cast<unsigned int>(std::ceil(srcSize.y * ratio)))
+        };
+
+        const std::uint8_t* src = source.getPixelsPtr();
+        std::vector<std::uint8_t> dst(static_cast<std::size_t>(dstSize.x) * dstSize.y * 4u);
+
+        float invX = static_cast<float>(srcSize.x) / dstSize.x;
+        float invY = static_cast<float>(srcSize.y) / dstSize.y;
+
+        for (unsigned int y = 0; y < dstSize.y; ++y)
+        {
+            unsigned int sy0 = static_cast<unsigned int>(y * invY);
+            unsigned int sy1 = std::min(srcSize.y, std::max(sy0 + 1, static_cast<unsigned int>((y + 1) * invY)));
+            for (unsigned int x = 0; x < dstSize.x; ++x)
+            {
+                unsigned int sx0 = static_cast<unsigned int>(x * invX);
+                unsigned int sx1 = std::min(srcSize.x, std::max(sx0 + 1, static_cast<unsigned int>((x + 1) * invX)));
+
+                std::uint32_t sum[4] = {0, 0, 0, 0};
+                for (unsigned int sy = sy0; sy < sy1; ++sy)
+                {
+                    const std::uint8_t* row = src + (static_cast<std::size_t>(sy) * srcSize.x + sx0) * 4u;
+                    for (unsigned int sx = sx0; sx < sx1; ++sx, row += 4)
+                    {
+                        sum[0] += row[0];
+                        sum[1] += row[1];
+                        sum[2] += row[2];
+                        sum[3] += row[3];
+                    }
+                }
+
+                std::uint32_t count = (sy1 - sy0) * (sx1 - sx0);
+                std::uint8_t* out = &dst[(static_cast<std::size_t>(y) * dstSize.x + x) * 4u];
+                for (int c = 0; c < 4; ++c)
+                {
+                    out[c] = static_cast<std::uint8_t>(sum[c] / count);
+                }
+            }
+        }
+
+        return sf::Image(dstSize, dst.data());
+    }
+
+    // 이미지를 타일 텍스처로 분할
+    // 각 타일은 이웃 픽셀 1px을 여백으로 포함해서 스무딩 시 경계 이음새가 보이지 않게 함
+    static bool sliceIntoTiles(const sf::Image& image, Layer& layer)
+    {
+        unsigned int maxSize = sf::Texture::getMaximumSize();
+        layer.tileSize = std::min(MAX_TILE_SIZE, maxSize > 2 ? maxSize - 2 : maxSize);
+        layer.columns = (layer.imageSize.x + layer.tileSize - 1) / layer.tileSize;
+        layer.rows = (layer.imageSize.y + layer.tileSize - 1) / layer.tileSize;
+        layer.tiles.clear();
+        layer.tiles.reserve(static_cast<std::size_t>(layer.columns) * layer.rows);
+
+        for (unsigned int row = 0; row < layer.rows; ++row)
+        {
+            for (unsigned int col = 0; col < layer.columns; ++col)
+            {
+                unsigned int x = col * layer.tileSize;
+                unsigned int y = row * layer.tileSize;
+                unsigned int w = std::min(layer.tileSize, layer.imageSize.x - x);
+                unsigned int h = std::min(layer.tileSize, layer.imageSize.y - y);
+
+                // 여백 포함 영역 (이미지 범위로 제한)
+                unsigned int left = (x > 0) ? x - 1 : x;
+                unsigned int top = (y > 0) ? y - 1 : y;
+                unsigned int right = std::min(layer.imageSize.x, x + w + 1);
+                unsigned int bottom = std::min(layer.imageSize.y, y + h + 1);
+
+                Tile tile;
+                tile.texture = std::make_unique<sf::Texture>();
+                sf::IntRect area({static_cast<int>(left), static_cast<int>(top)},
+                                 {static_cast<int>(right - left), static_cast<int>(bottom - top)});
+                if (!tile.texture->loadFromImage(image, false, area)) return false;
+                tile.texture->setSmooth(true);
+
+                tile.position = {static_cast<float>(x), static_cast<float>(y)};
+                tile.size = {static_cast<float>(w), static_cast<float>(h)};
+                tile.texOffset = {static_cast<float>(x - left), static_cast<float>(y - top)};
+                layer.tiles.push_back(std::move(tile));
+            }
+        }
+        return true;
+    }
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        m_lastDrawnTiles = 0;
+
+        // 현재 뷰의 월드 영역 (회전은 고려하지 않음)
+        const sf::View& view = target.getView();
+        sf::Vector2f viewCenter = view.getCenter();
+        sf::Vector2f viewSize = view.getSize();
+        sf::Vector2f viewMin = viewCenter - viewSize / 2.f;
+        sf::Vector2f viewMax = viewCenter + viewSize / 2.f;
+
+        for (const Layer& layer : m_layers)
+        {
+            if (layer.tiles.empty()) continue;
+
+            // 패럴럭스: 카메라 이동량의 (1 - scrollFactor)만큼 레이어를 따라 움직임
+            sf::Vector2f origin = layer.offset + viewCenter * (1.f - layer.scrollFactor);
+
+            // 뷰 영역을 레이어 이미지 좌표로 변환
+            float localMinX = (viewMin.x - origin.x) / layer.scale.x;
+            float localMaxX = (viewMax.x - origin.x) / layer.scale.x;
+            float localMinY = (viewMin.y - origin.y) / layer.scale.y;
+            float localMaxY = (viewMax.y - origin.y) / layer.scale.y;
+
+            float tileSize = static_cast<float>(layer.tileSize);
+            int firstRow = std::max(0, static_cast<int>(std::floor(localMinY / tileSize)));
+            int lastRow = std::min(static_cast<int>(layer.rows) - 1, static_cast<int>(std::floor(localMaxY / tileSize)));
+            if (firstRow > lastRow) continue;
+
+            // 반복 레이어는 이미지 너비 단위(period)로 감싸서 그림
+            float imageWidth = static_cast<float>(layer.imageSize.x);
+            int firstPeriod = 0;
+            int lastPeriod = 0;
+            if (layer.repeatX)
+            {
+                firstPeriod = static_cast<int>(std::floor(localMinX / imageWidth));
+                lastPeriod = static_cast<int>(std::floor(localMaxX / imageWidth));
+            }
+
+            sf::RenderStates tileStates = states;
+            tileStates.transform.translate(origin);
+            tileStates.transform.scale(layer.scale);
+
+            for (int period = firstPeriod; period <= lastPeriod; ++period)
+            {
+                float periodOffset = period * imageWidth;
+                int firstCol = std::max(0, static_cast<int>(std::floor((localMinX - periodOffset) / tileSize)));
+                int lastCol = std::min(static_cast<int>(layer.columns) - 1,
+                                       static_cast<int>(std::floor((localMaxX - periodOffset) / tileSize)));
+
+                for (int row = firstRow; row <= lastRow; ++row)
+                {
+                    for (int col = firstCol; col <= lastCol; ++col)
+                    {
+                        const Tile& tile = layer.tiles[static_cast<std::size_t>(row) * layer.columns + col];
+                        drawTile(target, tile, periodOffset, tileStates);
+                    }
+                }
+            }
+        }
+    }
+
+    void drawTile(sf::RenderTarget& target, const Tile& tile, float offsetX, sf::RenderStates states) const
+    {
+        float left = tile.position.x + offsetX;
+        float top = tile.position.y;
+        float right = left + tile.size.x;
+        float bottom = top + tile.size.y;
+        float u0 = tile.texOffset.x;
+        float v0 = tile.texOffset.y;
+        float u1 = u0 + tile.size.x;
+        float v1 = v0 + tile.size.y;
+
+        sf::Vertex quad[4] = {
+            {{left, top}, sf::Color::White, {u0, v0}},
+            {{right, top}, sf::Color::White, {u1, v0}},
+            {{left, bottom}, sf::Color::White, {u0, v1}},
+            {{right, bottom}, sf::Color::White, {u1, v1}}
+        };
+
+        states.texture = tile.texture.get();
+        RenderStats::draw(target, quad, 4, sf::PrimitiveType::TriangleStrip, states);
+        ++m_lastDrawnTiles;
+    }
+
+    std::vector<Layer> m_layers;
+    std::size_t m_memoryBudget = DEFAULT_MEMORY_BUDGET;
+    std::size_t m_memoryUsage = 0;
+    mutable std::size_t m_lastDrawnTiles = 0;
+};
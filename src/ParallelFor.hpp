@@ -0,0 +1,38 @@
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// [0, count) 범위를 작업 스레드들에 연속 구간으로 나눠 f(begin, end) 호출
+// 항목 수가 minPerThread * 2보다 적으면 스레드를 만들지 않고 현재 스레드에서 바로 실행
+// 첫 구간은 호출한 스레드가 직접 처리하고 모든 구간이 끝나야 반환함
+//
+// f는 서로 다른 구간에서 동시에 불리므로 구간끼리 같은 데이터를 쓰면 안 됨
+template<typename Func>
+void parallelFor(int count, int minPerThread, Func&& f)
+{
+    if (count <= 0) return;
+
+    int hardware = static_cast<int>(std::thread::hardware_concurrency());
+    int threadCount = std::min(std::max(1, hardware), count / std::max(1, minPerThread));
+    if (threadCount <= 1)
+    {
+        f(0, count);
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(static_cast<std::size_t>(threadCount) - 1);
+    for (int i = 1; i < threadCount; ++i)
+    {
+        int begin = static_cast<int>(static_cast<long long>(count) * i / threadCount);
+        int end = static_cast<int>(static_cast<long long>(count) * (i + 1) / threadCount);
+        workers.emplace_back([&f, begin, end]() { f(begin, end); });
+    }
+    f(0, static_cast<int>(static_cast<long long>(count) / threadCount));
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
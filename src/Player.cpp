@@ -1,9 +1,12 @@
 #include "Player.hpp"
 #include "TileMap.hpp"
+#include "Profiler.hpp"
 #include <algorithm>
 
 void Player::update(float deltaTime, const TileMap* tileMap)
 {
+    PROFILE_SCOPE("Player::update");
+
     updateDash(deltaTime);
 
     // 대쉬 중에는 중력 무시
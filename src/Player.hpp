@@ -6,6 +6,8 @@
 #include <optional>
 #include <iostream>
 #include "Item.hpp"
+#include "SpriteBatch.hpp"
+#include "PlayerInput.hpp"
 
 class TileMap;
 
@@ -18,7 +20,7 @@ enum class AttackType
     Uppercut  // C: 아래에서 위로 올려치기
 };
 
-class Player : public sf::Drawable
+class Player
 {
 public:
     static constexpr float WIDTH = 32.f;
@@ -64,7 +66,7 @@ public:
         m_shape.setPosition(position);
     }
 
-    void handleInput()
+    void handleInput(const PlayerInput& input)
     {
         // 대쉬 중이거나 넉백 중에는 입력 무시
         if (m_isDashing || m_isKnockback)
@@ -74,46 +76,42 @@ public:
 
         m_velocity.x = 0.f;
 
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left) ||
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A))
+        if (input.isDown(PlayerInput::Left))
         {
             m_velocity.x = -WALK_SPEED;
             m_facingRight = false;
         }
 
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right) ||
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D))
+        if (input.isDown(PlayerInput::Right))
         {
             m_velocity.x = WALK_SPEED;
             m_facingRight = true;
         }
 
-        if ((sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) ||
-             sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up) ||
-             sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W)) && m_isOnGround)
+        if (input.isDown(PlayerInput::Jump) && m_isOnGround)
         {
             m_velocity.y = JUMP_VELOCITY;
             m_isOnGround = false;
         }
 
         // Shift 키로 대쉬
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LShift) && m_dashCooldownTimer <= 0.f)
+        if (input.isDown(PlayerInput::Dash) && m_dashCooldownTimer <= 0.f)
         {
             startDash();
         }
 
         // Z 키: 내려치기 (Slash)
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Z) && m_attackCooldownTimer <= 0.f && !m_isAttacking)
+        if (input.isDown(PlayerInput::Slash) && m_attackCooldownTimer <= 0.f && !m_isAttacking)
         {
             startAttack(AttackType::Slash);
         }
         // X 키: 찌르기 (Thrust)
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::X) && m_attackCooldownTimer <= 0.f && !m_isAttacking)
+        if (input.isDown(PlayerInput::Thrust) && m_attackCooldownTimer <= 0.f && !m_isAttacking)
         {
             startAttack(AttackType::Thrust);
         }
         // C 키: 올려치기 (Uppercut)
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::C) && m_attackCooldownTimer <= 0.f && !m_isAttacking)
+        if (input.isDown(PlayerInput::Uppercut) && m_attackCooldownTimer <= 0.f && !m_isAttacking)
         {
             startAttack(AttackType::Uppercut);
         }
@@ -246,6 +244,53 @@ public:
         );
     }
 
+    // 스프라이트 배치에 그리기 추가 (잔상 -> 몸체 -> 무기 순)
+    void addToBatch(SpriteBatch& batch) const
+    {
+        for (const auto& img : m_afterimages)
+        {
+            batch.addRect({img.shape.getPosition(), img.shape.getSize()}, img.shape.getFillColor(), DrawLayer::Afterimage);
+        }
+        batch.addOutlinedRect({m_shape.getPosition(), m_shape.getSize()}, m_shape.getFillColor(),
+                              m_shape.getOutlineThickness(), m_shape.getOutlineColor(), DrawLayer::Player);
+
+        // 무기 그리기
+        if (m_hasWeapon && m_weaponTexture && m_equippedWeapon && m_equippedWeapon->hasSprite())
+        {
+            // 무기 위치: 플레이어 손 위치
+            sf::Vector2f pos = m_shape.getPosition();
+            sf::Vector2f handPos;
+
+            if (m_facingRight)
+            {
+                handPos = {pos.x + WIDTH - 5.f, pos.y + HEIGHT * 0.5f};
+            }
+            else
+            {
+                handPos = {pos.x + 5.f, pos.y + HEIGHT * 0.5f};
+            }
+
+            float angle = getCurrentSwingAngle();
+            if (!m_facingRight) angle = -angle;
+
+            sf::IntRect textureRect(
+                {m_equippedWeapon->spriteX * WEAPON_SPRITE_WIDTH, m_equippedWeapon->spriteY * WEAPON_SPRITE_HEIGHT},
+                {WEAPON_SPRITE_WIDTH, WEAPON_SPRITE_HEIGHT}
+            );
+
+            sf::Transformable weaponTransform;
+            // 원점을 손잡이 위치로 (왼쪽 하단)
+            weaponTransform.setOrigin({WEAPON_SPRITE_WIDTH * 0.15f, WEAPON_SPRITE_HEIGHT * 0.85f});
+            // 스케일 조정 (352x384 -> WEAPON_SIZE), 왼쪽을 보면 좌우 반전
+            float scale = WEAPON_SIZE / static_cast<float>(WEAPON_SPRITE_WIDTH);
+            weaponTransform.setScale({m_facingRight ? scale : -scale, scale});
+            weaponTransform.setPosition(handPos);
+            weaponTransform.setRotation(sf::degrees(angle));
+
+            batch.addSprite(*m_weaponTexture, textureRect, weaponTransform.getTransform(), sf::Color::White, DrawLayer::Weapon);
+        }
+    }
+
 private:
     void startAttack(AttackType type)
     {
@@ -396,58 +441,6 @@ private:
         }
     }
 
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
-    {
-        // 잔상 먼저 그리기 (플레이어 뒤에)
-        for (const auto& img : m_afterimages)
-        {
-            target.draw(img.shape, states);
-        }
-        target.draw(m_shape, states);
-
-        // 무기 그리기
-        if (m_hasWeapon && m_weaponTexture && m_equippedWeapon && m_equippedWeapon->hasSprite())
-        {
-            // 무기 위치: 플레이어 손 위치
-            sf::Vector2f pos = m_shape.getPosition();
-            sf::Vector2f handPos;
-
-            if (m_facingRight)
-            {
-                handPos = {pos.x + WIDTH - 5.f, pos.y + HEIGHT * 0.5f};
-            }
-            else
-            {
-                handPos = {pos.x + 5.f, pos.y + HEIGHT * 0.5f};
-            }
-
-            float angle = getCurrentSwingAngle();
-            if (!m_facingRight) angle = -angle;
-
-            sf::IntRect textureRect(
-                {m_equippedWeapon->spriteX * WEAPON_SPRITE_WIDTH, m_equippedWeapon->spriteY * WEAPON_SPRITE_HEIGHT},
-                {WEAPON_SPRITE_WIDTH, WEAPON_SPRITE_HEIGHT}
-            );
-            sf::Sprite weaponToDraw(*m_weaponTexture, textureRect);
-            // 원점을 손잡이 위치로 (왼쪽 하단)
-            weaponToDraw.setOrigin({WEAPON_SPRITE_WIDTH * 0.15f, WEAPON_SPRITE_HEIGHT * 0.85f});
-            // 스케일 조정 (352x384 -> WEAPON_SIZE)
-            float scale = WEAPON_SIZE / static_cast<float>(WEAPON_SPRITE_WIDTH);
-            weaponToDraw.setScale({scale, scale});
-            weaponToDraw.setPosition(handPos);
-
-            if (!m_facingRight)
-            {
-                weaponToDraw.setScale({-scale, scale});
-            }
-
-            weaponToDraw.setRotation(sf::degrees(angle));
-
-            target.draw(weaponToDraw, states);
-        }
-
-    }
-
     void applyGravity(float deltaTime)
     {
         if (!m_isOnGround)
@@ -496,6 +489,5 @@ private:
     // 무기 관련
     const sf::Texture* m_weaponTexture = nullptr;
     OptionalItem m_equippedWeapon;
-    mutable std::optional<sf::Sprite> m_weaponSprite;
     bool m_hasWeapon = false;
 };
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ActionMap.hpp"
+#include <cstdint>
+
+// 한 틱의 플레이어 입력 (버튼 비트)
+// 시뮬레이션은 키보드를 직접 읽지 않고 이것만 받으므로 기록/재생할 수 있음
+struct PlayerInput
+{
+    enum Button : std::uint8_t
+    {
+        Left = 1 << 0,
+        Right = 1 << 1,
+        Jump = 1 << 2,
+        Dash = 1 << 3,
+        Slash = 1 << 4,
+        Thrust = 1 << 5,
+        Uppercut = 1 << 6
+    };
+
+    std::uint8_t buttons = 0;
+    bool enabled = true;  // false면 이번 틱은 입력 처리를 건너뜀 (창 포커스 없음)
+
+    bool isDown(Button button) const { return (buttons & button) != 0; }
+
+    // 이번 프레임 키 상태와 액션 바인딩으로 입력 만들기
+    // 프레임 안에서 눌렀다 뗀 키도 이번 틱에는 눌린 것으로 침 (짧은 입력이 사라지지 않도록)
+    static PlayerInput fromActions(const ActionMap& actions, const InputState& state)
+    {
+        auto held = [&](Action action) { return actions.isDown(action, state) || actions.wasPressed(action, state); };
+
+        PlayerInput input;
+        if (held(Action::MoveLeft)) input.buttons |= Left;
+        if (held(Action::MoveRight)) input.buttons |= Right;
+        if (held(Action::Jump)) input.buttons |= Jump;
+        if (held(Action::Dash)) input.buttons |= Dash;
+        if (held(Action::Slash)) input.buttons |= Slash;
+        if (held(Action::Thrust)) input.buttons |= Thrust;
+        if (held(Action::Uppercut)) input.buttons |= Uppercut;
+        return input;
+    }
+};
@@ -0,0 +1,269 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <algorithm>
+#include <vector>
+
+// 계층형 CPU 프레임 프로파일러
+//
+// PROFILE_SCOPE("이름")으로 감싼 구간을 스레드별 링 버퍼에 기록하고,
+// PROFILE_FRAME()이 호출될 때마다 그 스레드의 프레임 시간과 구간별 합계를 요약해둠
+// GIVEITUP_PROFILER가 정의되지 않으면 매크로가 모두 비어서 비용이 없음
+// 구간 이름은 문자열 리터럴처럼 프로그램이 끝날 때까지 살아있는 문자열이어야 함
+class Profiler
+{
+public:
+    static constexpr std::size_t EVENT_CAPACITY = 1 << 16;  // 스레드당 보관하는 구간 수
+    static constexpr std::size_t FRAME_HISTORY = 240;        // 프레임 그래프 길이
+    static constexpr std::size_t TOP_ZONE_COUNT = 8;
+
+    struct ZoneEvent
+    {
+        const char* name = nullptr;
+        std::uint64_t startNs = 0;
+        std::uint64_t endNs = 0;
+        std::uint32_t depth = 0;
+    };
+
+    struct ZoneTotal
+    {
+        const char* name = nullptr;
+        float milliseconds = 0.f;
+        std::uint32_t calls = 0;
+        std::uint32_t depth = 0;
+    };
+
+    // 스레드 하나의 최근 프레임 요약 (오버레이용 복사본)
+    struct ThreadSummary
+    {
+        std::string threadName;
+        std::vector<float> frameMs;         // 오래된 것부터 최근 순
+        std::vector<ZoneTotal> topZones;    // 지난 프레임에서 오래 걸린 구간 순
+    };
+
+    static Profiler& instance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    static std::uint64_t nowNs()
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // 현재 스레드 이름 설정 (트레이스와 오버레이에 표시)
+    void setThreadName(const std::string& name)
+    {
+        ThreadBuffer& buffer = threadBuffer();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        buffer.name = name;
+    }
+
+    // 구간 시작 (깊이만 기록하고 실제 이벤트는 끝날 때 씀)
+    std::uint32_t beginZone()
+    {
+        return threadBuffer().depth++;
+    }
+
+    void endZone(const char* name, std::uint64_t startNs, std::uint32_t depth)
+    {
+        ThreadBuffer& buffer = threadBuffer();
+        buffer.depth = depth;
+
+        std::uint64_t index = buffer.written.load(std::memory_order_relaxed);
+        ZoneEvent& event = buffer.events[index % EVENT_CAPACITY];
+        event.name = name;
+        event.startNs = startNs;
+        event.endNs = nowNs();
+        event.depth = depth;
+        buffer.written.store(index + 1, std::memory_order_release);
+    }
+
+    // 현재 스레드의 프레임 경계 (지난 프레임 시간과 구간 합계를 요약)
+    void endFrame()
+    {
+        ThreadBuffer& buffer = threadBuffer();
+        std::uint64_t now = nowNs();
+        std::uint64_t written = buffer.written.load(std::memory_order_relaxed);
+
+        if (buffer.frameStartNs != 0)
+        {
+            // 지난 프레임에 끝난 구간들을 이름별로 합산
+            std::uint64_t first = std::max(buffer.frameStartIndex, written > EVENT_CAPACITY ? written - EVENT_CAPACITY : 0);
+            thread_local std::unordered_map<const char*, ZoneTotal> totals;
+            totals.clear();
+            for (std::uint64_t i = first; i < written; ++i)
+            {
+                const ZoneEvent& event = buffer.events[i % EVENT_CAPACITY];
+                ZoneTotal& total = totals[event.name];
+                total.name = event.name;
+                total.milliseconds += static_cast<float>(event.endNs - event.startNs) / 1.0e6f;
+                total.calls += 1;
+                total.depth = event.depth;
+            }
+
+            std::vector<ZoneTotal> top;
+            top.reserve(totals.size());
+            for (const auto& [name, total] : totals)
+            {
+                top.push_back(total);
+            }
+            std::size_t count = std::min(TOP_ZONE_COUNT, top.size());
+            std::partial_sort(top.begin(), top.begin() + count, top.end(),
+                              [](const ZoneTotal& a, const ZoneTotal& b) { return a.milliseconds > b.milliseconds; });
+            top.resize(count);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            buffer.frameMs[buffer.frameCursor % FRAME_HISTORY] = static_cast<float>(now - buffer.frameStartNs) / 1.0e6f;
+            ++buffer.frameCursor;
+            buffer.topZones = std::move(top);
+        }
+
+        buffer.frameStartNs = now;
+        buffer.frameStartIndex = written;
+    }
+
+    // 모든 스레드의 요약 복사 (다른 스레드에서 호출해도 됨)
+    std::vector<ThreadSummary> getSummaries() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<ThreadSummary> summaries;
+        for (const auto& buffer : m_buffers)
+        {
+            if (buffer->frameCursor == 0) continue;
+
+            ThreadSummary summary;
+            summary.threadName = buffer->name;
+            std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(buffer->frameCursor, FRAME_HISTORY));
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                std::uint64_t index = buffer->frameCursor - count + i;
+                summary.frameMs.push_back(buffer->frameMs[index % FRAME_HISTORY]);
+            }
+            summary.topZones = buffer->topZones;
+            summaries.push_back(std::move(summary));
+        }
+        return summaries;
+    }
+
+    // 링 버퍼에 남아있는 구간들을 Chrome trace_event JSON으로 저장 (chrome://tracing, Perfetto)
+    bool writeChromeTrace(const std::string& filename) const
+    {
+        std::ofstream file(filename);
+        if (!file.is_open()) return false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        file << "{\"traceEvents\":[\n";
+        bool first = true;
+        for (std::size_t tid = 0; tid < m_buffers.size(); ++tid)
+        {
+            const ThreadBuffer& buffer = *m_buffers[tid];
+
+            file << (first ? "" : ",\n")
+                 << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+                 << ",\"args\":{\"name\":\"" << buffer.name << "\"}}";
+            first = false;
+
+            // 기록 중인 스레드가 덮어쓸 수 있는 가장 오래된 구간들은 건너뜀
+            std::uint64_t written = buffer.written.load(std::memory_order_acquire);
+            std::uint64_t safeCount = EVENT_CAPACITY - EVENT_CAPACITY / 8;
+            std::uint64_t begin = written > safeCount ? written - safeCount : 0;
+            for (std::uint64_t i = begin; i < written; ++i)
+            {
+                const ZoneEvent& event = buffer.events[i % EVENT_CAPACITY];
+                if (!event.name) continue;
+                file << ",\n{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid
+                     << ",\"ts\":" << (event.startNs - m_epochNs) / 1000.0
+                     << ",\"dur\":" << (event.endNs - event.startNs) / 1000.0 << "}";
+            }
+        }
+        file << "\n]}\n";
+        return true;
+    }
+
+    // 구간 측정용 RAII 객체
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name)
+            : m_name(name)
+            , m_depth(Profiler::instance().beginZone())
+            , m_startNs(Profiler::nowNs())
+        {
+        }
+
+        ~Scope() { Profiler::instance().endZone(m_name, m_startNs, m_depth); }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        const char* m_name;
+        std::uint32_t m_depth;
+        std::uint64_t m_startNs;
+    };
+
+private:
+    struct ThreadBuffer
+    {
+        std::string name;
+        std::vector<ZoneEvent> events = std::vector<ZoneEvent>(EVENT_CAPACITY);
+        std::atomic<std::uint64_t> written{0};  // 지금까지 기록한 구간 수 (소유 스레드만 씀)
+        std::uint32_t depth = 0;
+
+        // 프레임 요약 (소유 스레드가 쓰고 m_mutex로 보호)
+        std::uint64_t frameStartNs = 0;
+        std::uint64_t frameStartIndex = 0;
+        std::vector<float> frameMs = std::vector<float>(FRAME_HISTORY, 0.f);
+        std::uint64_t frameCursor = 0;
+        std::vector<ZoneTotal> topZones;
+    };
+
+    Profiler()
+        : m_epochNs(nowNs())
+    {
+    }
+
+    // 스레드마다 처음 호출될 때 버퍼를 등록 (버퍼는 프로그램 종료까지 유지)
+    ThreadBuffer& threadBuffer()
+    {
+        thread_local ThreadBuffer* buffer = nullptr;
+        if (!buffer)
+        {
+            auto created = std::make_unique<ThreadBuffer>();
+            buffer = created.get();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            buffer->name = "Thread " + std::to_string(m_buffers.size());
+            m_buffers.push_back(std::move(created));
+        }
+        return *buffer;
+    }
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+    std::uint64_t m_epochNs;
+};
+
+#define PROFILER_CONCAT_INNER(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_INNER(a, b)
+
+#ifdef GIVEITUP_PROFILER
+    #define PROFILE_SCOPE(name) Profiler::Scope PROFILER_CONCAT(profileScope_, __LINE__)(name)
+    #define PROFILE_FUNCTION() PROFILE_SCOPE(__func__)
+    #define PROFILE_FRAME() Profiler::instance().endFrame()
+    #define PROFILE_THREAD(name) Profiler::instance().setThreadName(name)
+#else
+    #define PROFILE_SCOPE(name) ((void)0)
+    #define PROFILE_FUNCTION() ((void)0)
+    #define PROFILE_FRAME() ((void)0)
+    #define PROFILE_THREAD(name) ((void)0)
+#endif
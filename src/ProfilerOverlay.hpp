@@ -0,0 +1,148 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "Profiler.hpp"
+#include "RenderStats.hpp"
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// 프로파일러 오버레이: 스레드별 프레임 시간 그래프와 지난 프레임의 상위 구간, 렌더링 통계 표시
+// update()에서 Profiler 요약을 가져와 도형을 다시 만들고, draw는 그것만 그림
+class ProfilerOverlay : public sf::Drawable
+{
+public:
+    static constexpr float GRAPH_WIDTH = 240.f;
+    static constexpr float GRAPH_HEIGHT = 60.f;
+    static constexpr float GRAPH_MAX_MS = 33.3f;  // 그래프 세로축 최대값 (30fps)
+
+    ProfilerOverlay(const sf::Font& font, const sf::Vector2f& position)
+        : m_text(font, "", 12)
+        , m_position(position)
+    {
+        m_text.setFillColor(sf::Color::White);
+    }
+
+    void setVisible(bool visible) { m_visible = visible; }
+    bool isVisible() const { return m_visible; }
+    void toggle() { m_visible = !m_visible; }
+
+    // 목표 프레임 시간 선 (ms)
+    void setTargetFrameMs(float targetMs) { m_targetMs = targetMs; }
+
+    // 지난 프레임의 렌더링 통계 (렌더링하는 스레드에서 endFrame 결과를 넘김)
+    void setRenderStats(const RenderStats::Frame& frame)
+    {
+        m_renderStats = frame;
+        m_hasRenderStats = true;
+    }
+
+    void update()
+    {
+        if (!m_visible) return;
+
+        std::vector<Profiler::ThreadSummary> summaries = Profiler::instance().getSummaries();
+
+        m_background.clear();
+        m_graph.clear();
+        std::ostringstream text;
+        text << std::fixed << std::setprecision(2);
+
+        float y = m_position.y;
+        for (const auto& summary : summaries)
+        {
+            float average = 0.f;
+            float worst = 0.f;
+            for (float ms : summary.frameMs)
+            {
+                average += ms;
+                worst = std::max(worst, ms);
+            }
+            if (!summary.frameMs.empty()) average /= static_cast<float>(summary.frameMs.size());
+
+            // 그래프 배경 + 목표 프레임 시간 선
+            appendRect(m_background, {m_position.x, y}, {GRAPH_WIDTH, GRAPH_HEIGHT}, sf::Color{0, 0, 0, 160});
+            float targetY = y + GRAPH_HEIGHT - std::min(m_targetMs / GRAPH_MAX_MS, 1.f) * GRAPH_HEIGHT;
+            appendRect(m_background, {m_position.x, targetY}, {GRAPH_WIDTH, 1.f}, sf::Color{200, 200, 80, 160});
+
+            // 프레임마다 막대 하나 (목표를 넘으면 빨간색)
+            float barWidth = GRAPH_WIDTH / Profiler::FRAME_HISTORY;
+            float x = m_position.x + GRAPH_WIDTH - barWidth * summary.frameMs.size();
+            for (float ms : summary.frameMs)
+            {
+                float height = std::min(ms / GRAPH_MAX_MS, 1.f) * GRAPH_HEIGHT;
+                sf::Color color = ms > m_targetMs ? sf::Color{220, 80, 80} : sf::Color{80, 200, 120};
+                appendRect(m_graph, {x, y + GRAPH_HEIGHT - height}, {barWidth, height}, color);
+                x += barWidth;
+            }
+
+            // 텍스트는 그래프 오른쪽에
+            text << summary.threadName << "  avg " << average << " ms  max " << worst << " ms\n";
+            for (const auto& zone : summary.topZones)
+            {
+                text << std::string(zone.depth * 2, ' ') << zone.name << "  " << zone.milliseconds
+                     << " ms (" << zone.calls << ")\n";
+            }
+            text << "\n";
+            y += GRAPH_HEIGHT + 8.f;
+        }
+
+        if (summaries.empty())
+        {
+            text << "Profiler: no frames recorded\n";
+        }
+
+        if (m_hasRenderStats)
+        {
+            appendCounters(text, "Render", m_renderStats.total);
+            for (const auto& entry : m_renderStats.tags)
+            {
+                appendCounters(text, entry.tag, entry.counters);
+            }
+        }
+
+        m_text.setString(text.str());
+        m_text.setPosition({m_position.x + GRAPH_WIDTH + 8.f, m_position.y});
+        sf::FloatRect textBounds = m_text.getGlobalBounds();
+        appendRect(m_background, textBounds.position - sf::Vector2f(4.f, 4.f),
+                   textBounds.size + sf::Vector2f(8.f, 8.f), sf::Color{0, 0, 0, 160});
+    }
+
+private:
+    static void appendCounters(std::ostringstream& text, const std::string& label, const RenderStats::Counters& counters)
+    {
+        text << label << ": " << counters.drawCalls << " draws, " << counters.vertices << " verts, "
+             << counters.textureSwitches << " tex, " << counters.shaderSwitches << " shader, "
+             << counters.viewChanges << " views\n";
+    }
+
+    static void appendRect(sf::VertexArray& vertices, const sf::Vector2f& position, const sf::Vector2f& size,
+                           const sf::Color& color)
+    {
+        sf::Vector2f max = position + size;
+        vertices.append({position, color, {}});
+        vertices.append({{max.x, position.y}, color, {}});
+        vertices.append({{position.x, max.y}, color, {}});
+        vertices.append({{position.x, max.y}, color, {}});
+        vertices.append({{max.x, position.y}, color, {}});
+        vertices.append({max, color, {}});
+    }
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        if (!m_visible) return;
+        target.draw(m_background, states);
+        target.draw(m_graph, states);
+        target.draw(m_text, states);
+    }
+
+    sf::Text m_text;
+    sf::Vector2f m_position;
+    sf::VertexArray m_background{sf::PrimitiveType::Triangles};
+    sf::VertexArray m_graph{sf::PrimitiveType::Triangles};
+    RenderStats::Frame m_renderStats;
+    bool m_hasRenderStats = false;
+    float m_targetMs = 1000.f / 144.f;
+    bool m_visible = false;
+};
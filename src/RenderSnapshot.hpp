@@ -0,0 +1,72 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "SpriteBatch.hpp"
+#include "Minimap.hpp"
+#include "RenderStats.hpp"
+#include <vector>
+#include <variant>
+
+// UI 그리기 명령을 복사해서 모아두는 목록
+// UI 클래스들의 render(target, states)에 RenderTarget 대신 넘기면
+// 말단 도형(사각형/스프라이트/텍스트)을 상태와 함께 복사해서 기록함
+// 기록된 목록은 다른 스레드에서 RenderTarget에 그대로 재생할 수 있음
+class DrawList
+{
+public:
+    void clear() { m_commands.clear(); }
+    bool empty() const { return m_commands.empty(); }
+    std::size_t size() const { return m_commands.size(); }
+
+    void draw(const sf::RectangleShape& shape, const sf::RenderStates& states = sf::RenderStates::Default)
+    {
+        m_commands.push_back({shape, states});
+    }
+
+    void draw(const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default)
+    {
+        m_commands.push_back({sprite, states});
+    }
+
+    void draw(const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default)
+    {
+        m_commands.push_back({text, states});
+    }
+
+    // UI 클래스 (render 템플릿을 가진 객체)는 자기 자식들을 이 목록에 그리게 함
+    template<typename Widget>
+    void draw(const Widget& widget, const sf::RenderStates& states = sf::RenderStates::Default)
+    {
+        widget.render(*this, states);
+    }
+
+    // 기록된 명령들을 순서대로 그림
+    void replay(sf::RenderTarget& target) const
+    {
+        for (const Command& command : m_commands)
+        {
+            std::visit([&](const auto& drawable) { RenderStats::draw(target, drawable, command.states); }, command.drawable);
+        }
+    }
+
+private:
+    struct Command
+    {
+        std::variant<sf::RectangleShape, sf::Sprite, sf::Text> drawable;
+        sf::RenderStates states;
+    };
+
+    std::vector<Command> m_commands;
+};
+
+// 시뮬레이션 스레드가 매 틱 발행하는 렌더링용 상태 (렌더 스레드는 이것만 읽음)
+struct RenderSnapshot
+{
+    sf::Color clearColor = sf::Color::Black;
+    sf::View gameView;
+    sf::View uiView;
+    std::vector<SpriteBatch::Quad> worldQuads;  // 월드 엔티티 (변환이 적용된 사각형 + 텍스처)
+    DrawList ui;                                // UI 그리기 목록
+    Minimap::Overlay minimap;                   // 미니맵 위의 플레이어/카메라 영역 (타일 좌표)
+    std::uint64_t tick = 0;                     // 발행 번호
+};
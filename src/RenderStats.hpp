@@ -0,0 +1,222 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// 프레임당 렌더링 통계 (draw call, 정점 수, 텍스처/셰이더 전환, 뷰 변경)
+//
+// sf::RenderTarget::draw는 가상 함수가 아니라서 가로챌 수 없으므로
+// 직접 그리는 곳은 RenderStats::draw / RenderStats::setView를 거치고,
+// 자체적으로 배치하는 클래스들(SpriteBatch 등)은 recordDraw로 직접 보고함
+// RenderStats::Tag로 감싼 구간의 통계는 태그(하위 시스템)별로 따로 모임
+// 스레드마다 따로 집계됨 (렌더링하는 스레드에서 beginFrame/endFrame 호출)
+class RenderStats
+{
+public:
+    struct Counters
+    {
+        std::uint32_t drawCalls = 0;
+        std::uint32_t vertices = 0;
+        std::uint32_t textureSwitches = 0;
+        std::uint32_t shaderSwitches = 0;
+        std::uint32_t viewChanges = 0;
+
+        void add(const Counters& other)
+        {
+            drawCalls += other.drawCalls;
+            vertices += other.vertices;
+            textureSwitches += other.textureSwitches;
+            shaderSwitches += other.shaderSwitches;
+            viewChanges += other.viewChanges;
+        }
+    };
+
+    struct TagCounters
+    {
+        const char* tag = nullptr;
+        Counters counters;
+    };
+
+    struct Frame
+    {
+        Counters total;
+        std::vector<TagCounters> tags;  // 처음 기록된 순서
+
+        const Counters* find(const char* tag) const
+        {
+            for (const auto& entry : tags)
+            {
+                if (std::strcmp(entry.tag, tag) == 0) return &entry.counters;
+            }
+            return nullptr;
+        }
+    };
+
+    // 현재 스레드의 통계
+    static RenderStats& current()
+    {
+        thread_local RenderStats stats;
+        return stats;
+    }
+
+    void beginFrame()
+    {
+        m_frame.total = {};
+        m_frame.tags.clear();
+        m_lastTexture = nullptr;
+        m_lastShader = nullptr;
+        m_hasView = false;
+    }
+
+    // 프레임 종료 후 결과 (다음 beginFrame까지 유효)
+    const Frame& endFrame()
+    {
+        m_lastFrame = m_frame;
+        return m_lastFrame;
+    }
+
+    const Frame& getLastFrame() const { return m_lastFrame; }
+
+    // draw call 하나 기록 (texture는 실제로 바인딩되는 텍스처, 글꼴처럼 텍스처를 알 수 없으면 대표 포인터)
+    void recordDraw(std::size_t vertexCount, const void* texture, const sf::Shader* shader)
+    {
+        Counters delta;
+        delta.drawCalls = 1;
+        delta.vertices = static_cast<std::uint32_t>(vertexCount);
+        if (texture != m_lastTexture)
+        {
+            delta.textureSwitches = 1;
+            m_lastTexture = texture;
+        }
+        if (shader != m_lastShader)
+        {
+            delta.shaderSwitches = 1;
+            m_lastShader = shader;
+        }
+        accumulate(delta);
+    }
+
+    void recordDraw(std::size_t vertexCount, const sf::RenderStates& states)
+    {
+        recordDraw(vertexCount, states.texture, states.shader);
+    }
+
+    // 뷰 설정 기록 (이전과 다를 때만 변경으로 셈)
+    void recordView(const sf::View& view)
+    {
+        if (m_hasView && sameView(view, m_lastView)) return;
+        m_lastView = view;
+        m_hasView = true;
+        Counters delta;
+        delta.viewChanges = 1;
+        accumulate(delta);
+    }
+
+    // 통계를 구분할 하위 시스템 태그 (중첩 가능, 안쪽 태그로 집계)
+    class Tag
+    {
+    public:
+        explicit Tag(const char* name)
+            : m_previous(current().m_currentTag)
+        {
+            current().m_currentTag = name;
+        }
+
+        ~Tag() { current().m_currentTag = m_previous; }
+
+        Tag(const Tag&) = delete;
+        Tag& operator=(const Tag&) = delete;
+
+    private:
+        const char* m_previous;
+    };
+
+    // 통계를 기록하면서 그리기
+    template<typename T>
+    static void draw(sf::RenderTarget& target, const T& drawable, const sf::RenderStates& states = sf::RenderStates::Default)
+    {
+        target.draw(drawable, states);
+        current().recordDrawable(drawable, states);
+    }
+
+    static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                     sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default)
+    {
+        target.draw(vertices, vertexCount, type, states);
+        current().recordDraw(vertexCount, states);
+    }
+
+    static void setView(sf::RenderTarget& target, const sf::View& view)
+    {
+        target.setView(view);
+        current().recordView(view);
+    }
+
+private:
+    void accumulate(const Counters& delta)
+    {
+        m_frame.total.add(delta);
+        if (!m_currentTag) return;
+        for (auto& entry : m_frame.tags)
+        {
+            if (entry.tag == m_currentTag)
+            {
+                entry.counters.add(delta);
+                return;
+            }
+        }
+        m_frame.tags.push_back({m_currentTag, delta});
+    }
+
+    // SFML 도형 하나가 내부적으로 그리는 양 (채우기 + 테두리)
+    void recordDrawable(const sf::Shape& shape, const sf::RenderStates& states)
+    {
+        std::size_t points = shape.getPointCount();
+        recordDraw(points + 2, shape.getTexture(), states.shader);
+        if (shape.getOutlineThickness() != 0.f)
+        {
+            recordDraw((points + 1) * 2, nullptr, states.shader);
+        }
+    }
+
+    void recordDrawable(const sf::Sprite& sprite, const sf::RenderStates& states)
+    {
+        recordDraw(4, &sprite.getTexture(), states.shader);
+    }
+
+    void recordDrawable(const sf::Text& text, const sf::RenderStates& states)
+    {
+        // 글꼴 텍스처는 밖에서 알 수 없으므로 글꼴 포인터로 대신함 (글자당 사각형 하나)
+        std::size_t vertices = text.getString().getSize() * 6;
+        recordDraw(vertices, &text.getFont(), states.shader);
+        if (text.getOutlineThickness() != 0.f)
+        {
+            recordDraw(vertices, &text.getFont(), states.shader);
+        }
+    }
+
+    void recordDrawable(const sf::VertexArray& vertices, const sf::RenderStates& states)
+    {
+        if (vertices.getVertexCount() == 0) return;
+        recordDraw(vertices.getVertexCount(), states);
+    }
+
+    // 내부에서 직접 recordDraw로 보고하는 Drawable (SpriteBatch, TileMap 등)
+    void recordDrawable(const sf::Drawable&, const sf::RenderStates&) {}
+
+    static bool sameView(const sf::View& a, const sf::View& b)
+    {
+        return a.getCenter() == b.getCenter() && a.getSize() == b.getSize() &&
+               a.getRotation() == b.getRotation() && a.getViewport() == b.getViewport();
+    }
+
+    Frame m_frame;
+    Frame m_lastFrame;
+    const char* m_currentTag = nullptr;
+    const void* m_lastTexture = nullptr;
+    const sf::Shader* m_lastShader = nullptr;
+    sf::View m_lastView;
+    bool m_hasView = false;
+};
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "RenderSnapshot.hpp"
+#include "TripleBuffer.hpp"
+#include "Profiler.hpp"
+#include <atomic>
+#include <functional>
+#include <thread>
+
+// 렌더링 전용 스레드
+// 메인(시뮬레이션) 스레드는 이벤트 처리와 업데이트만 하고 매 틱 스냅샷을 발행하며,
+// 렌더 스레드는 가장 최근 스냅샷을 그리고 display()를 호출함
+// display()가 vsync나 드라이버 때문에 늦어져도 시뮬레이션은 멈추지 않음
+// 프레임 제한은 창의 setFramerateLimit 대신 display() 뒤에 직접 쉼 (display 시간에 대기 시간이 섞이지 않게)
+class RenderThread
+{
+public:
+    using RenderFunction = std::function<void(sf::RenderWindow&, const RenderSnapshot&)>;
+    using DisplayedFunction = std::function<void(sf::Time displayTime)>;
+
+    RenderThread(sf::RenderWindow& window, RenderFunction renderFunction)
+        : m_window(window)
+        , m_render(std::move(renderFunction))
+    {
+    }
+
+    ~RenderThread() { stop(); }
+
+    // 프레임 간격 (0이면 제한 없음), start 전에 설정
+    void setFrameInterval(sf::Time interval) { m_frameInterval = interval; }
+
+    // display()가 끝날 때마다 display() 안에서 걸린 시간으로 호출 (렌더 스레드), start 전에 설정
+    void setDisplayedCallback(DisplayedFunction displayed) { m_displayed = std::move(displayed); }
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // 렌더 스레드 시작 (창의 GL 컨텍스트를 렌더 스레드로 넘김)
+    bool start()
+    {
+        if (m_thread.joinable()) return true;
+        if (!m_window.setActive(false)) return false;
+        m_running = true;
+        m_thread = std::thread([this]() { run(); });
+        return true;
+    }
+
+    // 렌더 스레드 종료 (컨텍스트를 다시 메인 스레드에서 쓸 수 있게 됨)
+    void stop()
+    {
+        if (!m_thread.joinable()) return;
+        m_running = false;
+        m_thread.join();
+    }
+
+    // 시뮬레이션 쪽: 채울 스냅샷 (이전에 쓰던 버퍼가 재사용되므로 모든 필드를 덮어써야 함)
+    RenderSnapshot& beginSnapshot() { return m_snapshots.back(); }
+
+    // 시뮬레이션 쪽: 채운 스냅샷 발행 (기다리지 않음)
+    void publishSnapshot()
+    {
+        m_snapshots.back().tick = ++m_publishedTicks;
+        m_snapshots.publish();
+    }
+
+    // 렌더 스레드가 그린 프레임 수
+    std::uint64_t getRenderedFrameCount() const { return m_renderedFrames.load(std::memory_order_relaxed); }
+
+private:
+    void run()
+    {
+        PROFILE_THREAD("Render");
+        if (!m_window.setActive(true)) return;
+
+        bool hasSnapshot = false;
+        sf::Clock frameClock;
+        while (m_running)
+        {
+            if (m_snapshots.acquire())
+            {
+                hasSnapshot = true;
+            }
+
+            // 첫 스냅샷이 올 때까지는 그리지 않음
+            if (!hasSnapshot)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            PROFILE_FRAME();
+            m_render(m_window, m_snapshots.front());
+            sf::Clock displayClock;
+            {
+                PROFILE_SCOPE("Display");
+                m_window.display();
+            }
+            if (m_displayed) m_displayed(displayClock.getElapsedTime());
+            m_renderedFrames.fetch_add(1, std::memory_order_relaxed);
+
+            if (m_frameInterval > sf::Time::Zero)
+            {
+                sf::Time elapsed = frameClock.getElapsedTime();
+                if (elapsed < m_frameInterval)
+                {
+                    PROFILE_SCOPE("Frame Limit");
+                    sf::sleep(m_frameInterval - elapsed);
+                }
+                frameClock.restart();
+            }
+        }
+
+        (void)m_window.setActive(false);
+    }
+
+    sf::RenderWindow& m_window;
+    RenderFunction m_render;
+    DisplayedFunction m_displayed;
+    sf::Time m_frameInterval = sf::Time::Zero;
+    TripleBuffer<RenderSnapshot> m_snapshots;
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+    std::atomic<std::uint64_t> m_renderedFrames{0};
+    std::uint64_t m_publishedTicks = 0;
+};
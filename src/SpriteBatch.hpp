@@ -0,0 +1,183 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "RenderStats.hpp"
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+
+// 월드 그리기 순서 (작은 값이 먼저 = 아래에 그려짐)
+namespace DrawLayer
+{
+    constexpr int Enemy = 0;
+    constexpr int Afterimage = 10;
+    constexpr int Player = 20;
+    constexpr int Weapon = 30;
+    constexpr int Projectile = 40;
+}
+
+// 텍스처/비텍스처 사각형(회전 포함)을 모아서 스트리밍 VertexBuffer 하나로 올리고
+// 같은 텍스처끼리 한 번의 draw call로 그리는 배치
+//
+// 정렬 키: (layer, texture). 같은 레이어 안에서는 텍스처별로 묶이므로
+// 겹쳐서 순서가 중요한 것들은 레이어를 나눠서 넣어야 함
+class SpriteBatch : public sf::Drawable
+{
+public:
+    struct Quad
+    {
+        sf::Vertex vertices[4];              // 좌상, 우상, 좌하, 우하
+        const sf::Texture* texture = nullptr;
+        int layer = 0;
+    };
+
+    SpriteBatch()
+        : m_buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Stream)
+    {
+    }
+
+    void clear() { m_quads.clear(); }
+    bool empty() const { return m_quads.empty(); }
+    std::size_t size() const { return m_quads.size(); }
+
+    // 축 정렬 단색 사각형
+    void addRect(const sf::FloatRect& rect, const sf::Color& color, int layer)
+    {
+        sf::Vector2f min = rect.position;
+        sf::Vector2f max = rect.position + rect.size;
+
+        Quad quad;
+        quad.vertices[0] = {{min.x, min.y}, color, {}};
+        quad.vertices[1] = {{max.x, min.y}, color, {}};
+        quad.vertices[2] = {{min.x, max.y}, color, {}};
+        quad.vertices[3] = {{max.x, max.y}, color, {}};
+        quad.layer = layer;
+        m_quads.push_back(quad);
+    }
+
+    // 테두리가 있는 단색 사각형 (sf::RectangleShape 대체)
+    // SFML과 같이 테두리는 사각형 바깥쪽으로 그려짐
+    void addOutlinedRect(const sf::FloatRect& rect, const sf::Color& fillColor,
+                         float outlineThickness, const sf::Color& outlineColor, int layer)
+    {
+        if (outlineThickness > 0.f)
+        {
+            sf::FloatRect outer(
+                {rect.position.x - outlineThickness, rect.position.y - outlineThickness},
+                {rect.size.x + outlineThickness * 2.f, rect.size.y + outlineThickness * 2.f}
+            );
+            addRect(outer, outlineColor, layer);
+        }
+        addRect(rect, fillColor, layer);
+    }
+
+    // 텍스처 영역을 변환해서 그림 (sf::Sprite 대체)
+    // transform은 sf::Transformable과 같이 (0,0)-(textureRect.size) 로컬 사각형에 적용됨
+    void addSprite(const sf::Texture& texture, const sf::IntRect& textureRect,
+                   const sf::Transform& transform, const sf::Color& color, int layer)
+    {
+        sf::Vector2f size(textureRect.size);
+        float u0 = static_cast<float>(textureRect.position.x);
+        float v0 = static_cast<float>(textureRect.position.y);
+        float u1 = u0 + size.x;
+        float v1 = v0 + size.y;
+
+        Quad quad;
+        quad.vertices[0] = {transform.transformPoint({0.f, 0.f}), color, {u0, v0}};
+        quad.vertices[1] = {transform.transformPoint({size.x, 0.f}), color, {u1, v0}};
+        quad.vertices[2] = {transform.transformPoint({0.f, size.y}), color, {u0, v1}};
+        quad.vertices[3] = {transform.transformPoint({size.x, size.y}), color, {u1, v1}};
+        quad.texture = &texture;
+        quad.layer = layer;
+        m_quads.push_back(quad);
+    }
+
+    // 미리 만들어진 사각형 추가
+    void addQuad(const Quad& quad) { m_quads.push_back(quad); }
+
+    const std::vector<Quad>& getQuads() const { return m_quads; }
+
+    // 다른 곳에서 모은 사각형 목록으로 교체 (기존 용량 재사용)
+    void setQuads(const std::vector<Quad>& quads) { m_quads.assign(quads.begin(), quads.end()); }
+
+    // 마지막 draw의 draw call 수
+    std::size_t getLastDrawCallCount() const { return m_lastDrawCalls; }
+
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        m_lastDrawCalls = 0;
+        if (m_quads.empty()) return;
+
+        // (layer, texture) 순으로 안정 정렬 (같은 키는 추가 순서 유지)
+        m_order.resize(m_quads.size());
+        for (std::size_t i = 0; i < m_order.size(); ++i)
+        {
+            m_order[i] = static_cast<std::uint32_t>(i);
+        }
+        std::stable_sort(m_order.begin(), m_order.end(), [this](std::uint32_t a, std::uint32_t b) {
+            const Quad& qa = m_quads[a];
+            const Quad& qb = m_quads[b];
+            if (qa.layer != qb.layer) return qa.layer < qb.layer;
+            return std::less<const sf::Texture*>()(qa.texture, qb.texture);
+        });
+
+        // 사각형 하나 = 삼각형 2개 (정점 6개)
+        m_vertices.resize(m_quads.size() * 6);
+        for (std::size_t i = 0; i < m_order.size(); ++i)
+        {
+            const sf::Vertex* v = m_quads[m_order[i]].vertices;
+            sf::Vertex* out = &m_vertices[i * 6];
+            out[0] = v[0];
+            out[1] = v[1];
+            out[2] = v[2];
+            out[3] = v[2];
+            out[4] = v[1];
+            out[5] = v[3];
+        }
+
+        bool useBuffer = sf::VertexBuffer::isAvailable() && uploadVertices();
+
+        // 텍스처가 바뀔 때마다 한 번씩 그림 (레이어가 달라도 텍스처가 같으면 이어서 그림)
+        std::size_t runStart = 0;
+        for (std::size_t i = 1; i <= m_order.size(); ++i)
+        {
+            const sf::Texture* runTexture = m_quads[m_order[runStart]].texture;
+            if (i < m_order.size() && m_quads[m_order[i]].texture == runTexture) continue;
+
+            sf::RenderStates runStates = states;
+            runStates.texture = runTexture;
+            std::size_t first = runStart * 6;
+            std::size_t count = (i - runStart) * 6;
+            if (useBuffer)
+            {
+                target.draw(m_buffer, first, count, runStates);
+            }
+            else
+            {
+                target.draw(&m_vertices[first], count, sf::PrimitiveType::Triangles, runStates);
+            }
+            RenderStats::current().recordDraw(count, runStates);
+            ++m_lastDrawCalls;
+            runStart = i;
+        }
+    }
+
+    // 정점을 스트리밍 버퍼에 올림 (부족하면 두 배로 키움)
+    bool uploadVertices() const
+    {
+        if (m_buffer.getVertexCount() < m_vertices.size())
+        {
+            std::size_t capacity = std::max<std::size_t>(m_vertices.size(), m_buffer.getVertexCount() * 2);
+            if (!m_buffer.create(capacity)) return false;
+        }
+        return m_buffer.update(m_vertices.data(), m_vertices.size(), 0);
+    }
+
+    std::vector<Quad> m_quads;
+    mutable std::vector<std::uint32_t> m_order;
+    mutable std::vector<sf::Vertex> m_vertices;
+    mutable sf::VertexBuffer m_buffer;
+    mutable std::size_t m_lastDrawCalls = 0;
+};
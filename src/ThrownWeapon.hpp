@@ -2,6 +2,7 @@
 
 #include <SFML/Graphics.hpp>
 #include "Item.hpp"
+#include "SpriteBatch.hpp"
 
 class TileMap;
 
@@ -12,7 +13,7 @@ enum class ThrownWeaponState
     Dropped     // 바닥에 떨어짐
 };
 
-class ThrownWeapon : public sf::Drawable
+class ThrownWeapon
 {
 public:
     static constexpr float THROW_SPEED = 600.f;         // 던지기 속도
@@ -80,8 +81,8 @@ public:
     bool hasHitEnemy() const { return m_hasHitEnemy; }
     void setHitEnemy() { m_hasHitEnemy = true; }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // 스프라이트 배치에 그리기 추가
+    void addToBatch(SpriteBatch& batch) const
     {
         if (!m_texture) return;
 
@@ -90,23 +91,25 @@ private:
             {SPRITE_WIDTH, SPRITE_HEIGHT}
         );
 
-        sf::Sprite sprite(*m_texture, textureRect);
-        sprite.setOrigin({SPRITE_WIDTH / 2.f, SPRITE_HEIGHT / 2.f});
+        sf::Transformable transform;
+        transform.setOrigin({SPRITE_WIDTH / 2.f, SPRITE_HEIGHT / 2.f});
 
         float scale = SPRITE_SIZE / static_cast<float>(SPRITE_WIDTH);
-        sprite.setScale({scale, scale});
-        sprite.setPosition(m_position);
-        sprite.setRotation(sf::degrees(m_rotation));
+        transform.setScale({scale, scale});
+        transform.setPosition(m_position);
+        transform.setRotation(sf::degrees(m_rotation));
 
         // 떨어진 상태면 약간 투명하게
+        sf::Color color = sf::Color::White;
         if (m_state == ThrownWeaponState::Dropped)
         {
-            sprite.setColor(sf::Color(255, 255, 255, 200));
+            color = sf::Color(255, 255, 255, 200);
         }
 
-        target.draw(sprite, states);
+        batch.addSprite(*m_texture, textureRect, transform.getTransform(), color, DrawLayer::Projectile);
     }
 
+private:
     sf::Vector2f m_position;
     sf::Vector2f m_velocity;
     Item m_weapon;
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// 64x64 청크 단위로 나눈 2D 타일 격자
+//
+// 청크 하나는 연속된 배열이고 격자는 청크 포인터 표만 들고 있음
+// - 한 번도 쓰지 않은 청크는 할당하지 않음 (nullptr = 전부 기본값)
+// - resize는 청크 표만 다시 만들고 기존 청크는 포인터째 옮김 (잘리는 가장자리 청크만 정리)
+// - 격자 복사는 청크 포인터만 복사하고, 공유 중인 청크는 처음 수정할 때 복사함 (copy-on-write)
+//
+// Cell은 기본 생성 값이 "빈 타일"이어야 하고 ==로 비교할 수 있어야 함
+template<typename Cell>
+class TileChunkGrid
+{
+public:
+    static constexpr int CHUNK_SHIFT = 6;
+    static constexpr int CHUNK_SIZE = 1 << CHUNK_SHIFT;
+    static constexpr int CHUNK_MASK = CHUNK_SIZE - 1;
+
+    struct Chunk
+    {
+        std::array<Cell, CHUNK_SIZE * CHUNK_SIZE> cells{};
+
+        const Cell& at(int localX, int localY) const { return cells[localY * CHUNK_SIZE + localX]; }
+        Cell& at(int localX, int localY) { return cells[localY * CHUNK_SIZE + localX]; }
+    };
+
+    TileChunkGrid() = default;
+
+    TileChunkGrid(int width, int height)
+    {
+        resize(width, height);
+    }
+
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    int getChunkColumns() const { return m_chunkColumns; }
+    int getChunkRows() const { return m_chunkRows; }
+
+    bool contains(int x, int y) const
+    {
+        return x >= 0 && x < m_width && y >= 0 && y < m_height;
+    }
+
+    // 좌표 위치를 유지한 채 크기 변경 (새 영역은 빈 타일)
+    void resize(int width, int height)
+    {
+        width = std::max(0, width);
+        height = std::max(0, height);
+        int columns = (width + CHUNK_MASK) >> CHUNK_SHIFT;
+        int rows = (height + CHUNK_MASK) >> CHUNK_SHIFT;
+
+        std::vector<std::shared_ptr<Chunk>> chunks(static_cast<std::size_t>(columns) * rows);
+        int keepColumns = std::min(columns, m_chunkColumns);
+        int keepRows = std::min(rows, m_chunkRows);
+        for (int cy = 0; cy < keepRows; ++cy)
+        {
+            for (int cx = 0; cx < keepColumns; ++cx)
+            {
+                chunks[static_cast<std::size_t>(cy) * columns + cx] = std::move(m_chunks[chunkIndex(cx, cy)]);
+            }
+        }
+
+        m_chunks = std::move(chunks);
+        m_chunkColumns = columns;
+        m_chunkRows = rows;
+
+        // 줄어든 경우 경계에 걸친 청크의 바깥 칸을 비워둠 (다시 늘렸을 때 예전 타일이 보이지 않도록)
+        int keptWidth = std::min(m_width, columns << CHUNK_SHIFT);
+        int keptHeight = std::min(m_height, rows << CHUNK_SHIFT);
+        if (width < m_width) clearOutside(width, 0, keptWidth, keptHeight);
+        if (height < m_height) clearOutside(0, height, std::min(width, keptWidth), keptHeight);
+
+        m_width = width;
+        m_height = height;
+    }
+
+    void clear()
+    {
+        std::fill(m_chunks.begin(), m_chunks.end(), nullptr);
+    }
+
+    // 읽기 (좌표는 contains로 확인된 값이어야 함)
+    const Cell& get(int x, int y) const
+    {
+        const Chunk* chunk = getChunk(x >> CHUNK_SHIFT, y >> CHUNK_SHIFT);
+        return chunk ? chunk->at(x & CHUNK_MASK, y & CHUNK_MASK) : emptyCell();
+    }
+
+    // 쓰기용 참조 (청크가 없으면 만들고, 공유 중이면 복사함)
+    Cell& edit(int x, int y)
+    {
+        return editChunk(x >> CHUNK_SHIFT, y >> CHUNK_SHIFT).at(x & CHUNK_MASK, y & CHUNK_MASK);
+    }
+
+    // y 줄의 [x0, x1) 칸을 value로 채움 (청크마다 연속 구간 한 번씩)
+    // 빈 값으로 채울 때는 할당되지 않은 청크를 건드리지 않음
+    void fillRow(int y, int x0, int x1, const Cell& value)
+    {
+        x0 = std::max(0, x0);
+        x1 = std::min(m_width, x1);
+        if (y < 0 || y >= m_height || x0 >= x1) return;
+
+        bool empty = value == Cell{};
+        int chunkY = y >> CHUNK_SHIFT;
+        int localY = y & CHUNK_MASK;
+        for (int x = x0; x < x1;)
+        {
+            int chunkX = x >> CHUNK_SHIFT;
+            int end = std::min(x1, (chunkX + 1) << CHUNK_SHIFT);
+            if (!empty || getChunk(chunkX, chunkY))
+            {
+                Cell* row = &editChunk(chunkX, chunkY).at(0, localY);
+                std::fill(row + (x & CHUNK_MASK), row + (x & CHUNK_MASK) + (end - x), value);
+            }
+            x = end;
+        }
+    }
+
+    // y 줄의 [x0, x1)을 같은 값이 이어지는 구간으로 나눠 f(start, end, cell) 호출
+    // 할당되지 않은 청크는 빈 값 구간 하나로 넘김
+    template<typename Func>
+    void forEachRowRun(int y, int x0, int x1, Func&& f) const
+    {
+        x0 = std::max(0, x0);
+        x1 = std::min(m_width, x1);
+        if (y < 0 || y >= m_height || x0 >= x1) return;
+
+        int chunkY = y >> CHUNK_SHIFT;
+        int localY = y & CHUNK_MASK;
+        int runStart = x0;
+        const Cell* runValue = nullptr;
+        for (int x = x0; x < x1;)
+        {
+            int chunkX = x >> CHUNK_SHIFT;
+            int end = std::min(x1, (chunkX + 1) << CHUNK_SHIFT);
+            const Chunk* chunk = getChunk(chunkX, chunkY);
+            for (; x < end; ++x)
+            {
+                const Cell& cell = chunk ? chunk->at(x & CHUNK_MASK, localY) : emptyCell();
+                if (runValue && !(cell == *runValue))
+                {
+                    f(runStart, x, *runValue);
+                    runStart = x;
+                }
+                runValue = &cell;
+                if (!chunk)
+                {
+                    // 빈 청크는 칸마다 보지 않고 끝으로 건너뜀
+                    x = end - 1;
+                }
+            }
+        }
+        f(runStart, x1, *runValue);
+    }
+
+    // 청크 단위 접근 (nullptr = 전부 빈 타일)
+    const Chunk* getChunk(int chunkX, int chunkY) const
+    {
+        return m_chunks[chunkIndex(chunkX, chunkY)].get();
+    }
+
+    Chunk& editChunk(int chunkX, int chunkY)
+    {
+        std::shared_ptr<Chunk>& chunk = m_chunks[chunkIndex(chunkX, chunkY)];
+        if (!chunk)
+        {
+            chunk = std::make_shared<Chunk>();
+        }
+        else if (chunk.use_count() > 1)
+        {
+            chunk = std::make_shared<Chunk>(*chunk);
+        }
+        return *chunk;
+    }
+
+    // [x0, x1) x [y0, y1) 범위의 칸을 f(x, y, cell)로 방문 (할당되지 않은 청크는 건너뜀)
+    template<typename Func>
+    void forEachCell(int x0, int y0, int x1, int y1, Func&& f) const
+    {
+        x0 = std::max(0, x0);
+        y0 = std::max(0, y0);
+        x1 = std::min(m_width, x1);
+        y1 = std::min(m_height, y1);
+        if (x0 >= x1 || y0 >= y1) return;
+
+        for (int cy = y0 >> CHUNK_SHIFT; cy <= (y1 - 1) >> CHUNK_SHIFT; ++cy)
+        {
+            for (int cx = x0 >> CHUNK_SHIFT; cx <= (x1 - 1) >> CHUNK_SHIFT; ++cx)
+            {
+                const Chunk* chunk = getChunk(cx, cy);
+                if (!chunk) continue;
+
+                int startX = std::max(x0, cx << CHUNK_SHIFT);
+                int endX = std::min(x1, (cx + 1) << CHUNK_SHIFT);
+                int startY = std::max(y0, cy << CHUNK_SHIFT);
+                int endY = std::min(y1, (cy + 1) << CHUNK_SHIFT);
+                for (int y = startY; y < endY; ++y)
+                {
+                    for (int x = startX; x < endX; ++x)
+                    {
+                        f(x, y, chunk->at(x & CHUNK_MASK, y & CHUNK_MASK));
+                    }
+                }
+            }
+        }
+    }
+
+    template<typename Func>
+    void forEachCell(Func&& f) const
+    {
+        forEachCell(0, 0, m_width, m_height, std::forward<Func>(f));
+    }
+
+    // 할당된 청크 수 (메모리 사용량 확인용)
+    std::size_t getAllocatedChunkCount() const
+    {
+        return static_cast<std::size_t>(std::count_if(m_chunks.begin(), m_chunks.end(),
+                                                      [](const auto& chunk) { return chunk != nullptr; }));
+    }
+
+private:
+    static const Cell& emptyCell()
+    {
+        static const Cell empty{};
+        return empty;
+    }
+
+    std::size_t chunkIndex(int chunkX, int chunkY) const
+    {
+        return static_cast<std::size_t>(chunkY) * m_chunkColumns + chunkX;
+    }
+
+    // 새 크기의 청크 표 안에서 [x0, x1) x [y0, y1) 칸을 빈 타일로 (할당된 청크만)
+    void clearOutside(int x0, int y0, int x1, int y1)
+    {
+        for (int y = y0; y < y1; ++y)
+        {
+            for (int x = x0; x < x1; ++x)
+            {
+                if (getChunk(x >> CHUNK_SHIFT, y >> CHUNK_SHIFT)) edit(x, y) = Cell{};
+            }
+        }
+    }
+
+    int m_width = 0;
+    int m_height = 0;
+    int m_chunkColumns = 0;
+    int m_chunkRows = 0;
+    std::vector<std::shared_ptr<Chunk>> m_chunks;
+};
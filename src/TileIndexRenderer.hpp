@@ -0,0 +1,381 @@
+#pragma once
+
+#include <SFML/Graphics.hpp>
+#include "RenderStats.hpp"
+#include <vector>
+#include <array>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// 타일 인덱스를 텍스처(타일 하나 = 텍셀 하나)로 올려두고
+// 화면에 보이는 영역을 사각형 하나로 그리면서 셰이더가 픽셀마다 타일을 찾아 색을 칠하는 렌더러
+//
+// 텍셀 형식 (RGBA8): R = TileType, G = CollisionShape, B = 타일셋 x, A = 타일셋 y
+// 맵이 텍스처 최대 크기보다 크면 여러 페이지로 나눠서 보이는 페이지만 그림
+// CPU 쪽 텍셀은 들고 있지 않고, 업로드할 때 RowSource로 해당 줄의 타일을 받아옴 (타일 데이터는 호출하는 쪽에만 있음)
+// - 페이지 텍스처는 처음 보일 때 만들고 draw마다 예산만큼씩 줄 단위로 채움 (큰 맵도 멈추지 않음)
+// - 타일을 바꾼 쪽에서 markDirty로 알리면 다음 draw에서 그 영역만 Texture::update로 다시 올림
+// - 많이 축소했을 때는 setLod(true)로 같은 페이지를 팔레트 색만 찾아 칠함 (테두리/간격/타일셋 생략)
+class TileIndexRenderer : public sf::Drawable
+{
+public:
+    static constexpr unsigned int MAX_PAGE_SIZE = 4096;  // 페이지 한 장의 최대 타일 수 (가로/세로)
+    static constexpr int MAX_TILE_TYPES = 4;
+    static constexpr std::size_t DEFAULT_UPLOAD_BUDGET = 4u * 1024u * 1024u;  // draw 한 번에 새로 채울 텍셀 수
+    static constexpr std::size_t UPLOAD_BAND_TEXELS = 256u * 1024u;          // 업로드 버퍼 크기 상한 (텍셀)
+
+    // y 줄의 [x0, x1) 타일을 out에 인덱스 텍셀로 채움 ((x1 - x0) * 4 바이트)
+    using RowSource = std::function<void(int y, int x0, int x1, std::uint8_t* out)>;
+
+    explicit TileIndexRenderer(float tileSize = 32.f)
+        : m_tileSize(tileSize)
+    {
+        m_fillColors.fill(sf::Color::Transparent);
+        m_outlineColors.fill(sf::Color::Transparent);
+    }
+
+    // 셰이더 사용 가능 여부 (불가능하면 호출하는 쪽에서 기존 방식으로 그려야 함)
+    static bool isAvailable() { return sf::Shader::isAvailable(); }
+
+    // 셰이더가 실제로 컴파일되어 그릴 수 있는지 (GL 컨텍스트가 활성화된 상태에서 호출)
+    bool canRender() const { return ensureShader(); }
+
+    void setSource(RowSource source) { m_source = std::move(source); }
+
+    // 맵 크기 설정 (페이지는 다음에 보일 때 소스에서 다시 채움)
+    void resize(unsigned int width, unsigned int height)
+    {
+        m_width = width;
+        m_height = height;
+        // GL 최대 텍스처 크기는 여기서 묻지 않음 (창 없이 맵만 만들 때 GL 컨텍스트가 필요 없도록)
+        m_pageSize = MAX_PAGE_SIZE;
+        m_pageColumns = (width + m_pageSize - 1) / m_pageSize;
+        m_pageRows = (height + m_pageSize - 1) / m_pageSize;
+
+        m_pages.clear();
+        m_pages.resize(static_cast<std::size_t>(m_pageColumns) * m_pageRows);
+        for (unsigned int row = 0; row < m_pageRows; ++row)
+        {
+            for (unsigned int col = 0; col < m_pageColumns; ++col)
+            {
+                Page& page = m_pages[static_cast<std::size_t>(row) * m_pageColumns + col];
+                page.origin = {col * m_pageSize, row * m_pageSize};
+                page.size = {std::min(m_pageSize, width - page.origin.x),
+                             std::min(m_pageSize, height - page.origin.y)};
+            }
+        }
+    }
+
+    unsigned int getWidth() const { return m_width; }
+    unsigned int getHeight() const { return m_height; }
+
+    void setTileSize(float tileSize) { m_tileSize = tileSize; }
+    float getTileSize() const { return m_tileSize; }
+
+    void setUploadBudget(std::size_t texels) { m_uploadBudget = std::max<std::size_t>(1, texels); }
+
+    // 타일 영역이 바뀜 (아직 채우지 않은 줄은 나중에 채울 때 반영되므로 무시)
+    void markDirty(const sf::IntRect& rect)
+    {
+        int x0 = std::max(0, rect.position.x);
+        int y0 = std::max(0, rect.position.y);
+        int x1 = std::min(static_cast<int>(m_width), rect.position.x + rect.size.x);
+        int y1 = std::min(static_cast<int>(m_height), rect.position.y + rect.size.y);
+        if (x0 >= x1 || y0 >= y1) return;
+
+        for (unsigned int row = y0 / m_pageSize; row <= (y1 - 1) / m_pageSize; ++row)
+        {
+            for (unsigned int col = x0 / m_pageSize; col <= (x1 - 1) / m_pageSize; ++col)
+            {
+                Page& page = m_pages[static_cast<std::size_t>(row) * m_pageColumns + col];
+                if (page.filledRows == 0) continue;
+                unsigned int lx0 = std::max<unsigned int>(x0, page.origin.x) - page.origin.x;
+                unsigned int ly0 = std::max<unsigned int>(y0, page.origin.y) - page.origin.y;
+                unsigned int lx1 = std::min<unsigned int>(x1, page.origin.x + page.size.x) - page.origin.x;
+                unsigned int ly1 = std::min<unsigned int>(y1, page.origin.y + page.size.y) - page.origin.y;
+                page.markDirty(lx0, ly0, lx1, ly1);
+            }
+        }
+    }
+
+    void markAllDirty() { markDirty({{0, 0}, {static_cast<int>(m_width), static_cast<int>(m_height)}}); }
+
+    // 타일 타입별 색상 (타일셋이 없을 때 사용)
+    void setTileColors(std::uint8_t type, const sf::Color& fill, const sf::Color& outline = sf::Color::Transparent)
+    {
+        if (type >= MAX_TILE_TYPES) return;
+        m_fillColors[type] = fill;
+        m_outlineColors[type] = outline;
+    }
+
+    // 타일 안쪽 테두리 두께 (픽셀)
+    void setOutlineThickness(float thickness) { m_outlineThickness = thickness; }
+
+    // 타일 왼쪽/위쪽에 비워둘 간격 (픽셀) - 에디터처럼 타일 사이를 띄울 때 사용
+    void setGap(float gap) { m_gap = gap; }
+
+    // 축소판 모드: 타일이 몇 픽셀 안 될 때 타입별 채우기 색만 칠함
+    void setLod(bool lod) { m_lod = lod; }
+
+    // 타일셋 아틀라스 설정 (nullptr이면 색상 팔레트 사용)
+    // atlasTileSize: 아틀라스 내 타일 하나의 크기 (픽셀)
+    void setTileset(const sf::Texture* atlas, const sf::Vector2u& atlasTileSize)
+    {
+        m_tileset = atlas;
+        m_atlasTileSize = atlasTileSize;
+    }
+
+    // 마지막 draw에서 그린 페이지 수 (= draw call 수)
+    std::size_t getLastDrawCallCount() const { return m_lastDrawCalls; }
+
+private:
+    struct Page
+    {
+        sf::Vector2u origin;                 // 맵 내 시작 타일
+        sf::Vector2u size;                   // 페이지 크기 (타일)
+        sf::Texture texture;
+        unsigned int filledRows = 0;         // 위에서부터 채운 줄 수 (0 = 아직 텍스처 없음)
+        bool dirty = false;
+        unsigned int dirtyMinX = 0, dirtyMinY = 0, dirtyMaxX = 0, dirtyMaxY = 0;  // [min, max)
+
+        void markDirty(unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1)
+        {
+            if (!dirty)
+            {
+                dirty = true;
+                dirtyMinX = x0;
+                dirtyMinY = y0;
+                dirtyMaxX = x1;
+                dirtyMaxY = y1;
+                return;
+            }
+            dirtyMinX = std::min(dirtyMinX, x0);
+            dirtyMinY = std::min(dirtyMinY, y0);
+            dirtyMaxX = std::max(dirtyMaxX, x1);
+            dirtyMaxY = std::max(dirtyMaxY, y1);
+        }
+    };
+
+    static const std::string& fragmentSource()
+    {
+        static const std::string source = R"(
+            uniform sampler2D indexTexture;
+            uniform vec2 pageOrigin;
+            uniform vec2 pageSize;
+            uniform float tileSize;
+            uniform float outlineThickness;
+            uniform float gap;
+            uniform vec4 fillColors[4];
+            uniform vec4 outlineColors[4];
+            uniform bool useTileset;
+            uniform bool lod;
+            uniform sampler2D tileset;
+            uniform vec2 atlasTileScale;
+
+            void main()
+            {
+                // texCoords에는 월드 좌표(픽셀)가 들어옴
+                vec2 world = gl_TexCoord[0].xy;
+                vec2 tile = floor(world / tileSize) - pageOrigin;
+                if (tile.x < 0.0 || tile.y < 0.0 || tile.x >= pageSize.x || tile.y >= pageSize.y)
+                    discard;
+
+                vec4 index = texture2D(indexTexture, (tile + 0.5) / pageSize);
+                int type = int(floor(index.r * 255.0 + 0.5));
+                // 색 배열 밖의 타입은 그리지 않음 (uniform 배열 범위 밖 접근은 정의되지 않음)
+                if (type == 0 || type >= 4)
+                    discard;
+
+                if (lod)
+                {
+                    gl_FragColor = fillColors[type] * gl_Color;
+                    return;
+                }
+
+                vec2 local = world - (tile + pageOrigin) * tileSize;
+                if (local.x < gap || local.y < gap)
+                    discard;
+
+                if (useTileset)
+                {
+                    vec2 atlasTile = floor(index.ba * 255.0 + 0.5);
+                    gl_FragColor = texture2D(tileset, (atlasTile + local / tileSize) * atlasTileScale) * gl_Color;
+                    return;
+                }
+
+                vec4 color = fillColors[type];
+                float edge = min(min(local.x - gap, local.y - gap), min(tileSize - local.x, tileSize - local.y));
+                if (edge < outlineThickness)
+                    color = outlineColors[type];
+                gl_FragColor = color * gl_Color;
+            }
+        )";
+        return source;
+    }
+
+    bool ensureShader() const
+    {
+        if (m_shaderLoaded) return true;
+        if (m_shaderFailed || !isAvailable()) return false;
+
+        // 페이지 텍스처를 만들 수 없는 GPU면 기존 방식으로 그림
+        unsigned int largestPage = std::min(m_pageSize, std::max(m_width, m_height));
+        if (largestPage > sf::Texture::getMaximumSize())
+        {
+            m_shaderFailed = true;
+            return false;
+        }
+        if (!m_shader.loadFromMemory(fragmentSource(), sf::Shader::Type::Fragment))
+        {
+            m_shaderFailed = true;
+            return false;
+        }
+        m_shaderLoaded = true;
+        return true;
+    }
+
+    // 페이지의 [x0, x1) x [y0, y1) 영역을 소스에서 읽어 올림 (버퍼가 커지지 않도록 줄 묶음 단위로)
+    void uploadRect(Page& page, unsigned int x0, unsigned int y0, unsigned int x1, unsigned int y1) const
+    {
+        unsigned int w = x1 - x0;
+        unsigned int band = static_cast<unsigned int>(std::max<std::size_t>(1, UPLOAD_BAND_TEXELS / w));
+        for (unsigned int top = y0; top < y1; top += band)
+        {
+            unsigned int h = std::min(band, y1 - top);
+            m_uploadBuffer.resize(static_cast<std::size_t>(w) * h * 4u);
+            for (unsigned int y = 0; y < h; ++y)
+            {
+                m_source(static_cast<int>(page.origin.y + top + y), static_cast<int>(page.origin.x + x0),
+                         static_cast<int>(page.origin.x + x1), &m_uploadBuffer[static_cast<std::size_t>(y) * w * 4u]);
+            }
+            page.texture.update(m_uploadBuffer.data(), {w, h}, {x0, top});
+        }
+    }
+
+    // 바뀐 영역을 올리고 채우지 않은 줄을 예산만큼 채움
+    void updatePage(Page& page, std::size_t& budget) const
+    {
+        if (page.filledRows == 0 && page.texture.getSize() != page.size)
+        {
+            if (!page.texture.resize(page.size)) return;
+            page.texture.setSmooth(false);
+        }
+        if (page.dirty)
+        {
+            unsigned int y1 = std::min(page.dirtyMaxY, page.filledRows);
+            if (page.dirtyMinY < y1)
+            {
+                uploadRect(page, page.dirtyMinX, page.dirtyMinY, page.dirtyMaxX, y1);
+            }
+            page.dirty = false;
+        }
+        if (page.filledRows < page.size.y && budget > 0)
+        {
+            unsigned int rows = static_cast<unsigned int>(std::max<std::size_t>(1, budget / page.size.x));
+            rows = std::min(rows, page.size.y - page.filledRows);
+            uploadRect(page, 0, page.filledRows, page.size.x, page.filledRows + rows);
+            page.filledRows += rows;
+            budget -= std::min(budget, static_cast<std::size_t>(rows) * page.size.x);
+        }
+    }
+
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        m_lastDrawCalls = 0;
+        if (m_pages.empty() || !m_source || !ensureShader()) return;
+
+        // 뷰의 월드 영역 (회전은 고려하지 않음)
+        const sf::View& view = target.getView();
+        sf::Vector2f viewMin = view.getCenter() - view.getSize() / 2.f;
+        sf::Vector2f viewMax = view.getCenter() + view.getSize() / 2.f;
+
+        m_shader.setUniform("tileSize", m_tileSize);
+        m_shader.setUniform("outlineThickness", m_outlineThickness);
+        m_shader.setUniform("gap", m_gap);
+        std::array<sf::Glsl::Vec4, MAX_TILE_TYPES> fills = {
+            sf::Glsl::Vec4(m_fillColors[0]), sf::Glsl::Vec4(m_fillColors[1]),
+            sf::Glsl::Vec4(m_fillColors[2]), sf::Glsl::Vec4(m_fillColors[3])
+        };
+        std::array<sf::Glsl::Vec4, MAX_TILE_TYPES> outlines = {
+            sf::Glsl::Vec4(m_outlineColors[0]), sf::Glsl::Vec4(m_outlineColors[1]),
+            sf::Glsl::Vec4(m_outlineColors[2]), sf::Glsl::Vec4(m_outlineColors[3])
+        };
+        m_shader.setUniformArray("fillColors", fills.data(), fills.size());
+        m_shader.setUniformArray("outlineColors", outlines.data(), outlines.size());
+        m_shader.setUniform("useTileset", m_tileset != nullptr);
+        m_shader.setUniform("lod", m_lod);
+        if (m_tileset)
+        {
+            sf::Vector2u atlasSize = m_tileset->getSize();
+            m_shader.setUniform("tileset", *m_tileset);
+            m_shader.setUniform("atlasTileScale", sf::Glsl::Vec2(
+                static_cast<float>(m_atlasTileSize.x) / atlasSize.x,
+                static_cast<float>(m_atlasTileSize.y) / atlasSize.y));
+        }
+
+        std::size_t budget = m_uploadBudget;
+        for (Page& page : m_pages)
+        {
+            // 페이지의 월드 영역과 뷰의 교집합만 그림
+            float left = std::max(viewMin.x, page.origin.x * m_tileSize);
+            float top = std::max(viewMin.y, page.origin.y * m_tileSize);
+            float right = std::min(viewMax.x, (page.origin.x + page.size.x) * m_tileSize);
+            float bottom = std::min(viewMax.y, (page.origin.y + page.size.y) * m_tileSize);
+            if (left >= right || top >= bottom) continue;
+
+            updatePage(page, budget);
+            if (page.filledRows == 0) continue;
+
+            // 아직 채우는 중이면 채운 줄까지만
+            bottom = std::min(bottom, (page.origin.y + page.filledRows) * m_tileSize);
+            if (top >= bottom) continue;
+
+            m_shader.setUniform("indexTexture", page.texture);
+            m_shader.setUniform("pageOrigin", sf::Glsl::Vec2(sf::Vector2f(page.origin)));
+            m_shader.setUniform("pageSize", sf::Glsl::Vec2(sf::Vector2f(page.size)));
+
+            // texCoords에 월드 좌표를 넣어서 셰이더가 타일을 찾게 함
+            sf::Vertex quad[4] = {
+                {{left, top}, sf::Color::White, {left, top}},
+                {{right, top}, sf::Color::White, {right, top}},
+                {{left, bottom}, sf::Color::White, {left, bottom}},
+                {{right, bottom}, sf::Color::White, {right, bottom}}
+            };
+
+            sf::RenderStates quadStates = states;
+            quadStates.texture = nullptr;
+            quadStates.shader = &m_shader;
+            target.draw(quad, 4, sf::PrimitiveType::TriangleStrip, quadStates);
+            RenderStats::current().recordDraw(4, &page.texture, &m_shader);
+            ++m_lastDrawCalls;
+        }
+    }
+
+    float m_tileSize;
+    unsigned int m_width = 0;
+    unsigned int m_height = 0;
+    unsigned int m_pageSize = MAX_PAGE_SIZE;
+    unsigned int m_pageColumns = 0;
+    unsigned int m_pageRows = 0;
+    RowSource m_source;
+    std::size_t m_uploadBudget = DEFAULT_UPLOAD_BUDGET;
+    mutable std::vector<Page> m_pages;
+    mutable std::vector<std::uint8_t> m_uploadBuffer;
+
+    std::array<sf::Color, MAX_TILE_TYPES> m_fillColors;
+    std::array<sf::Color, MAX_TILE_TYPES> m_outlineColors;
+    float m_outlineThickness = 0.f;
+    float m_gap = 0.f;
+    bool m_lod = false;
+    const sf::Texture* m_tileset = nullptr;
+    sf::Vector2u m_atlasTileSize;
+
+    mutable sf::Shader m_shader;
+    mutable bool m_shaderLoaded = false;
+    mutable bool m_shaderFailed = false;
+    mutable std::size_t m_lastDrawCalls = 0;
+};
@@ -1,10 +1,16 @@
 #pragma once
 
 #include <SFML/Graphics.hpp>
+#include "TileIndexRenderer.hpp"
+#include "Minimap.hpp"
+#include "BoundedReader.hpp"
+#include "RenderStats.hpp"
 #include <vector>
 #include <string>
 #include <fstream>
 #include <cstdint>
+#include <algorithm>
+#include <cmath>
 
 class TileMap : public sf::Drawable
 {
@@ -16,7 +22,7 @@ public:
     static constexpr uint16_t FILE_VERSION = 2;  // Version 2: CollisionShape 추가
     static constexpr uint16_t FILE_VERSION_1 = 1;  // 이전 버전 호환용
 
-    enum class TileType
+    enum class TileType : uint8_t
     {
         Empty = 0,
         Solid = 1,
@@ -47,10 +53,18 @@ public:
     TileMap(int width, int height)
         : m_width(width)
         , m_height(height)
+        , m_renderer(static_cast<float>(TILE_SIZE))
     {
         m_tiles.resize(width * height);
+        m_minimap.setSource([this](const sf::IntRect& rect) { return countTiles(rect); });
+        m_renderer.setSource([this](int y, int x0, int x1, std::uint8_t* out) { fillRendererRow(y, x0, x1, out); });
+        initRenderer();
     }
 
+    // 미니맵/렌더러 소스가 this를 잡고 있으므로 복사하지 않음
+    TileMap(const TileMap&) = delete;
+    TileMap& operator=(const TileMap&) = delete;
+
     void setTile(int x, int y, TileType type)
     {
         if (x >= 0 && x < m_width && y >= 0 && y < m_height)
@@ -64,6 +78,8 @@ public:
             } else {
                 m_tiles[y * m_width + x].shape = CollisionShape::Full;
             }
+            syncRendererTile(x, y);
+            m_minimap.markTileDirty(x, y);
         }
     }
 
@@ -72,6 +88,7 @@ public:
         if (x >= 0 && x < m_width && y >= 0 && y < m_height)
         {
             m_tiles[y * m_width + x].shape = shape;
+            syncRendererTile(x, y);
         }
     }
 
@@ -169,14 +186,19 @@ public:
     int getTileSize() const { return TILE_SIZE; }
 
     // 스폰 위치 설정/가져오기
-    void setPlayerSpawn(int x, int y) { m_playerSpawnX = x; m_playerSpawnY = y; }
+    void setPlayerSpawn(int x, int y) { m_playerSpawnX = x; m_playerSpawnY = y; syncMinimapMarkers(); }
     sf::Vector2i getPlayerSpawn() const { return {m_playerSpawnX, m_playerSpawnY}; }
 
     void addEnemySpawn(int x, int y, uint8_t type = 0) {
         m_enemySpawns.push_back({x, y, type});
+        syncMinimapMarkers();
     }
     const std::vector<std::tuple<int, int, uint8_t>>& getEnemySpawns() const { return m_enemySpawns; }
-    void clearEnemySpawns() { m_enemySpawns.clear(); }
+    void clearEnemySpawns() { m_enemySpawns.clear(); syncMinimapMarkers(); }
+
+    // 미니맵 (setTile로 바뀐 블록만 다시 셈, 위치는 setBounds로 지정)
+    Minimap& getMinimap() { return m_minimap; }
+    const Minimap& getMinimap() const { return m_minimap; }
 
     // 바이너리 파일 저장
     bool saveToFile(const std::string& filename) const {
@@ -211,6 +233,8 @@ public:
             file.write(reinterpret_cast<const char*>(&tx), sizeof(tx));
             file.write(reinterpret_cast<const char*>(&ty), sizeof(ty));
             file.write(reinterpret_cast<const char*>(&tt), sizeof(tt));
+            uint8_t ts = static_cast<uint8_t>(getTileShape(tx, ty));
+            file.write(reinterpret_cast<const char*>(&ts), sizeof(ts));
         }
 
         // Player Spawn
@@ -233,51 +257,59 @@ public:
         return true;
     }
 
-    // 바이너리 파일 로드
-    bool loadFromFile(const std::string& filename) {
-        std::ifstream file(filename, std::ios::binary);
-        if (!file.is_open()) return false;
+    // 파일에서 읽은 내용 (스폰은 게임 픽셀 좌표로 변환된 상태)
+    struct FileContents
+    {
+        int width = 0;
+        int height = 0;
+        std::vector<TileData> tiles;
+        int playerSpawnX = -1;
+        int playerSpawnY = -1;
+        std::vector<std::tuple<int, int, uint8_t>> enemySpawns;
+    };
+
+    static constexpr uint32_t MAX_FILE_MAP_SIZE = 65536;  // 타일 좌표가 uint16_t
+
+    // 렌더러/GPU 없이 파일 내용만 읽음 (잘린 파일, 개수가 파일 크기나 메모리 상한을 넘으면 false)
+    static bool readFile(std::istream& stream, FileContents& contents, const LoadLimits& limits = {}) {
+        BoundedReader in(stream, limits);
 
         // Header
         char magic[4];
-        file.read(magic, 4);
-        if (magic[0] != FILE_MAGIC[0] || magic[1] != FILE_MAGIC[1] ||
-            magic[2] != FILE_MAGIC[2] || magic[3] != FILE_MAGIC[3]) {
-            return false;
-        }
+        if (!in.readBytes(magic, 4) || !std::equal(magic, magic + 4, FILE_MAGIC)) return false;
 
         uint16_t version;
-        file.read(reinterpret_cast<char*>(&version), sizeof(version));
-        if (version != FILE_VERSION && version != FILE_VERSION_1) return false;
+        if (!in.read(version) || (version != FILE_VERSION && version != FILE_VERSION_1)) return false;
 
         uint16_t gridSize;
-        file.read(reinterpret_cast<char*>(&gridSize), sizeof(gridSize));
         // gridSize는 현재 TILE_SIZE와 같아야 함 (다르면 스케일링 필요)
-
         uint32_t width, height;
-        file.read(reinterpret_cast<char*>(&width), sizeof(width));
-        file.read(reinterpret_cast<char*>(&height), sizeof(height));
+        if (!in.read(gridSize) || !in.read(width) || !in.read(height)) return false;
+        if (width == 0 || height == 0 || width > MAX_FILE_MAP_SIZE || height > MAX_FILE_MAP_SIZE) return false;
 
-        // 맵 크기 재설정
-        m_width = static_cast<int>(width);
-        m_height = static_cast<int>(height);
-        m_tiles.clear();
-        m_tiles.resize(m_width * m_height);
+        // 격자는 빈 칸까지 들고 있으므로 파일 크기가 아니라 메모리 상한으로만 확인
+        if (!in.charge(static_cast<uint64_t>(width) * height, sizeof(TileData))) return false;
+        FileContents result;
+        result.width = static_cast<int>(width);
+        result.height = static_cast<int>(height);
+        result.tiles.resize(static_cast<size_t>(width) * height);
 
         // Tiles
         uint32_t tileCount;
-        file.read(reinterpret_cast<char*>(&tileCount), sizeof(tileCount));
+        if (!in.read(tileCount)) return false;
+        const size_t tileRecordSize = version == FILE_VERSION ? 6 : 5;
+        if (!in.reserve(tileCount, tileRecordSize, 0)) return false;
         for (uint32_t i = 0; i < tileCount; ++i) {
             uint16_t tx, ty;
             uint8_t tt;
-            file.read(reinterpret_cast<char*>(&tx), sizeof(tx));
-            file.read(reinterpret_cast<char*>(&ty), sizeof(ty));
-            file.read(reinterpret_cast<char*>(&tt), sizeof(tt));
+            in.read(tx);
+            in.read(ty);
+            in.read(tt);
 
             // Version 2: CollisionShape 읽기
             uint8_t ts = static_cast<uint8_t>(CollisionShape::Full);
             if (version == FILE_VERSION) {
-                file.read(reinterpret_cast<char*>(&ts), sizeof(ts));
+                in.read(ts);
             } else {
                 // Version 1: 타입에 따라 기본 CollisionShape 설정
                 if (static_cast<TileType>(tt) == TileType::Platform) {
@@ -285,35 +317,71 @@ public:
                 }
             }
 
-            if (tx < static_cast<uint16_t>(m_width) && ty < static_cast<uint16_t>(m_height)) {
+            if (tx < width && ty < height) {
                 // Y좌표 그대로 사용
-                m_tiles[ty * m_width + tx].type = static_cast<TileType>(tt);
-                m_tiles[ty * m_width + tx].shape = static_cast<CollisionShape>(ts);
+                result.tiles[ty * width + tx].type = static_cast<TileType>(tt);
+                result.tiles[ty * width + tx].shape = static_cast<CollisionShape>(ts);
             }
         }
 
         // Player Spawn (타일 좌표로 저장되어 있음 - 픽셀 좌표로 변환)
         int32_t spawnX, spawnY;
-        file.read(reinterpret_cast<char*>(&spawnX), sizeof(spawnX));
-        file.read(reinterpret_cast<char*>(&spawnY), sizeof(spawnY));
+        if (!in.read(spawnX) || !in.read(spawnY)) return false;
         // 타일 좌표를 픽셀 좌표로 변환 (Y 뒤집기: 에디터 하단 = 게임 하단)
-        m_playerSpawnX = spawnX * TILE_SIZE;
-        m_playerSpawnY = (m_height - 1 - spawnY) * TILE_SIZE;
+        // 맵 밖 좌표는 int 넘침 없이 버림 (스폰 없음)
+        auto toPixels = [&](int32_t tileX, int32_t tileY, int& pixelX, int& pixelY) {
+            if (tileX < 0 || tileY < 0 || static_cast<uint32_t>(tileX) >= width || static_cast<uint32_t>(tileY) >= height) {
+                return false;
+            }
+            pixelX = tileX * TILE_SIZE;
+            pixelY = (result.height - 1 - tileY) * TILE_SIZE;
+            return true;
+        };
+        if (!toPixels(spawnX, spawnY, result.playerSpawnX, result.playerSpawnY)) {
+            result.playerSpawnX = -1;
+            result.playerSpawnY = -1;
+        }
 
         // Enemy Spawns
-        m_enemySpawns.clear();
         uint32_t enemyCount;
-        file.read(reinterpret_cast<char*>(&enemyCount), sizeof(enemyCount));
+        if (!in.read(enemyCount)) return false;
+        constexpr size_t ENEMY_RECORD_SIZE = sizeof(int32_t) * 2 + sizeof(uint8_t);
+        if (!in.reserve(enemyCount, ENEMY_RECORD_SIZE, sizeof(std::tuple<int, int, uint8_t>))) return false;
+        result.enemySpawns.reserve(enemyCount);
         for (uint32_t i = 0; i < enemyCount; ++i) {
             int32_t ex, ey;
             uint8_t et;
-            file.read(reinterpret_cast<char*>(&ex), sizeof(ex));
-            file.read(reinterpret_cast<char*>(&ey), sizeof(ey));
-            file.read(reinterpret_cast<char*>(&et), sizeof(et));
-            // 타일 좌표를 픽셀 좌표로 변환 (Y 뒤집기)
-            m_enemySpawns.push_back({ex * TILE_SIZE, (m_height - 1 - ey) * TILE_SIZE, et});
+            in.read(ex);
+            in.read(ey);
+            in.read(et);
+            int pixelX, pixelY;
+            if (toPixels(ex, ey, pixelX, pixelY)) {
+                result.enemySpawns.push_back({pixelX, pixelY, et});
+            }
         }
+        if (in.failed()) return false;
 
+        contents = std::move(result);
+        return true;
+    }
+
+    // 바이너리 파일 로드 (실패하면 현재 맵은 그대로)
+    bool loadFromFile(const std::string& filename, const LoadLimits& limits = {}) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) return false;
+
+        FileContents contents;
+        if (!readFile(file, contents, limits)) return false;
+
+        m_width = contents.width;
+        m_height = contents.height;
+        m_tiles = std::move(contents.tiles);
+        m_playerSpawnX = contents.playerSpawnX;
+        m_playerSpawnY = contents.playerSpawnY;
+        m_enemySpawns = std::move(contents.enemySpawns);
+
+        initRenderer();
+        syncMinimapMarkers();
         return true;
     }
 
@@ -363,14 +431,95 @@ public:
     }
 
 private:
+    // 인덱스 텍스처 렌더러 초기화 (페이지는 처음 그릴 때 m_tiles에서 채움)
+    void initRenderer()
+    {
+        m_renderer.resize(static_cast<unsigned int>(m_width), static_cast<unsigned int>(m_height));
+        m_renderer.setTileColors(static_cast<uint8_t>(TileType::Solid), sf::Color{80, 60, 40}, sf::Color{100, 80, 60});
+        m_renderer.setTileColors(static_cast<uint8_t>(TileType::Platform), sf::Color{60, 100, 60}, sf::Color{80, 120, 80});
+        m_renderer.setOutlineThickness(1.f);
+        m_minimap.resize(static_cast<unsigned int>(m_width), static_cast<unsigned int>(m_height));
+    }
+
+    // 미니맵 블록의 타일 수 (타입별)
+    Minimap::Occupancy countTiles(const sf::IntRect& rect) const
+    {
+        Minimap::Occupancy occupancy;
+        for (int y = rect.position.y; y < rect.position.y + rect.size.y; ++y)
+        {
+            const TileData* row = &m_tiles[y * m_width];
+            for (int x = rect.position.x; x < rect.position.x + rect.size.x; ++x)
+            {
+                occupancy.solid += row[x].type == TileType::Solid;
+                occupancy.platform += row[x].type == TileType::Platform;
+            }
+        }
+        return occupancy;
+    }
+
+    // 스폰 위치(픽셀)를 미니맵 마커로 (플레이어 스폰은 노란색, 적 스폰은 주황색)
+    void syncMinimapMarkers()
+    {
+        std::vector<Minimap::Marker> markers;
+        markers.reserve(m_enemySpawns.size() + 1);
+        auto toTile = [](int px, int py) {
+            return sf::Vector2f{static_cast<float>(px) / TILE_SIZE + 0.5f, static_cast<float>(py) / TILE_SIZE + 0.5f};
+        };
+        for (const auto& [ex, ey, et] : m_enemySpawns)
+        {
+            markers.push_back({toTile(ex, ey), sf::Color{255, 150, 40}});
+        }
+        if (m_playerSpawnX >= 0 && m_playerSpawnY >= 0)
+        {
+            markers.push_back({toTile(m_playerSpawnX, m_playerSpawnY), sf::Color{255, 230, 60}});
+        }
+        m_minimap.setMarkers(std::move(markers));
+    }
+
+    void syncRendererTile(int x, int y)
+    {
+        m_renderer.markDirty({{x, y}, {1, 1}});
+    }
+
+    // 렌더러 업로드용 인덱스 텍셀 (type, shape, 타일셋 x, 타일셋 y)
+    void fillRendererRow(int y, int x0, int x1, std::uint8_t* out) const
+    {
+        const TileData* row = &m_tiles[static_cast<std::size_t>(y) * m_width];
+        for (int x = x0; x < x1; ++x, out += 4)
+        {
+            // 파일에서 읽은 모르는 타입은 빈 칸으로 올림
+            bool known = static_cast<int>(row[x].type) < TileIndexRenderer::MAX_TILE_TYPES;
+            out[0] = known ? static_cast<std::uint8_t>(row[x].type) : 0;
+            out[1] = known ? static_cast<std::uint8_t>(row[x].shape) : 0;
+            out[2] = 0;
+            out[3] = 0;
+        }
+    }
+
     void draw(sf::RenderTarget& target, sf::RenderStates states) const override
     {
+        // 셰이더를 쓸 수 있으면 보이는 영역을 사각형 하나로 그림
+        if (m_renderer.canRender())
+        {
+            target.draw(m_renderer, states);
+            return;
+        }
+
+        // 셰이더를 쓸 수 없으면 보이는 타일만 하나씩 그림
+        const sf::View& view = target.getView();
+        sf::Vector2f viewMin = view.getCenter() - view.getSize() / 2.f;
+        sf::Vector2f viewMax = view.getCenter() + view.getSize() / 2.f;
+        int startX = std::max(0, static_cast<int>(std::floor(viewMin.x / TILE_SIZE)) - 1);
+        int startY = std::max(0, static_cast<int>(std::floor(viewMin.y / TILE_SIZE)) - 1);
+        int endX = std::min(m_width, static_cast<int>(std::ceil(viewMax.x / TILE_SIZE)) + 1);
+        int endY = std::min(m_height, static_cast<int>(std::ceil(viewMax.y / TILE_SIZE)) + 1);
+
         sf::RectangleShape tileShape;
         tileShape.setSize({static_cast<float>(TILE_SIZE), static_cast<float>(TILE_SIZE)});
 
-        for (int y = 0; y < m_height; ++y)
+        for (int y = startY; y < endY; ++y)
         {
-            for (int x = 0; x < m_width; ++x)
+            for (int x = startX; x < endX; ++x)
             {
                 TileType type = getTile(x, y);
                 if (type == TileType::Empty)
@@ -392,7 +541,7 @@ private:
                     tileShape.setOutlineColor(sf::Color{80, 120, 80});
                 }
 
-                target.draw(tileShape, states);
+                RenderStats::draw(target, tileShape, states);
             }
         }
     }
@@ -400,6 +549,8 @@ private:
     int m_width;
     int m_height;
     std::vector<TileData> m_tiles;
+    TileIndexRenderer m_renderer;  // 인덱스 텍스처 + 셰이더 렌더러 (업로드할 때 m_tiles에서 읽음)
+    Minimap m_minimap;             // 블록별 점유율 축소판 (setTile로 바뀐 블록만 다시 셈)
     int m_playerSpawnX = -1;
     int m_playerSpawnY = -1;
     std::vector<std::tuple<int, int, uint8_t>> m_enemySpawns;
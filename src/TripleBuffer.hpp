@@ -0,0 +1,44 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// 생산자 1개 / 소비자 1개용 락 없는 트리플 버퍼
+// 생산자는 항상 자기 버퍼(back)에 쓰고 publish()로 가운데 버퍼와 교환하고,
+// 소비자는 새 데이터가 있을 때만 acquire()로 가운데 버퍼와 자기 버퍼(front)를 교환함
+// 어느 쪽도 상대방을 기다리지 않음 (소비자가 느리면 중간 프레임은 덮어써짐)
+template<typename T>
+class TripleBuffer
+{
+public:
+    // 생산자 쪽: 다음에 채울 버퍼
+    T& back() { return m_buffers[m_backIndex]; }
+
+    // 생산자 쪽: back 버퍼를 발행
+    void publish()
+    {
+        std::uint8_t previous = m_middle.exchange(static_cast<std::uint8_t>(m_backIndex | FRESH_BIT), std::memory_order_acq_rel);
+        m_backIndex = previous & INDEX_MASK;
+    }
+
+    // 소비자 쪽: 새로 발행된 버퍼가 있으면 front로 가져옴 (가져왔으면 true)
+    bool acquire()
+    {
+        if ((m_middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) return false;
+        std::uint8_t previous = m_middle.exchange(m_frontIndex, std::memory_order_acq_rel);
+        m_frontIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    // 소비자 쪽: 마지막으로 가져온 버퍼
+    const T& front() const { return m_buffers[m_frontIndex]; }
+
+private:
+    static constexpr std::uint8_t FRESH_BIT = 0x4;
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+
+    T m_buffers[3];
+    std::uint8_t m_backIndex = 0;                 // 생산자 전용
+    std::uint8_t m_frontIndex = 1;                // 소비자 전용
+    std::atomic<std::uint8_t> m_middle{2};        // 공유 (인덱스 + 새 데이터 표시)
+};
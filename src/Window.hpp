@@ -170,8 +170,9 @@ public:
     void setTitleBarColor(const sf::Color& color) { m_titleBarColor = color; m_titleBar.setFillColor(color); }
     void setBodyColor(const sf::Color& color) { m_bodyColor = color; m_body.setFillColor(color); }
 
-private:
-    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    // RenderTarget 또는 DrawList(렌더 스냅샷)에 그림
+    template<typename Target>
+    void render(Target& target, sf::RenderStates states) const
     {
         if (!m_isVisible) return;
 
@@ -182,6 +183,12 @@ private:
         target.draw(m_closeText, states);
     }
 
+private:
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+    {
+        render(target, states);
+    }
+
     void updateCloseButtonPosition()
     {
         sf::Vector2f titlePos = m_titleBar.getPosition();
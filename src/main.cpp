@@ -2,82 +2,186 @@
 #include "ButtonManager.hpp"
 #include "InventoryWindow.hpp"
 #include "EquipmentWindow.hpp"
-#include "Player.hpp"
-#include "Enemy.hpp"
+#include "GameSimulation.hpp"
+#include "InputRecording.hpp"
+#include "InputState.hpp"
+#include "ActionMap.hpp"
 #include "TileMap.hpp"
-#include <iostream>
+#include "ParallaxBackground.hpp"
+#include "SpriteBatch.hpp"
+#include "RenderThread.hpp"
+#include "DynamicResolution.hpp"
+#include "Profiler.hpp"
+#include "ProfilerOverlay.hpp"
+#include "RenderStats.hpp"
+#include "Log.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
 #include <vector>
 
-int main()
+namespace
 {
-    auto renderWindow = sf::RenderWindow(sf::VideoMode({1280u, 720u}), "CMake SFML Project");
-    renderWindow.setFramerateLimit(144);
-    renderWindow.requestFocus();  // 창 생성 후 포커스 요청
+// 명령줄 옵션
+//   --record <파일>   플레이 입력을 기록해서 종료할 때 저장
+//   --replay <파일>   기록된 입력으로 재생 (키보드 입력 무시)
+//   --fast            재생할 때 기록된 deltaTime만큼 기다리지 않음
+//   --headless        창 없이 재생만 하고 상태 해시 결과를 종료 코드로 반환
+struct LaunchOptions
+{
+    std::string recordPath;
+    std::string replayPath;
+    bool fast = false;
+    bool headless = false;
+};
 
-    // 타일맵 생성 및 로드
+bool parseOptions(int argc, char** argv, LaunchOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "--record" && hasValue) options.recordPath = argv[++i];
+        else if (arg == "--replay" && hasValue) options.replayPath = argv[++i];
+        else if (arg == "--fast") options.fast = true;
+        else if (arg == "--headless") options.headless = true;
+        else
+        {
+            LOG_ERROR("Unknown or incomplete argument: {}", arg);
+            return false;
+        }
+    }
+    if (options.headless && options.replayPath.empty())
+    {
+        LOG_ERROR("--headless requires --replay <file>");
+        return false;
+    }
+    return true;
+}
+
+// 재생이 끝난 시뮬레이션 상태를 기록 종료 시점 해시와 비교
+bool checkReplayResult(const GameSimulation& simulation, const InputRecording& replay)
+{
+    std::uint64_t stateHash = simulation.computeStateHash();
+    if (stateHash != replay.getFinalStateHash())
+    {
+        LOG_ERROR("Replay diverged after {} ticks: state hash {}, recorded {}", simulation.getTick(), stateHash,
+                  replay.getFinalStateHash());
+        return false;
+    }
+    LOG_INFO("Replay matched recording after {} ticks (state hash {})", simulation.getTick(), stateHash);
+    return true;
+}
+
+// 창 없이 기록을 끝까지 재생 (기본은 기록된 속도, --fast면 최대 속도)
+int runHeadlessReplay(const TileMap& tileMap, const InputRecording& replay, const sf::Vector2f& viewSize, bool fast)
+{
+    GameSimulation simulation(tileMap, replay.getSeed(), viewSize);
+
+    auto start = std::chrono::steady_clock::now();
+    auto nextTick = start;
+    for (const InputRecording::Frame& frame : replay.getFrames())
+    {
+        simulation.step(frame.input, frame.deltaTime);
+        if (!fast)
+        {
+            nextTick += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                std::chrono::duration<float>(frame.deltaTime));
+            std::this_thread::sleep_until(nextTick);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG_INFO("Headless replay: {} ticks in {} s ({} ticks/s)", simulation.getTick(), seconds,
+             seconds > 0.0 ? simulation.getTick() / seconds : 0.0);
+
+    bool matched = checkReplayResult(simulation, replay);
+    Log::instance().flush();
+    return matched ? 0 : 1;
+}
+}
+
+int main(int argc, char** argv)
+{
+    PROFILE_THREAD("Main");
+
+    LaunchOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return -1;
+    }
+
+    // 타일맵 생성 및 로드 (헤드리스 재생도 쓰므로 창보다 먼저)
     TileMap tileMap(60, 33);
     if (!tileMap.loadFromFile("test3.tilemap")) {
-        std::cout << "test.tilemap not found, creating simple level..." << std::endl;
+        LOG_INFO("test.tilemap not found, creating simple level...");
         tileMap.createSimpleLevel();
     } else {
-        std::cout << "Loaded test.tilemap successfully!" << std::endl;
+        LOG_INFO("Loaded test.tilemap successfully!");
     }
 
-    // 플레이어 생성 (타일맵의 spawn 위치 사용)
-    sf::Vector2i playerSpawn = tileMap.getPlayerSpawn();
-    sf::Vector2f playerStartPos;
-    if (playerSpawn.x >= 0 && playerSpawn.y >= 0) {
-        // spawn 위치가 설정되어 있으면 사용 (픽셀 좌표 - 그대로 사용)
-        playerStartPos = sf::Vector2f(static_cast<float>(playerSpawn.x), static_cast<float>(playerSpawn.y));
-        std::cout << "Player spawn from tilemap: (" << playerSpawn.x << ", " << playerSpawn.y << ")" << std::endl;
-    } else {
-        // 설정되지 않았으면 기본값 사용
-        playerStartPos = {100.f, 100.f};
-        std::cout << "Player spawn not set, using default position" << std::endl;
-    }
-    Player player(playerStartPos);
-    std::cout << "Player position: (" << playerStartPos.x << ", " << playerStartPos.y << ")" << std::endl;
-    std::cout << "Map size: " << tileMap.getWidth() * TileMap::TILE_SIZE << " x " << tileMap.getHeight() * TileMap::TILE_SIZE << std::endl;
+    const sf::Vector2f viewSize{1280.f, 720.f};
 
-    // 장비 변경 추적용
-    OptionalItem lastEquippedWeapon;
+    // 입력 재생: 기록할 때의 시드로 시작하고 기록된 입력과 deltaTime만 사용
+    InputRecording replay;
+    const bool replaying = !options.replayPath.empty();
+    if (replaying)
+    {
+        if (!replay.loadFromFile(options.replayPath))
+        {
+            LOG_ERROR("Failed to load replay {}", options.replayPath);
+            return -1;
+        }
+        if (replay.getMapHash() != GameSimulation::computeMapHash(tileMap))
+        {
+            LOG_WARN("Replay was recorded on a different tilemap, result will not match");
+        }
+        LOG_INFO("Replaying {} ({} ticks)", options.replayPath, replay.getFrames().size());
 
-    // 적 생성 (타일맵의 enemy spawn 위치 사용)
-    std::vector<Enemy> enemies;
-    const auto& enemySpawns = tileMap.getEnemySpawns();
-    if (!enemySpawns.empty()) {
-        for (const auto& spawn : enemySpawns) {
-            float x = static_cast<float>(std::get<0>(spawn));
-            float y = static_cast<float>(std::get<1>(spawn));
-            enemies.emplace_back(sf::Vector2f{x, y});
-            std::cout << "Enemy spawn from tilemap: (" << x << ", " << y << ")" << std::endl;
+        if (options.headless)
+        {
+            return runHeadlessReplay(tileMap, replay, viewSize, options.fast);
         }
-    } else {
-        // enemy spawn이 없으면 기본 적 생성
-        std::cout << "No enemy spawns in tilemap, creating default enemies" << std::endl;
-        enemies.emplace_back(sf::Vector2f{400.f, 100.f});
-        enemies.emplace_back(sf::Vector2f{700.f, 100.f});
-        enemies.emplace_back(sf::Vector2f{1000.f, 100.f});
     }
 
+    // 입력 기록
+    InputRecording recording;
+    const bool recordingInput = !replaying && !options.recordPath.empty();
+    std::uint32_t seed = replaying ? replay.getSeed() : std::random_device{}();
+    if (recordingInput)
+    {
+        recording.setSeed(seed);
+        recording.setMapHash(GameSimulation::computeMapHash(tileMap));
+        LOG_INFO("Recording input to {}", options.recordPath);
+    }
+
+    auto renderWindow = sf::RenderWindow(sf::VideoMode({1280u, 720u}), "CMake SFML Project");
+    // 프레임 제한은 렌더 스레드가 display() 밖에서 함 (동적 해상도가 display 시간을 재므로)
+    renderWindow.requestFocus();  // 창 생성 후 포커스 요청
+
+    // 게임 월드 (플레이어, 적, 카메라)
+    GameSimulation simulation(tileMap, seed, viewSize);
+    std::size_t replayFrame = 0;
+
+    // 장비 변경 추적용
+    OptionalItem lastEquippedWeapon;
+
     // 델타 타임 계산용 클럭
     sf::Clock clock;
 
-    // 카메라 (게임 월드용) - 플레이어 위치를 중심으로 초기화
-    sf::View gameView(sf::FloatRect({0.f, 0.f}, {1280.f, 720.f}));
-    // 초기 카메라를 플레이어 중심으로 설정
-    sf::Vector2f initialCameraCenter = playerStartPos + sf::Vector2f(Player::WIDTH / 2.f, Player::HEIGHT / 2.f);
-    gameView.setCenter(initialCameraCenter);
-    std::cout << "Initial camera center: (" << initialCameraCenter.x << ", " << initialCameraCenter.y << ")" << std::endl;
-
     // UI용 뷰 (고정)
-    sf::View uiView(sf::FloatRect({0.f, 0.f}, {1280.f, 720.f}));
+    sf::View uiView(sf::FloatRect({0.f, 0.f}, viewSize));
+
+    // 미니맵 (UI 오른쪽 위, 맵 비율에 맞춰 이 영역 안에 그림)
+    tileMap.getMinimap().setBounds({{viewSize.x - 210.f, 10.f}, {200.f, 120.f}});
 
     // 폰트 로드
     sf::Font font;
     if (!font.openFromFile("/System/Library/Fonts/Supplemental/Arial.ttf"))
     {
-        std::cerr << "Failed to load font!" << std::endl;
+        LOG_ERROR("Failed to load font!");
         return -1;
     }
 
@@ -85,34 +189,33 @@ int main()
     sf::Texture itemsTexture;
     if (!itemsTexture.loadFromFile("items.png"))
     {
-        std::cerr << "Failed to load items.png!" << std::endl;
+        LOG_ERROR("Failed to load items.png!");
         return -1;
     }
 
     sf::Texture weaponsTexture;
     if (!weaponsTexture.loadFromFile("weapons.png"))
     {
-        std::cerr << "Failed to load weapons.png!" << std::endl;
+        LOG_ERROR("Failed to load weapons.png!");
         return -1;
     }
 
-    // 배경 텍스처 로드
-    sf::Texture backgroundTexture;
-    if (!backgroundTexture.loadFromFile("mountain.png"))
-    {
-        std::cerr << "Failed to load mountain.png!" << std::endl;
-        return -1;
-    }
-    sf::Sprite backgroundSprite(backgroundTexture);
+    // 배경 로드 (큰 이미지를 타일로 잘라서 뷰에 보이는 타일만 그림)
     // 타일맵 크기에 맞게 배경 스케일 조정
     // 타일맵: 60x33 타일 = 1920x1056 픽셀
     // mountain.png: 2816x1536 픽셀
     float mapPixelHeight = 33 * 32;  // 1056
     float bgScale = mapPixelHeight / 1536.f;
-    backgroundSprite.setScale({bgScale, bgScale});
+    ParallaxBackground background;
+    // 월드 좌표 (0,0)에 고정 (scrollFactor 1)
+    if (!background.addLayer("mountain.png", 1.f, bgScale))
+    {
+        LOG_ERROR("Failed to load mountain.png!");
+        return -1;
+    }
 
     // 플레이어에 무기 텍스처 설정
-    player.setWeaponTexture(&weaponsTexture);
+    simulation.getPlayer().setWeaponTexture(&weaponsTexture);
 
     // 드래그 앤 드롭 매니저
     DragDropManager dragDropManager;
@@ -194,7 +297,7 @@ int main()
             {
                 source.equipment->setItemByIndex(sourceSlot, draggedItem);
             }
-            std::cout << "Drop cancelled - item returned to original slot" << std::endl;
+            LOG_DEBUG("Drop cancelled - item returned to original slot");
             return;
         }
 
@@ -220,12 +323,14 @@ int main()
                 sourceInv->setItem(sourceSlot, targetItem);
             }
 
-            std::cout << "Moved " << draggedItem.name;
             if (sourceInv != targetInv)
             {
-                std::cout << " between inventories";
+                LOG_DEBUG("Moved {} between inventories", draggedItem.name);
+            }
+            else
+            {
+                LOG_DEBUG("Moved {}", draggedItem.name);
             }
-            std::cout << std::endl;
         }
         // 장비에서 인벤토리로
         else if (source.type == DragSourceType::Equipment && source.equipment)
@@ -242,7 +347,7 @@ int main()
                 source.equipment->setItemByIndex(sourceSlot, targetItem);
             }
 
-            std::cout << "Unequipped " << draggedItem.name << std::endl;
+            LOG_INFO("Unequipped {}", draggedItem.name);
         }
     });
 
@@ -269,7 +374,7 @@ int main()
             {
                 source.equipment->setItemByIndex(source.slotIndex, draggedItem);
             }
-            std::cout << "Equipment drop cancelled" << std::endl;
+            LOG_DEBUG("Equipment drop cancelled");
             return;
         }
 
@@ -285,7 +390,7 @@ int main()
             {
                 source.equipment->setItemByIndex(source.slotIndex, draggedItem);
             }
-            std::cout << "Cannot equip " << draggedItem.name << " in this slot" << std::endl;
+            LOG_INFO("Cannot equip {} in this slot", draggedItem.name);
             return;
         }
 
@@ -308,202 +413,319 @@ int main()
             }
         }
 
-        std::cout << "Equipped " << draggedItem.name << std::endl;
+        LOG_INFO("Equipped {}", draggedItem.name);
     });
 
     // 버튼 매니저 생성
     ButtonManager buttonManager;
 
-    // 창 포커스 상태 (이벤트 기반 추적, 초기값 true)
-    bool windowHasFocus = true;
+    // 월드 엔티티 스프라이트 배치 (시뮬레이션 쪽에서 사각형을 모으는 용도)
+    SpriteBatch worldBatch;
 
-    while (renderWindow.isOpen())
+    // 렌더 스레드: 배경/타일맵은 직접 그리고 엔티티와 UI는 스냅샷에서 그림
+    // 배경과 타일맵은 게임 중에 바뀌지 않으므로 공유해도 안전함 (시뮬레이션 쪽은 읽기만 함)
+    SpriteBatch renderBatch;
+
+    // 동적 해상도: 게임 월드는 50~100% 해상도로 그려서 늘리고, UI는 원래 해상도로 그림
+    DynamicResolution dynamicResolution;
+    if (!dynamicResolution.create(renderWindow.getSize()))
     {
-        while (const std::optional event = renderWindow.pollEvent())
+        LOG_ERROR("Failed to create world render texture!");
+        return -1;
+    }
+    dynamicResolution.setTargetFrameTime(sf::seconds(1.f / 144.f));
+    sf::Clock renderFrameClock;
+
+    // 프로파일러 오버레이 (F3: 표시 전환, F4: Chrome trace 저장)
+    ProfilerOverlay profilerOverlay(font, {10.f, 10.f});
+    std::atomic<bool> showProfiler{false};
+
+    RenderThread renderThread(renderWindow, [&](sf::RenderWindow& target, const RenderSnapshot& snapshot) {
+        RenderStats& renderStats = RenderStats::current();
+        renderStats.beginFrame();
+        dynamicResolution.update(renderFrameClock.restart());
+        const DynamicResolution::Metrics& metrics = dynamicResolution.getMetrics();
+        if (metrics.changedLastFrame)
         {
-            if (event->is<sf::Event::Closed>())
+            LOG_INFO("Resolution scale: {} ({}x{}, avg {} ms, display {} ms)", metrics.scale, metrics.renderSize.x,
+                     metrics.renderSize.y, metrics.averageRenderMs, metrics.lastDisplayMs);
+        }
+
+        // 게임 월드 렌더링 (카메라 적용, 오프스크린)
+        {
+            PROFILE_SCOPE("Render World");
+            sf::RenderTarget& world = dynamicResolution.begin(snapshot.gameView, snapshot.clearColor);
             {
-                renderWindow.close();
+                RenderStats::Tag tag("Background");
+                world.draw(background);
             }
-
-            // 포커스 이벤트 처리
-            if (event->is<sf::Event::FocusGained>())
             {
-                windowHasFocus = true;
+                RenderStats::Tag tag("TileMap");
+                world.draw(tileMap);
             }
-            if (event->is<sf::Event::FocusLost>())
             {
-                windowHasFocus = false;
+                RenderStats::Tag tag("Entities");
+                renderBatch.setQuads(snapshot.worldQuads);
+                world.draw(renderBatch);
             }
 
-            // 키보드 단축키: B = Bag, I = Equipment(Inventory)
-            if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>())
+            RenderStats::Tag tag("Present");
+            target.clear(snapshot.clearColor);
+            dynamicResolution.present(target);
+        }
+
+        // UI 렌더링 (고정 뷰, 원래 해상도)
+        {
+            PROFILE_SCOPE("Render UI");
+            RenderStats::Tag tag("UI");
+            RenderStats::setView(target, snapshot.uiView);
+            snapshot.ui.replay(target);
+            tileMap.getMinimap().draw(target, snapshot.minimap);
+        }
+
+        profilerOverlay.setRenderStats(renderStats.endFrame());
+        profilerOverlay.setVisible(showProfiler.load(std::memory_order_relaxed));
+        profilerOverlay.update();
+        target.draw(profilerOverlay);
+    });
+    renderThread.setFrameInterval(sf::seconds(1.f / 144.f));
+    renderThread.setDisplayedCallback([&](sf::Time displayTime) { dynamicResolution.endFrame(displayTime); });
+    if (!renderThread.start())
+    {
+        LOG_ERROR("Failed to start render thread!");
+        return -1;
+    }
+
+    // 시뮬레이션 틱 간격 (렌더링과 별개로 제한)
+    const sf::Time simTickTime = sf::seconds(1.f / 144.f);
+    sf::Clock tickClock;
+
+    // 창 포커스 상태 (이벤트 기반 추적, 초기값 true)
+    bool windowHasFocus = true;
+
+    // 키보드 상태 (이벤트로만 갱신) 및 액션 키 배치
+    InputState inputState;
+    const ActionMap actionMap = ActionMap::defaults();
+
+    while (renderWindow.isOpen())
+    {
+        PROFILE_FRAME();
+
+        {
+            PROFILE_SCOPE("Events");
+            inputState.beginFrame();
+            while (const std::optional event = renderWindow.pollEvent())
             {
-                if (keyPressed->code == sf::Keyboard::Key::B)
+                inputState.handleEvent(*event);
+
+                if (event->is<sf::Event::Closed>())
                 {
-                    bagInventory.setVisible(!bagInventory.isVisible());
+                    // 렌더 스레드가 컨텍스트를 놓은 뒤에 창을 닫음
+                    renderThread.stop();
+                    renderWindow.close();
                 }
-                if (keyPressed->code == sf::Keyboard::Key::I)
+
+                // 포커스 이벤트 처리
+                if (event->is<sf::Event::FocusGained>())
                 {
-                    equipmentWindow.setVisible(!equipmentWindow.isVisible());
+                    windowHasFocus = true;
+                }
+                if (event->is<sf::Event::FocusLost>())
+                {
+                    windowHasFocus = false;
                 }
-            }
 
-            // 클릭 좌표 로깅
-            if (const auto* mousePressed = event->getIf<sf::Event::MouseButtonPressed>())
-            {
-                // 현재 마우스 위치도 함께 출력
-                sf::Vector2i currentMousePos = sf::Mouse::getPosition(renderWindow);
-                sf::Vector2f uiCoords = renderWindow.mapPixelToCoords(mousePressed->position, uiView);
-                sf::Vector2f currentUiCoords = renderWindow.mapPixelToCoords(currentMousePos, uiView);
-                std::cout << "Mouse clicked - Event Pixel: (" << mousePressed->position.x
-                          << ", " << mousePressed->position.y << ") Event UI: ("
-                          << uiCoords.x << ", " << uiCoords.y << ")" << std::endl;
-                std::cout << "              - Current Pixel: (" << currentMousePos.x
-                          << ", " << currentMousePos.y << ") Current UI: ("
-                          << currentUiCoords.x << ", " << currentUiCoords.y << ")" << std::flush << std::endl;
-            }
+#ifdef GIVEITUP_PROFILER
+                if (const auto* keyPressed = event->getIf<sf::Event::KeyPressed>())
+                {
+                    if (keyPressed->code == sf::Keyboard::Key::F3)
+                    {
+                        showProfiler = !showProfiler;
+                    }
+                    if (keyPressed->code == sf::Keyboard::Key::F4)
+                    {
+                        if (Profiler::instance().writeChromeTrace("profile_trace.json"))
+                        {
+                            LOG_INFO("Profiler trace written to profile_trace.json");
+                        }
+                    }
+                }
+#endif
 
-            // 드래그 매니저 이벤트 처리 (ESC로 취소, 마우스 이동 등)
-            if (dragDropManager.handleEvent(*event))
-            {
-                continue;
-            }
+                // 클릭 좌표 로깅
+                if (const auto* mousePressed = event->getIf<sf::Event::MouseButtonPressed>())
+                {
+                    // 현재 마우스 위치도 함께 출력
+                    sf::Vector2i currentMousePos = sf::Mouse::getPosition(renderWindow);
+                    sf::Vector2f uiCoords = renderWindow.mapPixelToCoords(mousePressed->position, uiView);
+                    sf::Vector2f currentUiCoords = renderWindow.mapPixelToCoords(currentMousePos, uiView);
+                    LOG_DEBUG("Mouse clicked - Event Pixel: ({}, {}) Event UI: ({}, {})",
+                              mousePressed->position.x, mousePressed->position.y, uiCoords.x, uiCoords.y);
+                    LOG_DEBUG("              - Current Pixel: ({}, {}) Current UI: ({}, {})",
+                              currentMousePos.x, currentMousePos.y, currentUiCoords.x, currentUiCoords.y);
+                }
 
-            // 인벤토리 이벤트 처리
-            if (bagInventory.handleEvent(*event))
-            {
-                continue;
+                // 드래그 매니저 이벤트 처리 (ESC로 취소, 마우스 이동 등)
+                if (dragDropManager.handleEvent(*event))
+                {
+                    continue;
+                }
+
+                // 인벤토리 이벤트 처리
+                if (bagInventory.handleEvent(*event))
+                {
+                    continue;
+                }
+                if (storageInventory.handleEvent(*event))
+                {
+                    continue;
+                }
+
+                // 장비 창 이벤트 처리
+                if (equipmentWindow.handleEvent(*event))
+                {
+                    continue;
+                }
+
+                // 클릭-토글 방식이므로 mouseReleased에서 취소하지 않음
+                // 드래그 취소는 ESC 키 또는 빈 공간 클릭으로 처리
+
+                buttonManager.handleEvent(*event);
             }
-            if (storageInventory.handleEvent(*event))
+
+            // 키보드 단축키: B = Bag, I = Equipment(Inventory)
+            if (actionMap.wasPressed(Action::ToggleBag, inputState))
             {
-                continue;
+                bagInventory.setVisible(!bagInventory.isVisible());
             }
-
-            // 장비 창 이벤트 처리
-            if (equipmentWindow.handleEvent(*event))
+            if (actionMap.wasPressed(Action::ToggleEquipment, inputState))
             {
-                continue;
+                equipmentWindow.setVisible(!equipmentWindow.isVisible());
             }
-
-            // 클릭-토글 방식이므로 mouseReleased에서 취소하지 않음
-            // 드래그 취소는 ESC 키 또는 빈 공간 클릭으로 처리
-
-            buttonManager.handleEvent(*event);
         }
-        // 델타 타임 계산
-        float deltaTime = clock.restart().asSeconds();
+        // 재생이 끝나면 창을 닫고 결과 확인
+        if (replaying && replayFrame >= replay.getFrames().size())
+        {
+            renderThread.stop();
+            renderWindow.close();
+            break;
+        }
 
-        // 장비창에서 무기 변경 감지 및 플레이어에 반영
-        OptionalItem currentWeapon = equipmentWindow.getItem(EquipmentSlot::Weapon);
-        bool weaponChanged = false;
-        if (currentWeapon.has_value() != lastEquippedWeapon.has_value())
+        // 델타 타임 계산 (재생 중에는 기록된 값 사용)
+        float deltaTime = clock.restart().asSeconds();
+        PlayerInput input;
+        if (replaying)
         {
-            weaponChanged = true;
+            const InputRecording::Frame& frame = replay.getFrames()[replayFrame++];
+            deltaTime = frame.deltaTime;
+            input = frame.input;
         }
-        else if (currentWeapon.has_value() && lastEquippedWeapon.has_value())
+        else
         {
-            weaponChanged = (currentWeapon->id != lastEquippedWeapon->id);
+            // 창이 포커스를 가지고 있을 때만 키보드 입력 사용
+            input = windowHasFocus ? PlayerInput::fromActions(actionMap, inputState) : PlayerInput{0, false};
+            if (recordingInput)
+            {
+                recording.addFrame(deltaTime, input);
+            }
         }
 
-        if (weaponChanged)
         {
-            player.equipWeapon(currentWeapon);
-            lastEquippedWeapon = currentWeapon;
-            if (currentWeapon)
+            PROFILE_SCOPE("WeaponDiff");
+            // 장비창에서 무기 변경 감지 및 플레이어에 반영
+            OptionalItem currentWeapon = equipmentWindow.getItem(EquipmentSlot::Weapon);
+            bool weaponChanged = false;
+            if (currentWeapon.has_value() != lastEquippedWeapon.has_value())
             {
-                std::cout << "Weapon equipped: " << currentWeapon->name
-                          << " (sprite: " << currentWeapon->spriteX << ", " << currentWeapon->spriteY << ")" << std::endl;
+                weaponChanged = true;
             }
-            else
+            else if (currentWeapon.has_value() && lastEquippedWeapon.has_value())
             {
-                std::cout << "Weapon unequipped" << std::endl;
+                weaponChanged = (currentWeapon->id != lastEquippedWeapon->id);
             }
-        }
-
-        // 플레이어 입력 및 업데이트 (창이 포커스를 가지고 있을 때만)
-        if (windowHasFocus)
-        {
-            player.handleInput();
-        }
-        player.update(deltaTime, &tileMap);
-
-        // 적 업데이트 및 충돌 감지
-        for (auto& enemy : enemies)
-        {
-            enemy.update(deltaTime, &tileMap);
 
-            // 플레이어와 적의 충돌 감지 (적 -> 플레이어)
-            if (enemy.isAlive())
+            if (weaponChanged)
             {
-                auto intersection = player.getBounds().findIntersection(enemy.getBounds());
-                if (intersection.has_value())
+                simulation.getPlayer().equipWeapon(currentWeapon);
+                lastEquippedWeapon = currentWeapon;
+                if (currentWeapon)
                 {
-                    player.takeHit(enemy.getDamage(), enemy.getKnockbackForce(), enemy.getCenter());
+                    LOG_INFO("Weapon equipped: {} (sprite: {}, {})", currentWeapon->name,
+                             currentWeapon->spriteX, currentWeapon->spriteY);
                 }
-            }
-
-            // 플레이어 공격 충돌 감지 (플레이어 -> 적)
-            if (player.isAttacking() && enemy.isAlive())
-            {
-                sf::FloatRect attackHitbox = player.getAttackHitbox();
-                auto attackHit = attackHitbox.findIntersection(enemy.getBounds());
-                if (attackHit.has_value())
+                else
                 {
-                    enemy.takeDamage(player.getAttackDamage(), player.getAttackKnockback(), player.getCenter());
+                    LOG_INFO("Weapon unequipped");
                 }
             }
         }
 
-        // 카메라를 플레이어 중심으로 부드럽게 이동 (lerp)
-        sf::Vector2f playerCenter = player.getPosition() + sf::Vector2f(Player::WIDTH / 2.f, Player::HEIGHT / 2.f);
-        sf::Vector2f currentCenter = gameView.getCenter();
-        float smoothSpeed = 5.f;  // 카메라 스무딩 속도 (높을수록 빠름)
-        sf::Vector2f newCenter = currentCenter + (playerCenter - currentCenter) * smoothSpeed * deltaTime;
-
-        // 카메라를 타일맵 범위 내로 제한
-        sf::Vector2f viewSize = gameView.getSize();
-        float mapWidth = tileMap.getWidth() * tileMap.getTileSize();
-        float mapHeight = tileMap.getHeight() * tileMap.getTileSize();
-
-        // 카메라 중심의 최소/최대값 계산
-        float minX = viewSize.x / 2.f;
-        float maxX = mapWidth - viewSize.x / 2.f;
-        float minY = viewSize.y / 2.f;
-        float maxY = mapHeight - viewSize.y / 2.f;
-
-        // 맵이 화면보다 작은 경우 중앙에 고정
-        if (maxX < minX) newCenter.x = mapWidth / 2.f;
-        else newCenter.x = std::max(minX, std::min(newCenter.x, maxX));
-
-        if (maxY < minY) newCenter.y = mapHeight / 2.f;
-        else newCenter.y = std::max(minY, std::min(newCenter.y, maxY));
+        // 플레이어/적/카메라 한 틱 진행
+        simulation.step(input, deltaTime);
 
-        gameView.setCenter(newCenter);
-
-        renderWindow.clear(sf::Color{30, 30, 30});
+        {
+            PROFILE_SCOPE("Snapshot");
+            // 렌더 스냅샷 작성 후 발행 (렌더 스레드를 기다리지 않음)
+            RenderSnapshot& snapshot = renderThread.beginSnapshot();
+            snapshot.clearColor = sf::Color{30, 30, 30};
+            snapshot.gameView = simulation.getCamera();
+            snapshot.uiView = uiView;
+
+            // 적/플레이어/무기는 스프라이트 배치로 모아서 텍스처별로 한 번씩 그림
+            worldBatch.clear();
+            for (const auto& enemy : simulation.getEnemies())
+            {
+                enemy.addToBatch(worldBatch);
+            }
+            simulation.getPlayer().addToBatch(worldBatch);
+            snapshot.worldQuads.assign(worldBatch.getQuads().begin(), worldBatch.getQuads().end());
+
+            // 미니맵 오버레이 (픽셀 -> 타일 좌표)
+            const float tileSize = static_cast<float>(TileMap::TILE_SIZE);
+            const sf::View& camera = simulation.getCamera();
+            snapshot.minimap.frustum = {(camera.getCenter() - camera.getSize() / 2.f) / tileSize, camera.getSize() / tileSize};
+            snapshot.minimap.player = simulation.getPlayer().getCenter() / tileSize;
+
+            snapshot.ui.clear();
+            snapshot.ui.draw(buttonManager);
+            snapshot.ui.draw(bagInventory);
+            snapshot.ui.draw(storageInventory);
+            snapshot.ui.draw(equipmentWindow);
+            snapshot.ui.draw(dragDropManager);  // 고스트 이미지 (항상 최상위)
+            renderThread.publishSnapshot();
+        }
 
-        // 게임 월드 렌더링 (카메라 적용)
-        renderWindow.setView(gameView);
+        // 남은 틱 시간만큼 대기 (재생 중에는 기록된 deltaTime에 맞춤, --fast면 대기 없음)
+        sf::Time tickTime = replaying ? sf::seconds(deltaTime) : simTickTime;
+        sf::Time elapsed = tickClock.getElapsedTime();
+        if (elapsed < tickTime && !(replaying && options.fast))
+        {
+            PROFILE_SCOPE("Sleep");
+            sf::sleep(tickTime - elapsed);
+        }
+        tickClock.restart();
+    }
 
-        // 배경 렌더링 (월드 좌표 (0,0)에 고정)
-        backgroundSprite.setPosition({0.f, 0.f});
-        renderWindow.draw(backgroundSprite);
+    if (replaying)
+    {
+        if (replayFrame < replay.getFrames().size())
+        {
+            LOG_INFO("Replay stopped at tick {} of {}", replayFrame, replay.getFrames().size());
+            return 1;
+        }
+        return checkReplayResult(simulation, replay) ? 0 : 1;
+    }
 
-        renderWindow.draw(tileMap);
-        for (const auto& enemy : enemies)
+    if (recordingInput)
+    {
+        recording.setFinalStateHash(simulation.computeStateHash());
+        if (recording.saveToFile(options.recordPath))
+        {
+            LOG_INFO("Recorded {} ticks to {}", recording.getFrames().size(), options.recordPath);
+        }
+        else
         {
-            renderWindow.draw(enemy);
+            LOG_ERROR("Failed to save recording {}", options.recordPath);
         }
-        renderWindow.draw(player);
-
-        // UI 렌더링 (고정 뷰)
-        renderWindow.setView(uiView);
-        renderWindow.draw(buttonManager);
-        renderWindow.draw(bagInventory);
-        renderWindow.draw(storageInventory);
-        renderWindow.draw(equipmentWindow);
-        renderWindow.draw(dragDropManager);  // 고스트 이미지 (항상 최상위)
-        renderWindow.display();
     }
 }
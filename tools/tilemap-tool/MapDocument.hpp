@@ -0,0 +1,696 @@
+#pragma once
+
+#include "BoundedReader.hpp"
+#include "MapFileFormat.hpp"
+#include "ProjectFile.hpp"
+#include "TileChunkGrid.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// 맵 파일 형식들을 한 모양으로 읽고 쓰는 문서 (tilemap-tool 전용, SFML 창/그래픽 없이 동작)
+//
+// 지원 형식:
+// - flat v1/v2:    게임용 .tilemap (TileMap::loadFromFile, 에디터 내보내기) - 레이어 하나, 스폰은 타일 좌표
+// - layered v1/v2: MapFile::MapData (.tilemap, 같은 "TMAP" 매직) - 레이어 여러 개, 스폰은 픽셀 좌표
+// - project:       에디터 프로젝트 .tmproj (ProjectFile) - 64x64 청크 단위 레이어
+//
+// "TMAP" 파일은 헤더만으로 flat/layered를 구분할 수 없어서 두 형식으로 끝까지 읽어 보고
+// 파일을 남김없이 정확히 소비하는 쪽으로 판정함
+// 읽기는 파일 스트림을 BoundedReader로 직접 읽고, 모든 개수를 남은 바이트 수와 메모리 상한으로 확인한 뒤 할당함
+// (잘린 파일 검출, 형식마다 처음부터 다시 읽으므로 파일 전체를 메모리에 올리지 않음)
+namespace MapTool
+{
+
+enum class MapFormat : std::uint8_t
+{
+    FlatV1,
+    FlatV2,
+    LayeredV1,
+    LayeredV2,
+    Project
+};
+
+inline const char* formatName(MapFormat format)
+{
+    switch (format)
+    {
+        case MapFormat::FlatV1: return "flat-v1";
+        case MapFormat::FlatV2: return "flat-v2";
+        case MapFormat::LayeredV1: return "layered-v1";
+        case MapFormat::LayeredV2: return "layered-v2";
+        case MapFormat::Project: return "project";
+    }
+    return "unknown";
+}
+
+inline bool parseFormat(const std::string& name, MapFormat& format)
+{
+    for (MapFormat candidate : {MapFormat::FlatV1, MapFormat::FlatV2, MapFormat::LayeredV1, MapFormat::LayeredV2,
+                                MapFormat::Project})
+    {
+        if (name == formatName(candidate))
+        {
+            format = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+inline const char* formatExtension(MapFormat format)
+{
+    return format == MapFormat::Project ? ".tmproj" : ".tilemap";
+}
+
+// 타일 타입/충돌 형태 값은 게임(TileMap)과 에디터가 같은 숫자를 씀
+constexpr std::uint8_t TILE_EMPTY = 0;
+constexpr std::uint8_t TILE_SOLID = 1;
+constexpr std::uint8_t TILE_PLATFORM = 2;
+constexpr std::uint8_t TILE_TYPE_COUNT = 3;
+constexpr std::uint8_t SHAPE_NONE = 0;
+constexpr std::uint8_t SHAPE_FULL = 1;
+constexpr std::uint8_t SHAPE_PLATFORM = 8;
+constexpr std::uint8_t SHAPE_COUNT = 9;
+
+// 타입에 맞는 기본 충돌 형태 (v1 파일에는 형태가 없음)
+inline std::uint8_t defaultShape(std::uint8_t type)
+{
+    if (type == TILE_EMPTY) return SHAPE_NONE;
+    return type == TILE_PLATFORM ? SHAPE_PLATFORM : SHAPE_FULL;
+}
+
+struct MapTile
+{
+    std::uint16_t x = 0;
+    std::uint16_t y = 0;
+    std::uint8_t type = TILE_EMPTY;
+    std::uint8_t shape = SHAPE_NONE;
+};
+
+struct MapLayer
+{
+    std::string name;
+    bool visible = true;
+    std::vector<MapTile> tiles;  // 비어있지 않은 타일만 (파일 순서 그대로)
+};
+
+struct MapSpawn
+{
+    std::int32_t x = 0;  // 타일 좌표
+    std::int32_t y = 0;
+    std::uint8_t type = 0;
+};
+
+struct MapDocument
+{
+    MapFormat format = MapFormat::FlatV2;
+    std::uint16_t gridSize = 32;
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    std::vector<MapLayer> layers;
+    std::int32_t playerX = -1;  // 타일 좌표, 없으면 (-1, -1)
+    std::int32_t playerY = -1;
+    std::vector<MapSpawn> enemies;
+    std::vector<std::string> warnings;  // 읽기/변환 중 데이터가 바뀌거나 버려진 내용
+
+    bool hasPlayerSpawn() const { return playerX >= 0 && playerY >= 0; }
+};
+
+// 에디터 타일과 같은 바이트 배치 (프로젝트 청크는 셀을 그대로 저장함)
+struct ProjectCell
+{
+    std::uint8_t type = TILE_EMPTY;
+    std::uint8_t shape = SHAPE_NONE;
+
+    bool operator==(const ProjectCell& other) const { return type == other.type && shape == other.shape; }
+    bool operator!=(const ProjectCell& other) const { return !(*this == other); }
+};
+
+namespace detail
+{
+class ByteWriter
+{
+public:
+    template<typename T>
+    void write(const T& value)
+    {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        m_data.insert(m_data.end(), bytes, bytes + sizeof(T));
+    }
+
+    void writeBytes(const char* data, std::size_t size) { m_data.insert(m_data.end(), data, data + size); }
+    const std::vector<char>& data() const { return m_data; }
+
+private:
+    std::vector<char> m_data;
+};
+
+inline bool writeFile(const std::string& path, const std::vector<char>& data)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    file.close();
+    return !file.fail();
+}
+
+// 게임용 한 레이어 형식 (tileRecordSize: v1 = 5, v2 = 6)
+// 개수는 남은 파일 크기와 메모리 상한(limits)으로 확인한 뒤에만 할당함
+inline bool readFlat(std::istream& stream, MapDocument& doc, std::size_t tileRecordSize, const LoadLimits& limits,
+                     std::string& error)
+{
+    BoundedReader in(stream, limits);
+    char magic[4];
+    std::uint16_t version = 0;
+    std::uint32_t tileCount = 0;
+    if (!in.readBytes(magic, 4) || !in.read(version) || !in.read(doc.gridSize) || !in.read(doc.width) ||
+        !in.read(doc.height) || !in.read(tileCount))
+    {
+        error = "truncated header";
+        return false;
+    }
+    if (!in.reserve(tileCount, tileRecordSize, sizeof(MapTile)))
+    {
+        error = "tile count " + std::to_string(tileCount) + " exceeds file size or memory limit";
+        return false;
+    }
+
+    MapLayer layer;
+    layer.name = "Ground";
+    layer.tiles.resize(tileCount);
+    for (MapTile& tile : layer.tiles)
+    {
+        in.read(tile.x);
+        in.read(tile.y);
+        in.read(tile.type);
+        tile.shape = defaultShape(tile.type);
+        if (tileRecordSize == 6) in.read(tile.shape);
+    }
+
+    std::uint32_t enemyCount = 0;
+    if (!in.read(doc.playerX) || !in.read(doc.playerY) || !in.read(enemyCount))
+    {
+        error = "truncated spawn section";
+        return false;
+    }
+    constexpr std::size_t ENEMY_RECORD_SIZE = sizeof(std::int32_t) * 2 + sizeof(std::uint8_t);
+    if (!in.reserve(enemyCount, ENEMY_RECORD_SIZE, sizeof(MapSpawn)))
+    {
+        error = "enemy count " + std::to_string(enemyCount) + " exceeds file size or memory limit";
+        return false;
+    }
+    doc.enemies.resize(enemyCount);
+    for (MapSpawn& spawn : doc.enemies)
+    {
+        in.read(spawn.x);
+        in.read(spawn.y);
+        in.read(spawn.type);
+    }
+    if (in.remaining() != 0)
+    {
+        error = std::to_string(in.remaining()) + " trailing bytes";
+        return false;
+    }
+    doc.layers.push_back(std::move(layer));
+    return true;
+}
+
+// MapFile::MapData 형식 (스폰은 픽셀 좌표 -> 타일 좌표로 바꿔서 보관)
+inline bool readLayered(std::istream& stream, MapDocument& doc, std::uint16_t version, const LoadLimits& limits,
+                        std::string& error)
+{
+    BoundedReader in(stream, limits);
+    char magic[4];
+    std::uint16_t fileVersion = 0;
+    std::uint16_t layerCount = 0;
+    if (!in.readBytes(magic, 4) || !in.read(fileVersion) || !in.read(doc.gridSize) || !in.read(doc.width) ||
+        !in.read(doc.height) || !in.read(layerCount))
+    {
+        error = "truncated header";
+        return false;
+    }
+    if (doc.gridSize == 0)
+    {
+        error = "grid size is 0";
+        return false;
+    }
+
+    static_assert(sizeof(MapFile::TileDataV1) == 8 && sizeof(MapFile::TileData) == 8, "tile records are 8 bytes");
+    constexpr std::size_t MIN_LAYER_SIZE = sizeof(std::uint8_t) * 2 + sizeof(std::uint32_t);
+    if (!in.reserve(layerCount, MIN_LAYER_SIZE, sizeof(MapLayer)))
+    {
+        error = "layer count " + std::to_string(layerCount) + " exceeds file size or memory limit";
+        return false;
+    }
+    doc.layers.resize(layerCount);
+    for (MapLayer& layer : doc.layers)
+    {
+        std::uint8_t nameLength = 0;
+        std::uint8_t visible = 0;
+        std::uint32_t tileCount = 0;
+        if (!in.read(nameLength))
+        {
+            error = "truncated layer header";
+            return false;
+        }
+        layer.name.resize(nameLength);
+        if ((nameLength > 0 && !in.readBytes(&layer.name[0], nameLength)) || !in.read(visible) || !in.read(tileCount))
+        {
+            error = "truncated layer header";
+            return false;
+        }
+        layer.visible = visible != 0;
+        if (!in.reserve(tileCount, sizeof(MapFile::TileData), sizeof(MapTile)))
+        {
+            error = "layer '" + layer.name + "' tile count " + std::to_string(tileCount) +
+                    " exceeds file size or memory limit";
+            return false;
+        }
+
+        layer.tiles.resize(tileCount);
+        for (MapTile& tile : layer.tiles)
+        {
+            if (version == MapFile::VERSION_1)
+            {
+                MapFile::TileDataV1 record;
+                in.read(record);
+                tile = {record.x, record.y, static_cast<std::uint8_t>(record.type),
+                        defaultShape(static_cast<std::uint8_t>(record.type))};
+            }
+            else
+            {
+                MapFile::TileData record;
+                in.read(record);
+                tile = {record.x, record.y, static_cast<std::uint8_t>(record.type), static_cast<std::uint8_t>(record.shape)};
+            }
+        }
+    }
+
+    std::int32_t playerX = 0;
+    std::int32_t playerY = 0;
+    std::uint32_t enemyCount = 0;
+    if (!in.read(playerX) || !in.read(playerY) || !in.read(enemyCount))
+    {
+        error = "truncated spawn section";
+        return false;
+    }
+    if (!in.reserve(enemyCount, sizeof(MapFile::EnemySpawn), sizeof(MapSpawn)))
+    {
+        error = "enemy count " + std::to_string(enemyCount) + " exceeds file size or memory limit";
+        return false;
+    }
+
+    auto toTile = [&](std::int32_t pixel, const char* what) {
+        if (pixel % doc.gridSize != 0)
+        {
+            doc.warnings.push_back(std::string(what) + " position " + std::to_string(pixel) +
+                                   " is not on the tile grid (rounded down)");
+        }
+        // 아래로 내림 나눗셈 (INT32_MIN 근처에서 넘치지 않게 64비트로 계산)
+        std::int64_t value = pixel;
+        std::int64_t grid = doc.gridSize;
+        return static_cast<std::int32_t>(value >= 0 ? value / grid : (value - grid + 1) / grid);
+    };
+    if (playerX >= 0 && playerY >= 0)
+    {
+        doc.playerX = toTile(playerX, "player spawn");
+        doc.playerY = toTile(playerY, "player spawn");
+    }
+    doc.enemies.resize(enemyCount);
+    for (MapSpawn& spawn : doc.enemies)
+    {
+        MapFile::EnemySpawn record;
+        in.read(record);
+        spawn = {toTile(record.x, "enemy spawn"), toTile(record.y, "enemy spawn"), record.enemyType};
+    }
+    if (in.remaining() != 0)
+    {
+        error = std::to_string(in.remaining()) + " trailing bytes";
+        return false;
+    }
+    return true;
+}
+
+inline bool readProject(const std::string& path, MapDocument& doc, std::string& error)
+{
+    ProjectFile::Reader reader;
+    if (!reader.open(path))
+    {
+        error = "invalid project header or chunk table";
+        return false;
+    }
+    const ProjectFile::Info& info = reader.getInfo();
+    doc.gridSize = info.gridSize;
+    doc.width = info.width;
+    doc.height = info.height;
+    doc.playerX = info.playerSpawn.x;
+    doc.playerY = info.playerSpawn.y;
+    for (const auto& spawn : info.enemySpawns)
+    {
+        doc.enemies.push_back({spawn.x, spawn.y, 0});
+    }
+    if (info.journalId != 0)
+    {
+        doc.warnings.push_back("project has an edit journal; edits recorded in " + path + ".journal are not included");
+    }
+
+    using Grid = TileChunkGrid<ProjectCell>;
+    for (const ProjectFile::LayerInfo& layerInfo : info.layers)
+    {
+        MapLayer layer;
+        layer.name = layerInfo.name;
+        layer.visible = layerInfo.visible;
+        for (const ProjectFile::ChunkEntry& entry : layerInfo.chunks)
+        {
+            if (entry.size == 0) continue;
+            Grid::Chunk chunk;
+            if (!reader.readChunk(entry, chunk))
+            {
+                error = "layer '" + layer.name + "' chunk (" + std::to_string(entry.chunkX) + ", " +
+                        std::to_string(entry.chunkY) + ") is corrupt";
+                return false;
+            }
+            int x0 = entry.chunkX * Grid::CHUNK_SIZE;
+            int y0 = entry.chunkY * Grid::CHUNK_SIZE;
+            for (int ly = 0; ly < Grid::CHUNK_SIZE; ++ly)
+            {
+                for (int lx = 0; lx < Grid::CHUNK_SIZE; ++lx)
+                {
+                    const ProjectCell& cell = chunk.at(lx, ly);
+                    if (cell.type == TILE_EMPTY) continue;
+                    if (static_cast<std::uint32_t>(x0 + lx) >= doc.width || static_cast<std::uint32_t>(y0 + ly) >= doc.height)
+                    {
+                        continue;  // 맵 밖 가장자리 칸 (에디터도 무시함)
+                    }
+                    layer.tiles.push_back({static_cast<std::uint16_t>(x0 + lx), static_cast<std::uint16_t>(y0 + ly),
+                                           cell.type, cell.shape});
+                }
+            }
+        }
+        doc.layers.push_back(std::move(layer));
+    }
+    return true;
+}
+
+// 보이는 레이어를 한 장으로 합침 (같은 칸은 뒤 레이어가 이김, 에디터 내보내기와 같은 규칙)
+inline std::vector<MapTile> mergeVisibleLayers(const MapDocument& doc)
+{
+    std::vector<MapTile> merged;
+    for (const MapLayer& layer : doc.layers)
+    {
+        if (!layer.visible) continue;
+        merged.insert(merged.end(), layer.tiles.begin(), layer.tiles.end());
+    }
+    // 좌표순으로 안정 정렬한 뒤 같은 좌표의 마지막 것만 남김
+    std::stable_sort(merged.begin(), merged.end(), [](const MapTile& a, const MapTile& b) {
+        return a.y != b.y ? a.y < b.y : a.x < b.x;
+    });
+    std::vector<MapTile> unique;
+    unique.reserve(merged.size());
+    for (const MapTile& tile : merged)
+    {
+        if (!unique.empty() && unique.back().x == tile.x && unique.back().y == tile.y)
+        {
+            unique.back() = tile;
+        }
+        else
+        {
+            unique.push_back(tile);
+        }
+    }
+    return unique;
+}
+
+inline bool hasCustomShapes(const std::vector<MapTile>& tiles)
+{
+    return std::any_of(tiles.begin(), tiles.end(), [](const MapTile& tile) { return tile.shape != defaultShape(tile.type); });
+}
+
+inline void writeHeader(ByteWriter& out, std::uint16_t version, const MapDocument& doc)
+{
+    out.writeBytes(MapFile::MAGIC, 4);
+    out.write(version);
+    out.write(doc.gridSize);
+    out.write(doc.width);
+    out.write(doc.height);
+}
+
+inline std::vector<char> writeFlat(const MapDocument& doc, std::uint16_t version, std::vector<std::string>& warnings)
+{
+    std::vector<MapTile> tiles = mergeVisibleLayers(doc);
+    if (doc.layers.size() > 1) warnings.push_back("merged " + std::to_string(doc.layers.size()) + " layers into one");
+    for (const MapLayer& layer : doc.layers)
+    {
+        if (!layer.visible && !layer.tiles.empty()) warnings.push_back("dropped hidden layer '" + layer.name + "'");
+    }
+    if (version == MapFile::VERSION_1 && hasCustomShapes(tiles)) warnings.push_back("v1 drops collision shapes");
+
+    ByteWriter out;
+    writeHeader(out, version, doc);
+    out.write(static_cast<std::uint32_t>(tiles.size()));
+    for (const MapTile& tile : tiles)
+    {
+        out.write(tile.x);
+        out.write(tile.y);
+        out.write(tile.type);
+        if (version == MapFile::VERSION) out.write(tile.shape);
+    }
+    out.write(doc.playerX);
+    out.write(doc.playerY);
+    out.write(static_cast<std::uint32_t>(doc.enemies.size()));
+    for (const MapSpawn& spawn : doc.enemies)
+    {
+        out.write(spawn.x);
+        out.write(spawn.y);
+        out.write(spawn.type);
+    }
+    return out.data();
+}
+
+inline std::vector<char> writeLayered(const MapDocument& doc, std::uint16_t version, std::vector<std::string>& warnings)
+{
+    ByteWriter out;
+    writeHeader(out, version, doc);
+    out.write(static_cast<std::uint16_t>(doc.layers.size()));
+    for (const MapLayer& layer : doc.layers)
+    {
+        if (layer.name.size() > 255) warnings.push_back("layer name '" + layer.name + "' cut to 255 bytes");
+        std::uint8_t nameLength = static_cast<std::uint8_t>(std::min<std::size_t>(layer.name.size(), 255));
+        out.write(nameLength);
+        out.writeBytes(layer.name.data(), nameLength);
+        out.write(static_cast<std::uint8_t>(layer.visible ? 1 : 0));
+        out.write(static_cast<std::uint32_t>(layer.tiles.size()));
+        if (version == MapFile::VERSION_1 && hasCustomShapes(layer.tiles))
+        {
+            warnings.push_back("v1 drops collision shapes of layer '" + layer.name + "'");
+        }
+        for (const MapTile& tile : layer.tiles)
+        {
+            if (version == MapFile::VERSION_1)
+            {
+                MapFile::TileDataV1 record{tile.x, tile.y, static_cast<MapFile::TileType>(tile.type), 0, 0, 0};
+                out.write(record);
+            }
+            else
+            {
+                MapFile::TileData record{tile.x, tile.y, static_cast<MapFile::TileType>(tile.type),
+                                         static_cast<MapFile::CollisionShape>(tile.shape), 0, 0};
+                out.write(record);
+            }
+        }
+    }
+
+    // 스폰은 픽셀 좌표 (int32_t에 들어가지 않는 스폰은 버림)
+    auto toPixels = [&doc](std::int32_t tile, std::int32_t& pixel) {
+        std::int64_t value = static_cast<std::int64_t>(tile) * doc.gridSize;
+        if (value < INT32_MIN || value > INT32_MAX) return false;
+        pixel = static_cast<std::int32_t>(value);
+        return true;
+    };
+    std::int32_t playerX = -1;
+    std::int32_t playerY = -1;
+    if (doc.hasPlayerSpawn() && !(toPixels(doc.playerX, playerX) && toPixels(doc.playerY, playerY)))
+    {
+        warnings.push_back("player spawn does not fit in pixel coordinates (dropped)");
+        playerX = -1;
+        playerY = -1;
+    }
+    out.write(playerX);
+    out.write(playerY);
+
+    std::vector<MapFile::EnemySpawn> enemies;
+    enemies.reserve(doc.enemies.size());
+    for (const MapSpawn& spawn : doc.enemies)
+    {
+        MapFile::EnemySpawn record{0, 0, spawn.type, {0, 0, 0}};
+        if (toPixels(spawn.x, record.x) && toPixels(spawn.y, record.y)) enemies.push_back(record);
+    }
+    if (enemies.size() != doc.enemies.size())
+    {
+        warnings.push_back(std::to_string(doc.enemies.size() - enemies.size()) +
+                           " enemy spawns do not fit in pixel coordinates (dropped)");
+    }
+    out.write(static_cast<std::uint32_t>(enemies.size()));
+    for (const MapFile::EnemySpawn& record : enemies)
+    {
+        out.write(record);
+    }
+    return out.data();
+}
+
+inline bool writeProject(const std::string& path, const MapDocument& doc, std::vector<std::string>& warnings, std::string& error)
+{
+    if (doc.width > ProjectFile::MAX_MAP_SIZE || doc.height > ProjectFile::MAX_MAP_SIZE ||
+        doc.layers.size() > ProjectFile::MAX_LAYERS)
+    {
+        error = "map is too large for a project file";
+        return false;
+    }
+
+    using Grid = TileChunkGrid<ProjectCell>;
+    ProjectFile::Info info;
+    info.gridSize = doc.gridSize;
+    info.width = doc.width;
+    info.height = doc.height;
+    info.playerSpawn = {doc.playerX, doc.playerY};
+    bool typedEnemies = false;
+    for (const MapSpawn& spawn : doc.enemies)
+    {
+        info.enemySpawns.push_back({spawn.x, spawn.y});
+        typedEnemies = typedEnemies || spawn.type != 0;
+    }
+    if (typedEnemies) warnings.push_back("project files do not store enemy types");
+
+    std::vector<Grid> grids;
+    grids.reserve(doc.layers.size());
+    for (const MapLayer& layer : doc.layers)
+    {
+        info.layers.push_back({layer.name, layer.visible, {}});
+        Grid& grid = grids.emplace_back(static_cast<int>(doc.width), static_cast<int>(doc.height));
+        for (const MapTile& tile : layer.tiles)
+        {
+            if (grid.contains(tile.x, tile.y)) grid.edit(tile.x, tile.y) = {tile.type, tile.shape};
+        }
+    }
+    std::vector<const Grid*> gridPointers;
+    for (const Grid& grid : grids)
+    {
+        gridPointers.push_back(&grid);
+    }
+    if (!ProjectFile::saveAtomic(path, info, gridPointers))
+    {
+        error = "failed to write " + path;
+        return false;
+    }
+    return true;
+}
+}
+
+// 파일을 읽어 형식을 판정함 (실패하면 error에 이유)
+// 형식마다 파일 처음부터 다시 읽음 (파일 전체를 메모리에 올리지 않음)
+inline bool loadMap(const std::string& path, MapDocument& doc, std::string& error, const LoadLimits& limits = {})
+{
+    doc = MapDocument{};
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        error = "cannot read file";
+        return false;
+    }
+    auto rewind = [&file]() -> std::istream& {
+        file.clear();
+        file.seekg(0);
+        return file;
+    };
+
+    char magic[4] = {};
+    std::uint16_t version = 0;
+    bool hasMagic = static_cast<bool>(file.read(magic, 4));
+    if (hasMagic && std::equal(magic, magic + 4, ProjectFile::MAGIC))
+    {
+        doc.format = MapFormat::Project;
+        return detail::readProject(path, doc, error);
+    }
+    if (!hasMagic || !std::equal(magic, magic + 4, MapFile::MAGIC) ||
+        !file.read(reinterpret_cast<char*>(&version), sizeof(version)))
+    {
+        error = "unknown file type (no TMAP/TMPJ magic)";
+        return false;
+    }
+    if (version != MapFile::VERSION && version != MapFile::VERSION_1)
+    {
+        error = "unsupported version " + std::to_string(version);
+        return false;
+    }
+
+    // flat -> layered 순서로 시도 (게임이 읽는 형식이 먼저)
+    std::string flatError;
+    std::string layeredError;
+    MapDocument flat;
+    if (detail::readFlat(rewind(), flat, version == MapFile::VERSION ? 6 : 5, limits, flatError))
+    {
+        flat.format = version == MapFile::VERSION ? MapFormat::FlatV2 : MapFormat::FlatV1;
+        doc = std::move(flat);
+        return true;
+    }
+    MapDocument layered;
+    if (detail::readLayered(rewind(), layered, version, limits, layeredError))
+    {
+        layered.format = version == MapFile::VERSION ? MapFormat::LayeredV2 : MapFormat::LayeredV1;
+        doc = std::move(layered);
+        return true;
+    }
+    // TileMap::saveToFile은 버전 2 헤더에 형태 없는 v1 타일 레코드를 씀
+    MapDocument legacy;
+    std::string legacyError;
+    if (version == MapFile::VERSION && detail::readFlat(rewind(), legacy, 5, limits, legacyError))
+    {
+        legacy.format = MapFormat::FlatV1;
+        legacy.warnings.push_back("version 2 header with version 1 tile records (written by TileMap::saveToFile)");
+        doc = std::move(legacy);
+        return true;
+    }
+
+    error = "not a flat map (" + flatError + ") or layered map (" + layeredError + ")";
+    return false;
+}
+
+// 지정한 형식으로 저장 (형식 변환으로 잃는 내용은 warnings에)
+inline bool saveMap(const std::string& path, const MapDocument& doc, MapFormat format, std::vector<std::string>& warnings,
+                    std::string& error)
+{
+    switch (format)
+    {
+        case MapFormat::FlatV1:
+        case MapFormat::FlatV2:
+        {
+            std::uint16_t version = format == MapFormat::FlatV1 ? MapFile::VERSION_1 : MapFile::VERSION;
+            if (!detail::writeFile(path, detail::writeFlat(doc, version, warnings)))
+            {
+                error = "failed to write " + path;
+                return false;
+            }
+            return true;
+        }
+        case MapFormat::LayeredV1:
+        case MapFormat::LayeredV2:
+        {
+            std::uint16_t version = format == MapFormat::LayeredV1 ? MapFile::VERSION_1 : MapFile::VERSION;
+            if (!detail::writeFile(path, detail::writeLayered(doc, version, warnings)))
+            {
+                error = "failed to write " + path;
+                return false;
+            }
+            return true;
+        }
+        case MapFormat::Project:
+            return detail::writeProject(path, doc, warnings, error);
+    }
+    error = "unknown format";
+    return false;
+}
+
+} // namespace MapTool
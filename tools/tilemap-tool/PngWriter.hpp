@@ -0,0 +1,123 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// 최소한의 PNG 저장 (8비트 RGB, 압축 없는 deflate 블록)
+// 미리보기는 색이 몇 개뿐이라 압축 효율보다 SFML Graphics/이미지 라이브러리 없이 도는 게 중요함
+namespace PngWriter
+{
+
+namespace detail
+{
+inline std::uint32_t crc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc = 0)
+{
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> result{};
+        for (std::uint32_t i = 0; i < 256; ++i)
+        {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k)
+            {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            result[i] = c;
+        }
+        return result;
+    }();
+
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+inline void putBigEndian(std::vector<std::uint8_t>& out, std::uint32_t value)
+{
+    out.push_back(static_cast<std::uint8_t>(value >> 24));
+    out.push_back(static_cast<std::uint8_t>(value >> 16));
+    out.push_back(static_cast<std::uint8_t>(value >> 8));
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+inline void writeChunk(std::ofstream& file, const char type[4], const std::vector<std::uint8_t>& data)
+{
+    std::vector<std::uint8_t> header;
+    putBigEndian(header, static_cast<std::uint32_t>(data.size()));
+    header.insert(header.end(), type, type + 4);
+    file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    std::uint32_t crc = crc32(header.data() + 4, 4);
+    crc = crc32(data.data(), data.size(), crc);
+    std::vector<std::uint8_t> trailer;
+    putBigEndian(trailer, crc);
+    file.write(reinterpret_cast<const char*>(trailer.data()), static_cast<std::streamsize>(trailer.size()));
+}
+}
+
+// rgb: width * height * 3 바이트 (위쪽 줄부터)
+inline bool saveRgb(const std::string& filename, unsigned int width, unsigned int height, const std::vector<std::uint8_t>& rgb)
+{
+    if (width == 0 || height == 0 || rgb.size() != static_cast<std::size_t>(width) * height * 3) return false;
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    static const std::uint8_t SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    file.write(reinterpret_cast<const char*>(SIGNATURE), sizeof(SIGNATURE));
+
+    std::vector<std::uint8_t> header;
+    detail::putBigEndian(header, width);
+    detail::putBigEndian(header, height);
+    header.insert(header.end(), {8, 2, 0, 0, 0});  // 8비트, RGB, deflate, 기본 필터, 인터레이스 없음
+    detail::writeChunk(file, "IHDR", header);
+
+    // 줄마다 필터 바이트(0) + 픽셀
+    std::size_t stride = static_cast<std::size_t>(width) * 3;
+    std::vector<std::uint8_t> raw;
+    raw.reserve((stride + 1) * height);
+    for (unsigned int y = 0; y < height; ++y)
+    {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgb.begin() + y * stride, rgb.begin() + (y + 1) * stride);
+    }
+
+    // zlib 헤더 + 최대 65535 바이트짜리 stored 블록 + adler32
+    std::vector<std::uint8_t> zlib = {0x78, 0x01};
+    zlib.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+    std::size_t pos = 0;
+    do
+    {
+        std::size_t size = std::min<std::size_t>(65535, raw.size() - pos);
+        bool last = pos + size == raw.size();
+        zlib.push_back(last ? 1 : 0);
+        zlib.push_back(static_cast<std::uint8_t>(size));
+        zlib.push_back(static_cast<std::uint8_t>(size >> 8));
+        zlib.push_back(static_cast<std::uint8_t>(~size));
+        zlib.push_back(static_cast<std::uint8_t>(~size >> 8));
+        zlib.insert(zlib.end(), raw.begin() + pos, raw.begin() + pos + size);
+        pos += size;
+    } while (pos < raw.size());
+
+    std::uint32_t a = 1;
+    std::uint32_t b = 0;
+    for (std::uint8_t byte : raw)
+    {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    detail::putBigEndian(zlib, (b << 16) | a);
+    detail::writeChunk(file, "IDAT", zlib);
+    detail::writeChunk(file, "IEND", {});
+
+    file.close();
+    return !file.fail();
+}
+
+} // namespace PngWriter
@@ -0,0 +1,542 @@
+// 창 없이 도는 맵 파일 일괄 처리 도구 (CI 에셋 파이프라인용)
+//
+//   tilemap-tool validate [--strict] <files...>
+//   tilemap-tool stats <files...>
+//   tilemap-tool convert --to flat-v1|flat-v2|layered-v1|layered-v2|project [--out-dir DIR | -o FILE] <files...>
+//   tilemap-tool preview [--scale N] [--max-size N] [--out-dir DIR] <files...>
+//
+// 공통 옵션: -j N (동시에 처리할 파일 수, 기본 = 코어 수)
+// 파일별 결과는 입력 순서대로 stdout에 출력하고, 하나라도 실패하면 종료 코드 1
+// 형식은 MapDocument.hpp 참고 (flat = 게임용 .tilemap, layered = MapFile::MapData, project = .tmproj)
+
+#include "MapDocument.hpp"
+#include "PngWriter.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace MapTool;
+
+struct Options
+{
+    std::string command;
+    std::vector<std::string> files;
+    unsigned int jobs = 0;  // 0 = 코어 수
+    bool strict = false;
+    bool hasTarget = false;
+    MapFormat target = MapFormat::FlatV2;
+    std::string outDir;
+    std::string outFile;
+    unsigned int scale = 4;         // 미리보기 타일당 픽셀
+    unsigned int maxSize = 4096;    // 미리보기 긴 변 상한 (넘으면 축소)
+};
+
+struct FileResult
+{
+    std::string output;
+    bool ok = true;
+};
+
+void printUsage()
+{
+    std::fprintf(stderr,
+                 "usage: tilemap-tool <validate|stats|convert|preview> [options] <files...>\n"
+                 "  -j N              files processed in parallel (default: hardware threads)\n"
+                 "  --strict          validate: treat warnings as failures\n"
+                 "  --to FORMAT       convert: flat-v1, flat-v2, layered-v1, layered-v2 or project\n"
+                 "  --out-dir DIR     convert/preview: write outputs into DIR\n"
+                 "  -o FILE           convert/preview: output path (single input only)\n"
+                 "  --scale N         preview: pixels per tile (default 4)\n"
+                 "  --max-size N      preview: longest image side, larger maps are scaled down (default 4096)\n");
+}
+
+bool parseArguments(int argc, char** argv, Options& options)
+{
+    if (argc < 2) return false;
+    options.command = argv[1];
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (arg == "-j" && hasValue) options.jobs = static_cast<unsigned int>(std::atoi(argv[++i]));
+        else if (arg == "--strict") options.strict = true;
+        else if (arg == "--to" && hasValue)
+        {
+            options.hasTarget = parseFormat(argv[++i], options.target);
+            if (!options.hasTarget)
+            {
+                std::fprintf(stderr, "Unknown format: %s\n", argv[i]);
+                return false;
+            }
+        }
+        else if (arg == "--out-dir" && hasValue) options.outDir = argv[++i];
+        else if (arg == "-o" && hasValue) options.outFile = argv[++i];
+        else if (arg == "--scale" && hasValue) options.scale = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        else if (arg == "--max-size" && hasValue) options.maxSize = static_cast<unsigned int>(std::max(1, std::atoi(argv[++i])));
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            std::fprintf(stderr, "Unknown or incomplete argument: %s\n", arg.c_str());
+            return false;
+        }
+        else options.files.push_back(arg);
+    }
+
+    if (options.command != "validate" && options.command != "stats" && options.command != "convert" &&
+        options.command != "preview")
+    {
+        std::fprintf(stderr, "Unknown command: %s\n", options.command.c_str());
+        return false;
+    }
+    if (options.files.empty())
+    {
+        std::fprintf(stderr, "No input files\n");
+        return false;
+    }
+    if (options.command == "convert" && !options.hasTarget)
+    {
+        std::fprintf(stderr, "convert needs --to FORMAT\n");
+        return false;
+    }
+    if (!options.outFile.empty() && options.files.size() != 1)
+    {
+        std::fprintf(stderr, "-o can only be used with a single input file\n");
+        return false;
+    }
+    return true;
+}
+
+template<typename... Args>
+void appendf(std::string& out, const char* format, Args... args)
+{
+    char buffer[512];
+    int length = std::snprintf(buffer, sizeof(buffer), format, args...);
+    if (length > 0) out.append(buffer, std::min<std::size_t>(static_cast<std::size_t>(length), sizeof(buffer) - 1));
+}
+
+// -o, --out-dir 또는 입력 옆에 확장자만 바꾼 경로
+std::string outputPath(const Options& options, const std::string& input, const char* extension)
+{
+    if (!options.outFile.empty()) return options.outFile;
+    std::filesystem::path path(input);
+    std::filesystem::path dir = options.outDir.empty() ? path.parent_path() : std::filesystem::path(options.outDir);
+    return (dir / path.stem()).string() + extension;
+}
+
+bool isSameFile(const std::string& a, const std::string& b)
+{
+    std::error_code error;
+    return std::filesystem::exists(b, error) && std::filesystem::equivalent(a, b, error);
+}
+
+// 문제를 error(실패)/warning으로 나눠 기록
+class Report
+{
+public:
+    void error(const std::string& message) { m_errors.push_back(message); }
+    void warning(const std::string& message) { m_warnings.push_back(message); }
+
+    bool ok(bool strict) const { return m_errors.empty() && (!strict || m_warnings.empty()); }
+
+    void appendTo(std::string& out) const
+    {
+        // 같은 종류가 수천 개 나오면 앞의 몇 개만
+        constexpr std::size_t MAX_LINES = 20;
+        appendList(out, "error", m_errors, MAX_LINES);
+        appendList(out, "warning", m_warnings, MAX_LINES);
+    }
+
+private:
+    static void appendList(std::string& out, const char* label, const std::vector<std::string>& list, std::size_t maxLines)
+    {
+        for (std::size_t i = 0; i < list.size() && i < maxLines; ++i)
+        {
+            appendf(out, "  %s: %s\n", label, list[i].c_str());
+        }
+        if (list.size() > maxLines) appendf(out, "  ... %zu more %ss\n", list.size() - maxLines, label);
+    }
+
+    std::vector<std::string> m_errors;
+    std::vector<std::string> m_warnings;
+};
+
+std::string tileName(const MapLayer& layer, const MapTile& tile)
+{
+    return "layer '" + layer.name + "' tile (" + std::to_string(tile.x) + ", " + std::to_string(tile.y) + ")";
+}
+
+void validateDocument(const MapDocument& doc, Report& report)
+{
+    for (const std::string& warning : doc.warnings)
+    {
+        report.warning(warning);
+    }
+    if (doc.gridSize == 0) report.error("grid size is 0");
+    if (doc.width == 0 || doc.height == 0) report.error("map size is 0");
+    if (doc.width > ProjectFile::MAX_MAP_SIZE || doc.height > ProjectFile::MAX_MAP_SIZE)
+    {
+        report.error("map size exceeds " + std::to_string(ProjectFile::MAX_MAP_SIZE) + " tiles");
+    }
+    if (doc.layers.empty()) report.warning("no layers");
+
+    for (const MapLayer& layer : doc.layers)
+    {
+        for (const MapTile& tile : layer.tiles)
+        {
+            if (tile.x >= doc.width || tile.y >= doc.height) report.error(tileName(layer, tile) + " is outside the map");
+            if (tile.type >= TILE_TYPE_COUNT)
+            {
+                report.error(tileName(layer, tile) + " has unknown type " + std::to_string(tile.type));
+            }
+            else if (tile.type == TILE_EMPTY)
+            {
+                report.warning(tileName(layer, tile) + " is stored but empty");
+            }
+            if (tile.shape >= SHAPE_COUNT)
+            {
+                report.error(tileName(layer, tile) + " has unknown collision shape " + std::to_string(tile.shape));
+            }
+            else if (tile.type == TILE_PLATFORM && tile.shape != SHAPE_PLATFORM)
+            {
+                report.warning(tileName(layer, tile) + " is a platform without the platform shape");
+            }
+            else if (tile.type == TILE_SOLID && (tile.shape == SHAPE_NONE || tile.shape == SHAPE_PLATFORM))
+            {
+                report.warning(tileName(layer, tile) + " is solid with shape " + std::to_string(tile.shape));
+            }
+        }
+
+        // 같은 레이어에 같은 칸이 두 번 (로더에 따라 어느 쪽이 이길지 다름)
+        std::vector<std::uint32_t> keys;
+        keys.reserve(layer.tiles.size());
+        for (const MapTile& tile : layer.tiles)
+        {
+            keys.push_back((static_cast<std::uint32_t>(tile.y) << 16) | tile.x);
+        }
+        std::sort(keys.begin(), keys.end());
+        for (std::size_t i = 1; i < keys.size(); ++i)
+        {
+            if (keys[i] == keys[i - 1] && (i < 2 || keys[i - 2] != keys[i]))
+            {
+                report.warning("layer '" + layer.name + "' has duplicate tiles at (" + std::to_string(keys[i] & 0xFFFF) +
+                               ", " + std::to_string(keys[i] >> 16) + ")");
+            }
+        }
+    }
+
+    auto inMap = [&](std::int32_t x, std::int32_t y) {
+        return x >= 0 && y >= 0 && static_cast<std::uint32_t>(x) < doc.width && static_cast<std::uint32_t>(y) < doc.height;
+    };
+    if (!doc.hasPlayerSpawn())
+    {
+        report.warning("no player spawn");
+    }
+    else if (!inMap(doc.playerX, doc.playerY))
+    {
+        report.error("player spawn (" + std::to_string(doc.playerX) + ", " + std::to_string(doc.playerY) +
+                     ") is outside the map");
+    }
+    for (const MapSpawn& spawn : doc.enemies)
+    {
+        if (!inMap(spawn.x, spawn.y))
+        {
+            report.error("enemy spawn (" + std::to_string(spawn.x) + ", " + std::to_string(spawn.y) + ") is outside the map");
+        }
+    }
+}
+
+FileResult runValidate(const Options& options, const std::string& file)
+{
+    FileResult result;
+    MapDocument doc;
+    std::string error;
+    Report report;
+    if (!loadMap(file, doc, error))
+    {
+        report.error(error);
+    }
+    else
+    {
+        validateDocument(doc, report);
+    }
+    result.ok = report.ok(options.strict);
+    appendf(result.output, "%s: %s\n", file.c_str(), result.ok ? "ok" : "FAILED");
+    report.appendTo(result.output);
+    return result;
+}
+
+FileResult runStats(const Options&, const std::string& file)
+{
+    FileResult result;
+    MapDocument doc;
+    std::string error;
+    if (!loadMap(file, doc, error))
+    {
+        result.ok = false;
+        appendf(result.output, "%s: error: %s\n", file.c_str(), error.c_str());
+        return result;
+    }
+
+    std::size_t typeCounts[256] = {};
+    std::size_t shapeCounts[256] = {};
+    std::size_t tileCount = 0;
+    std::uint32_t minX = UINT32_MAX, minY = UINT32_MAX, maxX = 0, maxY = 0;
+    for (const MapLayer& layer : doc.layers)
+    {
+        for (const MapTile& tile : layer.tiles)
+        {
+            ++typeCounts[tile.type];
+            ++shapeCounts[tile.shape];
+            ++tileCount;
+            minX = std::min<std::uint32_t>(minX, tile.x);
+            minY = std::min<std::uint32_t>(minY, tile.y);
+            maxX = std::max<std::uint32_t>(maxX, tile.x);
+            maxY = std::max<std::uint32_t>(maxY, tile.y);
+        }
+    }
+
+    std::string& out = result.output;
+    appendf(out, "%s:\n", file.c_str());
+    appendf(out, "  format:       %s\n", formatName(doc.format));
+    appendf(out, "  size:         %ux%u tiles, grid %u px\n", doc.width, doc.height, static_cast<unsigned int>(doc.gridSize));
+    appendf(out, "  layers:       %zu\n", doc.layers.size());
+    for (const MapLayer& layer : doc.layers)
+    {
+        appendf(out, "    %-20s %10zu tiles%s\n", layer.name.c_str(), layer.tiles.size(), layer.visible ? "" : " (hidden)");
+    }
+    appendf(out, "  tiles:        %zu\n", tileCount);
+    static const char* TYPE_NAMES[TILE_TYPE_COUNT] = {"empty", "solid", "platform"};
+    for (int type = 0; type < 256; ++type)
+    {
+        if (typeCounts[type] == 0) continue;
+        if (type < TILE_TYPE_COUNT) appendf(out, "    %-12s %10zu\n", TYPE_NAMES[type], typeCounts[type]);
+        else appendf(out, "    type %-7d %10zu\n", type, typeCounts[type]);
+    }
+    appendf(out, "  shapes:\n");
+    for (int shape = 0; shape < 256; ++shape)
+    {
+        if (shapeCounts[shape] > 0) appendf(out, "    shape %-6d %10zu\n", shape, shapeCounts[shape]);
+    }
+    if (tileCount > 0)
+    {
+        appendf(out, "  bounding box: (%u, %u) - (%u, %u), %ux%u tiles\n", minX, minY, maxX, maxY, maxX - minX + 1,
+                maxY - minY + 1);
+    }
+    else
+    {
+        appendf(out, "  bounding box: none\n");
+    }
+
+    if (doc.hasPlayerSpawn()) appendf(out, "  player spawn: (%d, %d)\n", doc.playerX, doc.playerY);
+    else appendf(out, "  player spawn: none\n");
+    std::map<int, std::size_t> enemyTypes;
+    for (const MapSpawn& spawn : doc.enemies)
+    {
+        ++enemyTypes[spawn.type];
+    }
+    appendf(out, "  enemy spawns: %zu\n", doc.enemies.size());
+    for (const auto& [type, count] : enemyTypes)
+    {
+        appendf(out, "    type %-7d %10zu\n", type, count);
+    }
+    for (const std::string& warning : doc.warnings)
+    {
+        appendf(out, "  warning: %s\n", warning.c_str());
+    }
+    return result;
+}
+
+FileResult runConvert(const Options& options, const std::string& file)
+{
+    FileResult result;
+    MapDocument doc;
+    std::string error;
+    if (!loadMap(file, doc, error))
+    {
+        result.ok = false;
+        appendf(result.output, "%s: error: %s\n", file.c_str(), error.c_str());
+        return result;
+    }
+
+    std::string output = outputPath(options, file, formatExtension(options.target));
+    if (isSameFile(file, output))
+    {
+        result.ok = false;
+        appendf(result.output, "%s: error: output would overwrite the input, use --out-dir or -o\n", file.c_str());
+        return result;
+    }
+
+    std::vector<std::string> warnings = doc.warnings;
+    if (!saveMap(output, doc, options.target, warnings, error))
+    {
+        result.ok = false;
+        appendf(result.output, "%s: error: %s\n", file.c_str(), error.c_str());
+        return result;
+    }
+    appendf(result.output, "%s: %s -> %s (%s)\n", file.c_str(), formatName(doc.format), output.c_str(),
+            formatName(options.target));
+    for (const std::string& warning : warnings)
+    {
+        appendf(result.output, "  warning: %s\n", warning.c_str());
+    }
+    return result;
+}
+
+FileResult runPreview(const Options& options, const std::string& file)
+{
+    FileResult result;
+    MapDocument doc;
+    std::string error;
+    if (!loadMap(file, doc, error))
+    {
+        result.ok = false;
+        appendf(result.output, "%s: error: %s\n", file.c_str(), error.c_str());
+        return result;
+    }
+    if (doc.width == 0 || doc.height == 0)
+    {
+        result.ok = false;
+        appendf(result.output, "%s: error: map size is 0\n", file.c_str());
+        return result;
+    }
+
+    // 긴 변이 maxSize를 넘으면 비율을 유지하며 줄임 (타일 여러 개가 한 픽셀에 겹치면 나중 것이 보임)
+    double pixelsPerTile = options.scale;
+    std::uint32_t longest = std::max(doc.width, doc.height);
+    if (longest * pixelsPerTile > options.maxSize) pixelsPerTile = static_cast<double>(options.maxSize) / longest;
+    unsigned int imageWidth = std::max(1u, static_cast<unsigned int>(doc.width * pixelsPerTile));
+    unsigned int imageHeight = std::max(1u, static_cast<unsigned int>(doc.height * pixelsPerTile));
+
+    struct Rgb
+    {
+        std::uint8_t r, g, b;
+    };
+    const Rgb BACKGROUND{50, 50, 55};
+    const Rgb TYPE_COLORS[TILE_TYPE_COUNT] = {BACKGROUND, {80, 60, 40}, {60, 100, 60}};
+    const Rgb UNKNOWN{255, 0, 255};
+    const Rgb PLAYER{60, 220, 60};
+    const Rgb ENEMY{220, 50, 50};
+
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(imageWidth) * imageHeight * 3);
+    for (std::size_t i = 0; i < pixels.size(); i += 3)
+    {
+        pixels[i] = BACKGROUND.r;
+        pixels[i + 1] = BACKGROUND.g;
+        pixels[i + 2] = BACKGROUND.b;
+    }
+
+    // 타일 (x, y)가 덮는 픽셀 영역에 칠함 (축소되어도 최소 1픽셀)
+    auto fill = [&](std::int64_t tileX, std::int64_t tileY, const Rgb& color, unsigned int minPixels) {
+        if (tileX < 0 || tileY < 0 || tileX >= doc.width || tileY >= doc.height) return;
+        unsigned int x0 = static_cast<unsigned int>(tileX * imageWidth / doc.width);
+        unsigned int y0 = static_cast<unsigned int>(tileY * imageHeight / doc.height);
+        unsigned int x1 = std::max(x0 + minPixels, static_cast<unsigned int>((tileX + 1) * imageWidth / doc.width));
+        unsigned int y1 = std::max(y0 + minPixels, static_cast<unsigned int>((tileY + 1) * imageHeight / doc.height));
+        x1 = std::min(x1, imageWidth);
+        y1 = std::min(y1, imageHeight);
+        for (unsigned int y = y0; y < y1; ++y)
+        {
+            for (unsigned int x = x0; x < x1; ++x)
+            {
+                std::uint8_t* pixel = &pixels[(static_cast<std::size_t>(y) * imageWidth + x) * 3];
+                pixel[0] = color.r;
+                pixel[1] = color.g;
+                pixel[2] = color.b;
+            }
+        }
+    };
+
+    for (const MapLayer& layer : doc.layers)
+    {
+        if (!layer.visible) continue;
+        for (const MapTile& tile : layer.tiles)
+        {
+            fill(tile.x, tile.y, tile.type < TILE_TYPE_COUNT ? TYPE_COLORS[tile.type] : UNKNOWN, 1);
+        }
+    }
+    // 스폰은 작게 축소돼도 보이도록 몇 픽셀짜리 점으로
+    unsigned int markerSize = std::max(3u, static_cast<unsigned int>(pixelsPerTile));
+    for (const MapSpawn& spawn : doc.enemies)
+    {
+        fill(spawn.x, spawn.y, ENEMY, markerSize);
+    }
+    if (doc.hasPlayerSpawn()) fill(doc.playerX, doc.playerY, PLAYER, markerSize);
+
+    std::string output = outputPath(options, file, ".png");
+    if (!PngWriter::saveRgb(output, imageWidth, imageHeight, pixels))
+    {
+        result.ok = false;
+        appendf(result.output, "%s: error: failed to write %s\n", file.c_str(), output.c_str());
+        return result;
+    }
+    appendf(result.output, "%s: %s (%ux%u)\n", file.c_str(), output.c_str(), imageWidth, imageHeight);
+    return result;
+}
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parseArguments(argc, argv, options))
+    {
+        printUsage();
+        return 2;
+    }
+    if (!options.outDir.empty())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(options.outDir, error);
+        if (error)
+        {
+            std::fprintf(stderr, "Cannot create %s: %s\n", options.outDir.c_str(), error.message().c_str());
+            return 2;
+        }
+    }
+
+    FileResult (*run)(const Options&, const std::string&) = runValidate;
+    if (options.command == "stats") run = runStats;
+    else if (options.command == "convert") run = runConvert;
+    else if (options.command == "preview") run = runPreview;
+
+    // 파일 단위로 나눠 처리 (파일 크기가 제각각이라 정적 분할 대신 다음 파일을 가져가는 방식)
+    std::vector<FileResult> results(options.files.size());
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < options.files.size(); i = next++)
+        {
+            results[i] = run(options, options.files[i]);
+        }
+    };
+
+    unsigned int jobs = options.jobs > 0 ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+    jobs = static_cast<unsigned int>(std::min<std::size_t>(jobs, options.files.size()));
+    std::vector<std::thread> threads;
+    for (unsigned int i = 1; i < jobs; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::size_t failed = 0;
+    for (const FileResult& result : results)
+    {
+        std::fputs(result.output.c_str(), stdout);
+        if (!result.ok) ++failed;
+    }
+    if (options.files.size() > 1)
+    {
+        std::printf("%zu files, %zu failed\n", options.files.size(), failed);
+    }
+    return failed == 0 ? 0 : 1;
+}